@@ -141,18 +141,24 @@ bool NotificationController::QueueMutationEvent(AccTreeMutationEvent* aEvent) {
   mLastMutationEvent = aEvent;
   mMutationMap.PutEvent(aEvent);
 
-  // Because we could be hiding the target of a show event we need to get rid
-  // of any such events.  It may be possible to do less than coallesce all
-  // events, however that is easiest.
+  // If this hide is inside a subtree that already has a queued show or hide
+  // event, then it coalesces away and a parent accessible must already have
+  // the required reorder and text change events, so we are done here. Events
+  // queued for other targets inside the hidden subtree become redundant too,
+  // but those are cleaned up by the full CoalesceMutationEvents() pass when
+  // the queue is processed; only the fate of aEvent needs to be known now,
+  // and the ancestor walk keeps queueing a burst of hide events linear in
+  // the queue length instead of quadratic.
   if (aEvent->GetEventType() == nsIAccessibleEvent::EVENT_HIDE) {
-    CoalesceMutationEvents();
-
-    // mLastMutationEvent will point to something other than aEvent if and only
-    // if aEvent was just coalesced away.  In that case a parent accessible
-    // must already have the required reorder and text change events so we are
-    // done here.
-    if (mLastMutationEvent != aEvent) {
-      return false;
+    AccHideEvent* hideEvent = downcast_accEvent(aEvent);
+    for (Accessible* parent = hideEvent->Parent();
+         parent && !parent->IsDoc(); parent = parent->Parent()) {
+      // A show event on an ancestor was necessarily queued before this hide
+      // event, so its generation is lower and it coalesces the hide away.
+      if (parent->HideEventTarget() || parent->ShowEventTarget()) {
+        DropMutationEvent(aEvent);
+        return false;
+      }
     }
   }
 
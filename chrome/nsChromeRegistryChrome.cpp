@@ -86,7 +86,9 @@ static bool LanguagesMatch(const nsACString& a, const nsACString& b) {
 }
 
 nsChromeRegistryChrome::nsChromeRegistryChrome()
-    : mProfileLoaded(false), mDynamicRegistration(true) {}
+    : mProfileLoaded(false),
+      mDynamicRegistration(true),
+      mSerializedChromeValid(false) {}
 
 nsChromeRegistryChrome::~nsChromeRegistryChrome() {}
 
@@ -199,6 +201,9 @@ nsChromeRegistryChrome::Observe(nsISupports* aSubject, const char* aTopic,
   if (!strcmp("profile-initial-state", aTopic)) {
     mProfileLoaded = true;
   } else if (!strcmp("intl:app-locales-changed", aTopic)) {
+    // The serialized packages embed the locale base URI selected for the app
+    // locale, so they have to be rebuilt for the next child process.
+    mSerializedChromeValid = false;
     if (mProfileLoaded) {
       FlushAllCaches();
     }
@@ -219,6 +224,7 @@ nsChromeRegistryChrome::CheckForNewChrome() {
 
   mPackagesHash.Clear();
   mOverrideTable.Clear();
+  mSerializedChromeValid = false;
 
   mDynamicRegistration = false;
 
@@ -238,15 +244,33 @@ static void SerializeURI(nsIURI* aURI, SerializedURI& aSerializedURI) {
 
 void nsChromeRegistryChrome::SendRegisteredChrome(
     mozilla::dom::PContentParent* aParent) {
-  InfallibleTArray<ChromePackage> packages;
   InfallibleTArray<SubstitutionMapping> resources;
-  InfallibleTArray<OverrideMapping> overrides;
 
-  for (auto iter = mPackagesHash.Iter(); !iter.Done(); iter.Next()) {
-    ChromePackage chromePackage;
-    ChromePackageFromPackageEntry(iter.Key(), iter.UserData(), &chromePackage,
-                                  SKIN);
-    packages.AppendElement(chromePackage);
+  // The packages and overrides only change when a manifest is registered or
+  // the app locale changes, so the serialized arrays can be shared by every
+  // child process launched in between.
+  if (!mSerializedChromeValid) {
+    mSerializedPackages.Clear();
+    mSerializedOverrides.Clear();
+
+    for (auto iter = mPackagesHash.Iter(); !iter.Done(); iter.Next()) {
+      ChromePackage chromePackage;
+      ChromePackageFromPackageEntry(iter.Key(), iter.UserData(), &chromePackage,
+                                    SKIN);
+      mSerializedPackages.AppendElement(chromePackage);
+    }
+
+    for (auto iter = mOverrideTable.Iter(); !iter.Done(); iter.Next()) {
+      SerializedURI chromeURI, overrideURI;
+
+      SerializeURI(iter.Key(), chromeURI);
+      SerializeURI(iter.UserData(), overrideURI);
+
+      OverrideMapping override = {chromeURI, overrideURI};
+      mSerializedOverrides.AppendElement(override);
+    }
+
+    mSerializedChromeValid = true;
   }
 
   // If we were passed a parent then a new child process has been created and
@@ -266,22 +290,12 @@ void nsChromeRegistryChrome::SendRegisteredChrome(
     NS_ENSURE_SUCCESS_VOID(rv);
   }
 
-  for (auto iter = mOverrideTable.Iter(); !iter.Done(); iter.Next()) {
-    SerializedURI chromeURI, overrideURI;
-
-    SerializeURI(iter.Key(), chromeURI);
-    SerializeURI(iter.UserData(), overrideURI);
-
-    OverrideMapping override = {chromeURI, overrideURI};
-    overrides.AppendElement(override);
-  }
-
   nsAutoCString appLocale;
   LocaleService::GetInstance()->GetAppLocaleAsLangTag(appLocale);
 
   if (aParent) {
-    bool success = aParent->SendRegisterChrome(packages, resources, overrides,
-                                               appLocale, false);
+    bool success = aParent->SendRegisterChrome(
+        mSerializedPackages, resources, mSerializedOverrides, appLocale, false);
     NS_ENSURE_TRUE_VOID(success);
   } else {
     nsTArray<ContentParent*> parents;
@@ -290,7 +304,8 @@ void nsChromeRegistryChrome::SendRegisteredChrome(
 
     for (uint32_t i = 0; i < parents.Length(); i++) {
       DebugOnly<bool> success = parents[i]->SendRegisterChrome(
-          packages, resources, overrides, appLocale, true);
+          mSerializedPackages, resources, mSerializedOverrides, appLocale,
+          true);
       NS_WARNING_ASSERTION(success,
                            "couldn't reset a child's registered chrome");
     }
@@ -488,6 +503,7 @@ void nsChromeRegistryChrome::ManifestContent(ManifestProcessingContext& cx,
   PackageEntry* entry = mPackagesHash.LookupOrAdd(packageName);
   entry->baseURI = resolved;
   entry->flags = flags;
+  mSerializedChromeValid = false;
 
   if (mDynamicRegistration) {
     ChromePackage chromePackage;
@@ -524,6 +540,7 @@ void nsChromeRegistryChrome::ManifestLocale(ManifestProcessingContext& cx,
   nsDependentCString packageName(package);
   PackageEntry* entry = mPackagesHash.LookupOrAdd(packageName);
   entry->locales.SetBase(nsDependentCString(provider), resolved);
+  mSerializedChromeValid = false;
 
   if (mDynamicRegistration) {
     ChromePackage chromePackage;
@@ -570,6 +587,7 @@ void nsChromeRegistryChrome::ManifestSkin(ManifestProcessingContext& cx,
   nsDependentCString packageName(package);
   PackageEntry* entry = mPackagesHash.LookupOrAdd(packageName);
   entry->skins.SetBase(nsDependentCString(provider), resolved);
+  mSerializedChromeValid = false;
 
   if (mDynamicRegistration) {
     ChromePackage chromePackage;
@@ -626,6 +644,7 @@ void nsChromeRegistryChrome::ManifestOverride(ManifestProcessingContext& cx,
     return;
   }
   mOverrideTable.Put(chromeuri, resolveduri);
+  mSerializedChromeValid = false;
 
   if (mDynamicRegistration) {
     SerializedURI serializedChrome;
@@ -11,6 +11,7 @@
 #include "nsTArray.h"
 #include "mozilla/Move.h"
 #include "nsClassHashtable.h"
+#include "mozilla/chrome/RegistryMessageUtils.h"
 
 namespace mozilla {
 namespace dom {
@@ -19,7 +20,6 @@ class PContentParent;
 }  // namespace mozilla
 
 class nsIPrefBranch;
-struct ChromePackage;
 
 class nsChromeRegistryChrome : public nsChromeRegistry {
  public:
@@ -103,9 +103,21 @@ class nsChromeRegistryChrome : public nsChromeRegistry {
   bool mProfileLoaded;
   bool mDynamicRegistration;
 
+  // Whether mSerializedPackages and mSerializedOverrides reflect the current
+  // registration state.  Serializing the whole registry is expensive enough
+  // that we don't want to redo it for every child process launch, so the
+  // arrays are kept until a manifest registration or app locale change
+  // invalidates them.
+  bool mSerializedChromeValid;
+
   // Hash of package names ("global") to PackageEntry objects
   nsClassHashtable<nsCStringHashKey, PackageEntry> mPackagesHash;
 
+  // Cached serializations of mPackagesHash and mOverrideTable for
+  // SendRegisteredChrome, valid while mSerializedChromeValid is true.
+  InfallibleTArray<ChromePackage> mSerializedPackages;
+  InfallibleTArray<OverrideMapping> mSerializedOverrides;
+
   virtual void ManifestContent(ManifestProcessingContext& cx, int lineno,
                                char* const* argv, int flags) override;
   virtual void ManifestLocale(ManifestProcessingContext& cx, int lineno,
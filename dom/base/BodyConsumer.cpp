@@ -713,22 +713,20 @@ void BodyConsumer::ContinueConsumeBody(nsresult aStatus, uint32_t aResultLength,
       }
       break;
     }
-    case CONSUME_TEXT:
-      // fall through handles early exit.
-    case CONSUME_JSON: {
+    case CONSUME_TEXT: {
       nsString decoded;
       if (NS_SUCCEEDED(
               BodyUtil::ConsumeText(aResultLength, aResult, decoded))) {
-        if (mConsumeType == CONSUME_TEXT) {
-          localPromise->MaybeResolve(decoded);
-        } else {
-          JS::Rooted<JS::Value> json(cx);
-          BodyUtil::ConsumeJson(cx, &json, decoded, error);
-          if (!error.Failed()) {
-            localPromise->MaybeResolve(cx, json);
-          }
-        }
-      };
+        localPromise->MaybeResolve(decoded);
+      }
+      break;
+    }
+    case CONSUME_JSON: {
+      JS::Rooted<JS::Value> json(cx);
+      BodyUtil::ConsumeJson(cx, &json, aResultLength, aResult, error);
+      if (!error.Failed()) {
+        localPromise->MaybeResolve(cx, json);
+      }
       break;
     }
     default:
@@ -21,6 +21,7 @@
 #include "js/ArrayBuffer.h"  // JS::NewArrayBufferWithContents
 #include "js/JSON.h"
 #include "mozilla/ErrorResult.h"
+#include "mozilla/TextUtils.h"
 #include "mozilla/dom/Exceptions.h"
 #include "mozilla/dom/FetchUtil.h"
 #include "mozilla/dom/File.h"
@@ -474,6 +475,21 @@ nsresult BodyUtil::ConsumeText(uint32_t aInputLength, uint8_t* aInput,
   return NS_OK;
 }
 
+// Moves the exception pending on |aCx| after a failed JSON parse into |aRv|.
+static void PropagateJsonParseError(JSContext* aCx, ErrorResult& aRv) {
+  if (!JS_IsExceptionPending(aCx)) {
+    aRv.Throw(NS_ERROR_DOM_UNKNOWN_ERR);
+    return;
+  }
+
+  JS::Rooted<JS::Value> exn(aCx);
+  DebugOnly<bool> gotException = JS_GetPendingException(aCx, &exn);
+  MOZ_ASSERT(gotException);
+
+  JS_ClearPendingException(aCx);
+  aRv.ThrowJSException(aCx, exn);
+}
+
 // static
 void BodyUtil::ConsumeJson(JSContext* aCx, JS::MutableHandle<JS::Value> aValue,
                            const nsString& aStr, ErrorResult& aRv) {
@@ -481,21 +497,58 @@ void BodyUtil::ConsumeJson(JSContext* aCx, JS::MutableHandle<JS::Value> aValue,
 
   JS::Rooted<JS::Value> json(aCx);
   if (!JS_ParseJSON(aCx, aStr.get(), aStr.Length(), &json)) {
-    if (!JS_IsExceptionPending(aCx)) {
-      aRv.Throw(NS_ERROR_DOM_UNKNOWN_ERR);
+    PropagateJsonParseError(aCx, aRv);
+    return;
+  }
+
+  aValue.set(json);
+}
+
+// static
+void BodyUtil::ConsumeJson(JSContext* aCx, JS::MutableHandle<JS::Value> aValue,
+                           uint32_t aInputLength, uint8_t* aInput,
+                           ErrorResult& aRv) {
+  // Strip the UTF-8 BOM, if any, just as DecodeWithBOMRemoval() would.
+  auto bytes = MakeSpan(aInput, aInputLength);
+  if (bytes.Length() >= 3 && bytes[0] == 0xEF && bytes[1] == 0xBB &&
+      bytes[2] == 0xBF) {
+    bytes = bytes.From(3);
+  }
+
+  // JSON payloads are overwhelmingly ASCII, and ASCII bytes are valid Latin-1
+  // code points, so the parser can consume them in place.  This avoids
+  // inflating the whole payload into a UTF-16 copy first, which is a
+  // significant cost for multi-megabyte responses.
+  bool isAscii = true;
+  for (uint8_t byte : bytes) {
+    if (!IsAscii(byte)) {
+      isAscii = false;
+      break;
+    }
+  }
+
+  if (isAscii) {
+    aRv.MightThrowJSException();
+
+    JS::Rooted<JS::Value> json(aCx);
+    if (!JS_ParseJSON(aCx,
+                      reinterpret_cast<const JS::Latin1Char*>(bytes.Elements()),
+                      bytes.Length(), &json)) {
+      PropagateJsonParseError(aCx, aRv);
       return;
     }
 
-    JS::Rooted<JS::Value> exn(aCx);
-    DebugOnly<bool> gotException = JS_GetPendingException(aCx, &exn);
-    MOZ_ASSERT(gotException);
+    aValue.set(json);
+    return;
+  }
 
-    JS_ClearPendingException(aCx);
-    aRv.ThrowJSException(aCx, exn);
+  nsString decoded;
+  if (NS_FAILED(ConsumeText(aInputLength, aInput, decoded))) {
+    aRv.Throw(NS_ERROR_DOM_UNKNOWN_ERR);
     return;
   }
 
-  aValue.set(json);
+  ConsumeJson(aCx, aValue, decoded, aRv);
 }
 
 }  // namespace dom
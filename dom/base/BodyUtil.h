@@ -63,6 +63,17 @@ class BodyUtil final {
    */
   static void ConsumeJson(JSContext* aCx, JS::MutableHandle<JS::Value> aValue,
                           const nsString& aStr, ErrorResult& aRv);
+
+  /**
+   * Parses the UTF-8 encoded |aInput| as JSON, assigning the result to
+   * |aValue|.  Unlike the nsString overload, ASCII input is handed to the
+   * parser as-is instead of being inflated into a UTF-16 copy first.  The
+   * caller may free |aInput| once this method returns.  Sets |aRv| to a
+   * syntax error if |aInput| contains invalid data.
+   */
+  static void ConsumeJson(JSContext* aCx, JS::MutableHandle<JS::Value> aValue,
+                          uint32_t aInputLength, uint8_t* aInput,
+                          ErrorResult& aRv);
 };
 
 }  // namespace dom
@@ -966,6 +966,15 @@ void CustomElementRegistry::SetElementCreationCallback(
 }
 
 void CustomElementRegistry::Upgrade(nsINode& aRoot) {
+  // Every node in the subtree shares aRoot's node document, so resolve that
+  // document's registry once instead of taking the document -> window ->
+  // registry trip again for each descendant.
+  RefPtr<CustomElementRegistry> registry =
+      nsContentUtils::GetCustomElementRegistry(aRoot.OwnerDoc());
+  if (!registry) {
+    return;
+  }
+
   for (nsINode* node : ShadowIncludingTreeIterator(aRoot)) {
     Element* element = Element::FromNode(node);
     if (!element) {
@@ -975,11 +984,15 @@ void CustomElementRegistry::Upgrade(nsINode& aRoot) {
     CustomElementData* ceData = element->GetCustomElementData();
     if (ceData) {
       NodeInfo* nodeInfo = element->NodeInfo();
+      int32_t namespaceID = nodeInfo->NamespaceID();
+      if (namespaceID != kNameSpaceID_XUL &&
+          namespaceID != kNameSpaceID_XHTML) {
+        continue;
+      }
       nsAtom* typeAtom = ceData->GetCustomElementType();
       CustomElementDefinition* definition =
-          nsContentUtils::LookupCustomElementDefinition(
-              nodeInfo->GetDocument(), nodeInfo->NameAtom(),
-              nodeInfo->NamespaceID(), typeAtom);
+          registry->LookupCustomElementDefinition(nodeInfo->NameAtom(),
+                                                  namespaceID, typeAtom);
       if (definition) {
         nsContentUtils::EnqueueUpgradeReaction(element, definition);
       }
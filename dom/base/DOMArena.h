@@ -0,0 +1,100 @@
+/* -*- Mode: C++; tab-width: 8; indent-tabs-mode: nil; c-basic-offset: 2 -*- */
+/* vim: set ts=8 sts=2 et sw=2 tw=80: */
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef mozilla_dom_DOMArena_h
+#define mozilla_dom_DOMArena_h
+
+#include "mozilla/ArenaAllocator.h"
+#include "mozilla/RefPtr.h"
+#include "nsISupportsImpl.h"
+#include "nsTArray.h"
+
+namespace mozilla {
+namespace dom {
+
+/**
+ * An arena that DOM nodes owned by a single document are allocated from.
+ *
+ * Each allocation is preceded by a header that owns a reference to the
+ * arena, so the backing chunks stay alive until the last node allocated
+ * from them has been destroyed, no matter how long script keeps a node
+ * alive after its document has gone away.  Freed allocations are kept on
+ * per-size free lists and handed out again for later nodes of the same
+ * document; the chunks themselves only go back to the heap when the arena
+ * dies.  Tearing down a large document therefore costs a handful of large
+ * frees rather than one heap free per node.
+ */
+class DOMArena final {
+ public:
+  NS_INLINE_DECL_REFCOUNTING(DOMArena)
+
+  DOMArena() = default;
+
+  void* AllocateObject(size_t aSize) {
+    Header* header = nullptr;
+    for (FreeList& list : mFreeLists) {
+      if (list.mSize == aSize && list.mHead) {
+        header = list.mHead;
+        list.mHead = header->mNext;
+        break;
+      }
+    }
+    if (!header) {
+      header = static_cast<Header*>(mPool.Allocate(sizeof(Header) + aSize));
+    }
+    // The allocation keeps the arena alive; FreeObject drops the reference.
+    AddRef();
+    header->mArena = this;
+    return header + 1;
+  }
+
+  static void FreeObject(void* aPtr, size_t aSize) {
+    Header* header = reinterpret_cast<Header*>(aPtr) - 1;
+    RefPtr<DOMArena> arena = dont_AddRef(header->mArena);
+    FreeList* list = nullptr;
+    for (FreeList& candidate : arena->mFreeLists) {
+      if (candidate.mSize == aSize) {
+        list = &candidate;
+        break;
+      }
+    }
+    if (!list) {
+      list = arena->mFreeLists.AppendElement(FreeList{aSize, nullptr});
+    }
+    header->mNext = list->mHead;
+    list->mHead = header;
+    // If this was the last allocation keeping the arena alive, the chunks
+    // are freed when |arena| goes out of scope.
+  }
+
+  size_t SizeOfExcludingThis(MallocSizeOf aMallocSizeOf) const {
+    return mPool.SizeOfExcludingThis(aMallocSizeOf) +
+           mFreeLists.ShallowSizeOfExcludingThis(aMallocSizeOf);
+  }
+
+ private:
+  ~DOMArena() = default;
+
+  // While an allocation is live its header owns a reference to the arena;
+  // once it has been freed the header links it into a free list instead.
+  union Header {
+    DOMArena* mArena;
+    Header* mNext;
+  };
+
+  struct FreeList {
+    size_t mSize;
+    Header* mHead;
+  };
+
+  ArenaAllocator<4096, 8> mPool;
+  AutoTArray<FreeList, 2> mFreeLists;
+};
+
+}  // namespace dom
+}  // namespace mozilla
+
+#endif  // mozilla_dom_DOMArena_h
@@ -285,6 +285,13 @@ void DOMIntersectionObserver::Update(Document* aDocument,
         mRootMargin.Get(side).Resolve(basis, NSToCoordRoundWithClamp);
   }
 
+  // SimilarOrigin() may have to compare principal base domains, which
+  // allocates; virtually all targets of an observer share one principal, so
+  // remember the result for the principal we looked at last instead of
+  // redoing the comparison for every target on every tick.
+  nsIPrincipal* lastPrincipal = nullptr;
+  BrowsingContextOrigin lastOrigin = BrowsingContextOrigin::Unknown;
+
   for (Element* target : mObservationTargets) {
     nsIFrame* targetFrame = target->GetPrimaryFrame();
     nsIFrame* originalTargetFrame = targetFrame;
@@ -346,7 +353,12 @@ void DOMIntersectionObserver::Update(Document* aDocument,
       rootIntersectionRect = rootRect;
     }
 
-    BrowsingContextOrigin origin = SimilarOrigin(*target, root);
+    nsIPrincipal* principal = target->NodePrincipal();
+    if (principal != lastPrincipal) {
+      lastPrincipal = principal;
+      lastOrigin = SimilarOrigin(*target, root);
+    }
+    BrowsingContextOrigin origin = lastOrigin;
     if (origin == BrowsingContextOrigin::Similar) {
       rootIntersectionRect.Inflate(rootMargin);
     }
@@ -604,6 +604,7 @@ nsresult TimeoutManager::SetTimeout(TimeoutHandler* aHandler, int32_t interval,
   mTimeouts.Insert(timeout, sort);
 
   timeout->mTimeoutId = GetTimeoutId(aReason);
+  mTimeoutsById.Put(TimeoutIdKey(timeout->mTimeoutId, aReason), timeout);
   *aReturn = timeout->mTimeoutId;
 
   MOZ_LOG(
@@ -622,76 +623,62 @@ nsresult TimeoutManager::SetTimeout(TimeoutHandler* aHandler, int32_t interval,
   return NS_OK;
 }
 
-// Make sure we clear it no matter which list it's in
 void TimeoutManager::ClearTimeout(int32_t aTimerId, Timeout::Reason aReason) {
-  if (ClearTimeoutInternal(aTimerId, aReason, false) ||
-      mIdleTimeouts.IsEmpty()) {
-    return;  // no need to check the other list if we cleared the timeout
+  uint32_t timerId = (uint32_t)aTimerId;
+
+  // Look the timeout up by id rather than walking the timeout lists, which
+  // can be very long; a page is free to call clearTimeout() with thousands
+  // of timeouts pending.
+  RefPtr<Timeout> timeout = mTimeoutsById.Get(TimeoutIdKey(timerId, aReason));
+  if (!timeout) {
+    return;
   }
-  ClearTimeoutInternal(aTimerId, aReason, true);
-}
+  MOZ_ASSERT(timeout->mTimeoutId == timerId && timeout->mReason == aReason);
 
-bool TimeoutManager::ClearTimeoutInternal(int32_t aTimerId,
-                                          Timeout::Reason aReason,
-                                          bool aIsIdle) {
-  uint32_t timerId = (uint32_t)aTimerId;
-  Timeouts& timeouts = aIsIdle ? mIdleTimeouts : mTimeouts;
-  RefPtr<TimeoutExecutor>& executor = aIsIdle ? mIdleExecutor : mExecutor;
-  bool firstTimeout = true;
-  bool deferredDeletion = false;
-  bool cleared = false;
-
-  timeouts.ForEachAbortable([&](Timeout* aTimeout) {
-    MOZ_LOG(gTimeoutLog, LogLevel::Debug,
-            ("Clear%s(TimeoutManager=%p, timeout=%p, aTimerId=%u, ID=%u)\n",
-             aTimeout->mIsInterval ? "Interval" : "Timeout", this, aTimeout,
-             timerId, aTimeout->mTimeoutId));
-
-    if (aTimeout->mTimeoutId == timerId && aTimeout->mReason == aReason) {
-      if (aTimeout->mRunning) {
-        /* We're running from inside the aTimeout. Mark this
-           aTimeout for deferred deletion by the code in
-           RunTimeout() */
-        aTimeout->mIsInterval = false;
-        deferredDeletion = true;
-      } else {
-        /* Delete the aTimeout from the pending aTimeout list */
-        aTimeout->remove();
-      }
-      cleared = true;
-      return true;  // abort!
-    }
+  MOZ_LOG(gTimeoutLog, LogLevel::Debug,
+          ("Clear%s(TimeoutManager=%p, timeout=%p, aTimerId=%u)\n",
+           timeout->mIsInterval ? "Interval" : "Timeout", this, timeout.get(),
+           timerId));
+
+  if (timeout->mRunning) {
+    // We're running from inside the timeout.  Mark this timeout for deferred
+    // deletion by the code in RunTimeout(), which will also drop the table
+    // entry and reschedule the executor as needed.
+    timeout->mIsInterval = false;
+    return;
+  }
 
-    firstTimeout = false;
+  // The timeout could be on either list; remember whether it was at the
+  // front of one of them before unlinking it.
+  bool firstTimeout = timeout == mTimeouts.GetFirst();
+  bool firstIdleTimeout = timeout == mIdleTimeouts.GetFirst();
 
-    return false;
-  });
+  timeout->remove();
+  mTimeoutsById.Remove(TimeoutIdKey(timerId, aReason));
 
   // We don't need to reschedule the executor if any of the following are true:
   //  * If the we weren't cancelling the first timeout, then the executor's
   //    state doesn't need to change.  It will only reflect the next soonest
   //    Timeout.
-  //  * If we did cancel the first Timeout, but its currently running, then
-  //    RunTimeout() will handle rescheduling the executor.
   //  * If the window has become suspended then we should not start executing
   //    Timeouts.
-  if (!firstTimeout || deferredDeletion || mWindow.IsSuspended()) {
-    return cleared;
+  if (mWindow.IsSuspended()) {
+    return;
   }
 
   // Stop the executor and restart it at the next soonest deadline.
-  executor->Cancel();
-
-  Timeout* nextTimeout = timeouts.GetFirst();
-  if (nextTimeout) {
-    if (aIsIdle) {
-      MOZ_ALWAYS_SUCCEEDS(
-          executor->MaybeSchedule(nextTimeout->When(), TimeDuration(0)));
-    } else {
+  if (firstTimeout) {
+    mExecutor->Cancel();
+    if (Timeout* nextTimeout = mTimeouts.GetFirst()) {
       MOZ_ALWAYS_SUCCEEDS(MaybeSchedule(nextTimeout->When()));
     }
+  } else if (firstIdleTimeout) {
+    mIdleExecutor->Cancel();
+    if (Timeout* nextTimeout = mIdleTimeouts.GetFirst()) {
+      MOZ_ALWAYS_SUCCEEDS(
+          mIdleExecutor->MaybeSchedule(nextTimeout->When(), TimeDuration(0)));
+    }
   }
-  return cleared;
 }
 
 void TimeoutManager::RunTimeout(const TimeStamp& aNow,
@@ -950,6 +937,8 @@ void TimeoutManager::RunTimeout(const TimeStamp& aNow,
           // initialized for this language.  This timer will never fire
           // so just remove it.
           timeout->remove();
+          mTimeoutsById.Remove(
+              TimeoutIdKey(timeout->mTimeoutId, timeout->mReason));
           continue;
         }
 
@@ -1031,6 +1020,10 @@ void TimeoutManager::RunTimeout(const TimeStamp& aNow,
           mTimeouts.Insert(timeout, mWindow.IsFrozen()
                                         ? Timeouts::SortBy::TimeRemaining
                                         : Timeouts::SortBy::TimeWhen);
+        } else {
+          // The timeout is gone for good; drop the id lookup entry.
+          mTimeoutsById.Remove(
+              TimeoutIdKey(timeout->mTimeoutId, timeout->mReason));
         }
       }
       // Check to see if we have run out of time to execute timeout handlers.
@@ -1146,6 +1139,7 @@ void TimeoutManager::ClearAllTimeouts() {
   // Clear out our lists
   mTimeouts.Clear();
   mIdleTimeouts.Clear();
+  mTimeoutsById.Clear();
 }
 
 void TimeoutManager::Timeouts::Insert(Timeout* aTimeout, SortBy aSortBy) {
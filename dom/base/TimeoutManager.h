@@ -8,6 +8,7 @@
 #define mozilla_dom_TimeoutManager_h__
 
 #include "mozilla/dom/Timeout.h"
+#include "nsDataHashtable.h"
 #include "nsTArray.h"
 
 class nsIEventTarget;
@@ -47,9 +48,6 @@ class TimeoutManager final {
                       bool aIsInterval, mozilla::dom::Timeout::Reason aReason,
                       int32_t* aReturn);
   void ClearTimeout(int32_t aTimerId, mozilla::dom::Timeout::Reason aReason);
-  bool ClearTimeoutInternal(int32_t aTimerId,
-                            mozilla::dom::Timeout::Reason aReason,
-                            bool aIsIdle);
 
   // The timeout implementation functions.
   MOZ_CAN_RUN_SCRIPT
@@ -140,6 +138,13 @@ class TimeoutManager final {
 
   mozilla::PerformanceCounter* GetPerformanceCounter();
 
+  // Timeout ids are drawn from a separate counter for each Reason, so the
+  // reason has to be part of the key used to look a Timeout up by id.
+  static uint64_t TimeoutIdKey(uint32_t aTimeoutId,
+                               mozilla::dom::Timeout::Reason aReason) {
+    return (static_cast<uint64_t>(aReason) << 32) | aTimeoutId;
+  }
+
  private:
   struct Timeouts {
     explicit Timeouts(const TimeoutManager& aManager) : mManager(aManager) {}
@@ -202,6 +207,11 @@ class TimeoutManager final {
   RefPtr<TimeoutExecutor> mIdleExecutor;
   // The list of timeouts coming from non-tracking scripts.
   Timeouts mTimeouts;
+  // Maps a timeout id (and reason; see TimeoutIdKey()) to the Timeout, so
+  // that ClearTimeout() doesn't have to walk the timeout lists.  Entries are
+  // weak and must be removed whenever a Timeout permanently leaves
+  // mTimeouts/mIdleTimeouts; moving between the two lists keeps the entry.
+  nsDataHashtable<nsUint64HashKey, Timeout*> mTimeoutsById;
   uint32_t mTimeoutIdCounter;
   uint32_t mNextFiringId;
 #ifdef DEBUG
@@ -872,6 +872,19 @@ void nsCacheableFuncStringContentList::RemoveFromFuncStringHashtable() {
   }
 }
 
+void nsCacheableFuncStringContentList::AttributeChanged(
+    Element* aElement, int32_t aNameSpaceID, nsAtom* aAttribute,
+    int32_t aModType, const nsAttrValue* aOldValue) {
+  // If the match function only inspects one attribute, changes to any other
+  // attribute cannot affect our membership, so no need to rebuild the list.
+  if (mAttrFilter && aAttribute != mAttrFilter) {
+    return;
+  }
+
+  nsContentList::AttributeChanged(aElement, aNameSpaceID, aAttribute, aModType,
+                                  aOldValue);
+}
+
 #ifdef DEBUG_CONTENT_LIST
 void nsContentList::AssertInSync() {
   if (mState == LIST_DIRTY) {
@@ -931,19 +944,6 @@ JSObject* nsCachableElementsByNameNodeList::WrapObject(
   return NodeList_Binding::Wrap(cx, this, aGivenProto);
 }
 
-void nsCachableElementsByNameNodeList::AttributeChanged(
-    Element* aElement, int32_t aNameSpaceID, nsAtom* aAttribute,
-    int32_t aModType, const nsAttrValue* aOldValue) {
-  // No need to rebuild the list if the changed attribute is not the name
-  // attribute.
-  if (aAttribute != nsGkAtoms::name) {
-    return;
-  }
-
-  nsCacheableFuncStringContentList::AttributeChanged(
-      aElement, aNameSpaceID, aAttribute, aModType, aOldValue);
-}
-
 //-----------------------------------------------------
 // nsCacheableFuncStringHTMLCollection
 
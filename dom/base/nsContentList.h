@@ -22,6 +22,7 @@
 #include "nsINodeList.h"
 #include "nsStubMutationObserver.h"
 #include "nsAtom.h"
+#include "nsGkAtoms.h"
 #include "nsCycleCollectionParticipant.h"
 #include "nsNameSpaceManager.h"
 #include "nsWrapperCache.h"
@@ -519,16 +520,22 @@ class nsCacheableFuncStringContentList : public nsContentList {
   ContentListType mType;
 #endif
 
+  NS_DECL_NSIMUTATIONOBSERVER_ATTRIBUTECHANGED
+
  protected:
+  // aAttrFilter, if non-null, names the only attribute the match function
+  // inspects, so that changes to other attributes don't dirty the list.
   nsCacheableFuncStringContentList(
       nsINode* aRootNode, nsContentListMatchFunc aFunc,
       nsContentListDestroyFunc aDestroyFunc,
       nsFuncStringContentListDataAllocator aDataAllocator,
-      const nsAString& aString, mozilla::DebugOnly<ContentListType> aType)
+      const nsAString& aString, nsAtom* aAttrFilter,
+      mozilla::DebugOnly<ContentListType> aType)
       : nsContentList(aRootNode, aFunc, aDestroyFunc, nullptr),
 #ifdef DEBUG
         mType(aType),
 #endif
+        mAttrFilter(aAttrFilter),
         mString(aString) {
     mData = (*aDataAllocator)(aRootNode, &mString);
     MOZ_ASSERT(mData);
@@ -537,6 +544,7 @@ class nsCacheableFuncStringContentList : public nsContentList {
   virtual void RemoveFromCaches() override { RemoveFromFuncStringHashtable(); }
   void RemoveFromFuncStringHashtable();
 
+  RefPtr<nsAtom> mAttrFilter;
   nsString mString;
 };
 
@@ -549,9 +557,8 @@ class nsCachableElementsByNameNodeList
       nsFuncStringContentListDataAllocator aDataAllocator,
       const nsAString& aString)
       : nsCacheableFuncStringContentList(aRootNode, aFunc, aDestroyFunc,
-                                         aDataAllocator, aString, eNodeList) {}
-
-  NS_DECL_NSIMUTATIONOBSERVER_ATTRIBUTECHANGED
+                                         aDataAllocator, aString,
+                                         nsGkAtoms::name, eNodeList) {}
 
   virtual JSObject* WrapObject(JSContext* cx,
                                JS::Handle<JSObject*> aGivenProto) override;
@@ -569,8 +576,12 @@ class nsCacheableFuncStringHTMLCollection
       nsContentListDestroyFunc aDestroyFunc,
       nsFuncStringContentListDataAllocator aDataAllocator,
       const nsAString& aString)
+      // This collection is only ever created for getElementsByClassName
+      // (see nsContentUtils::GetElementsByClassName), whose match function
+      // looks at nothing but the class attribute.
       : nsCacheableFuncStringContentList(aRootNode, aFunc, aDestroyFunc,
                                          aDataAllocator, aString,
+                                         nsGkAtoms::_class,
                                          eHTMLCollection) {}
 
   virtual JSObject* WrapObject(JSContext* cx,
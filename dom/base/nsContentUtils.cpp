@@ -202,6 +202,7 @@
 #include "nsIXPConnect.h"
 #include "nsJSUtils.h"
 #include "nsMappedAttributes.h"
+#include "nsMimeTypes.h"
 #include "nsNetCID.h"
 #include "nsNetUtil.h"
 #include "nsNodeInfoManager.h"
@@ -4845,8 +4846,8 @@ nsresult nsContentUtils::SetNodeTextContent(nsIContent* aContent,
     return NS_OK;
   }
 
-  RefPtr<nsTextNode> textContent =
-      new nsTextNode(aContent->NodeInfo()->NodeInfoManager());
+  nsNodeInfoManager* nim = aContent->NodeInfo()->NodeInfoManager();
+  RefPtr<nsTextNode> textContent = new (nim) nsTextNode(nim);
 
   textContent->SetText(aValue, true);
 
@@ -6290,6 +6291,28 @@ nsContentUtils::FindInternalContentViewer(const nsACString& aType,
     *aLoaderType = TYPE_UNSUPPORTED;
   }
 
+  // The types below are statically registered to the content document
+  // loader factory, and this function runs more than once per navigation
+  // (the type-support checks in nsDSURIContentListener and then viewer
+  // creation in nsDocShell), so go straight to the factory for them
+  // instead of taking the category manager detour. The only way the
+  // category entries for these types can differ from the static
+  // registration is a plugin registered with
+  // plugin.override_internal_types, in which case we fall through to the
+  // lookup.
+  if ((aType.EqualsLiteral(TEXT_HTML) ||
+       aType.EqualsLiteral(APPLICATION_XHTML_XML) ||
+       aType.EqualsLiteral(TEXT_XML) || aType.EqualsLiteral(APPLICATION_XML) ||
+       aType.EqualsLiteral(IMAGE_SVG_XML) || IsPlainTextType(aType)) &&
+      !Preferences::GetBool("plugin.override_internal_types", false)) {
+    nsCOMPtr<nsIDocumentLoaderFactory> docFactory =
+        do_GetService(CONTENT_DLF_CONTRACTID);
+    if (docFactory && aLoaderType) {
+      *aLoaderType = TYPE_CONTENT;
+    }
+    return docFactory.forget();
+  }
+
   // one helper factory, please
   nsCOMPtr<nsICategoryManager> catMan(
       do_GetService(NS_CATEGORYMANAGER_CONTRACTID));
@@ -7152,6 +7175,21 @@ nsresult nsContentUtils::IPCTransferableToTransferable(
         NS_ENSURE_SUCCESS(rv, rv);
 
         aTransferable->SetTransferData(item.flavor().get(), imageContainer);
+      } else if (item.shmemIsUTF16()) {
+        // A large string sent out-of-line.
+        nsCOMPtr<nsISupportsString> dataWrapper =
+            do_CreateInstance(NS_SUPPORTS_STRING_CONTRACTID, &rv);
+        NS_ENSURE_SUCCESS(rv, rv);
+
+        Shmem itemData = item.data().get_Shmem();
+        const nsDependentSubstring text(itemData.get<char16_t>(),
+                                        itemData.Size<char16_t>());
+        rv = dataWrapper->SetData(text);
+        NS_ENSURE_SUCCESS(rv, rv);
+
+        rv = aTransferable->SetTransferData(item.flavor().get(), dataWrapper);
+
+        NS_ENSURE_SUCCESS(rv, rv);
       } else {
         nsCOMPtr<nsISupportsCString> dataWrapper =
             do_CreateInstance(NS_SUPPORTS_CSTRING_CONTRACTID, &rv);
@@ -7337,6 +7375,32 @@ static Shmem ConvertToShmem(mozilla::dom::ContentChild* aChild,
   return result;
 }
 
+static Shmem ConvertToShmem(mozilla::dom::ContentChild* aChild,
+                            mozilla::dom::ContentParent* aParent,
+                            const nsAString& aInput) {
+  MOZ_ASSERT((aChild && !aParent) || (!aChild && aParent));
+
+  IShmemAllocator* allocator = aChild ? static_cast<IShmemAllocator*>(aChild)
+                                      : static_cast<IShmemAllocator*>(aParent);
+
+  Shmem result;
+  if (!allocator->AllocShmem(aInput.Length() * sizeof(char16_t),
+                             SharedMemory::TYPE_BASIC, &result)) {
+    return result;
+  }
+
+  memcpy(result.get<char16_t>(), aInput.BeginReading(),
+         aInput.Length() * sizeof(char16_t));
+
+  return result;
+}
+
+// Strings shorter than this are sent inline in the IPC message; longer ones
+// go out-of-line in shared memory. Inline data is copied again every time the
+// message is moved, and a sufficiently large copied selection could otherwise
+// exceed the IPC message size limit altogether.
+static const uint32_t kShmemStringThreshold = 64 * 1024;
+
 void nsContentUtils::TransferableToIPCTransferable(
     nsITransferable* aTransferable, IPCDataTransfer* aIPCDataTransfer,
     bool aInSyncMessage, mozilla::dom::ContentChild* aChild,
@@ -7384,6 +7448,21 @@ void nsContentUtils::TransferableToIPCTransferable(
       if (nsCOMPtr<nsISupportsString> text = do_QueryInterface(data)) {
         nsAutoString dataAsString;
         text->GetData(dataAsString);
+
+        if (dataAsString.Length() >= kShmemStringThreshold) {
+          Shmem dataAsShmem = ConvertToShmem(aChild, aParent, dataAsString);
+          if (dataAsShmem.IsReadable() && dataAsShmem.Size<char>()) {
+            IPCDataTransferItem* item =
+                aIPCDataTransfer->items().AppendElement();
+            item->flavor() = flavorStr;
+            item->data() = std::move(dataAsShmem);
+            item->shmemIsUTF16() = true;
+            continue;
+          }
+          // If the shmem allocation failed, fall through and send the data
+          // inline.
+        }
+
         IPCDataTransferItem* item = aIPCDataTransfer->items().AppendElement();
         item->flavor() = flavorStr;
         item->data() = dataAsString;
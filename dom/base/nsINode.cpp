@@ -22,11 +22,13 @@
 #include "mozilla/HTMLEditor.h"
 #include "mozilla/InternalMutationEvent.h"
 #include "mozilla/Likely.h"
+#include "mozilla/Maybe.h"
 #include "mozilla/MemoryReporting.h"
 #include "mozilla/PresShell.h"
 #include "mozilla/ServoBindings.h"
 #include "mozilla/Telemetry.h"
 #include "mozilla/TextEditor.h"
+#include "mozilla/TextUtils.h"
 #include "mozilla/TimeStamp.h"
 #include "mozilla/dom/BindContext.h"
 #include "mozilla/dom/CharacterData.h"
@@ -2552,11 +2554,116 @@ inline static Element* FindMatchingElementWithId(
   return nullptr;
 }
 
+// Whether a selector token is a CSS identifier that needs no unescaping: an
+// optional leading '-', then an ASCII letter, '_' or a non-ASCII character,
+// followed by ASCII letters, digits, '-', '_' or non-ASCII characters.
+static bool IsTrivialIdent(const char16_t* aCur, const char16_t* aEnd) {
+  if (aCur != aEnd && *aCur == '-') {
+    ++aCur;
+  }
+  if (aCur == aEnd ||
+      !(IsAsciiAlpha(*aCur) || *aCur == '_' || *aCur >= 0x80)) {
+    return false;
+  }
+  while (++aCur != aEnd) {
+    char16_t c = *aCur;
+    if (!(IsAsciiAlphanumeric(c) || c == '-' || c == '_' || c >= 0x80)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Fast path for the trivial selectors "#id", ".class" and "tag", which make
+// up the bulk of the querySelector calls some frameworks issue.  These can be
+// answered from the id hashtable or with a cheap atom compare during a tree
+// walk, without running the full selector-matching machinery per element.
+// Returns Nothing() when aSelector is not such a selector or when it can't be
+// matched exactly here, in which case the caller takes the regular path.
+static Maybe<Element*> TryQuerySelectorTrivial(nsINode& aRoot,
+                                               const nsAString& aSelector) {
+  if (aSelector.IsEmpty()) {
+    // Invalid selector; let the real parser generate the exception.
+    return Nothing();
+  }
+
+  const char16_t* start = aSelector.BeginReading();
+  const char16_t* end = aSelector.EndReading();
+  const bool isId = *start == '#';
+  const bool isClass = *start == '.';
+  if (!IsTrivialIdent(start + (isId || isClass ? 1 : 0), end)) {
+    return Nothing();
+  }
+
+  Document* doc = aRoot.OwnerDoc();
+  if ((isId || isClass) &&
+      doc->GetCompatibilityMode() == eCompatibility_NavQuirks) {
+    // Id and class selectors are ASCII case-insensitive in quirks mode, but
+    // the hashtable and attribute lookups below are case-sensitive.
+    return Nothing();
+  }
+
+  if (isId) {
+    const nsDependentSubstring id = Substring(aSelector, 1);
+    if (aRoot.IsDocument()) {
+      return Some(aRoot.AsDocument()->GetElementById(id));
+    }
+    if (ShadowRoot* shadowRoot = ShadowRoot::FromNode(aRoot)) {
+      return Some(shadowRoot->GetElementById(id));
+    }
+    return Some(aRoot.GetElementById(id));
+  }
+
+  if (isClass) {
+    RefPtr<nsAtom> atom = NS_Atomize(Substring(aSelector, 1));
+    for (nsIContent* cur = aRoot.GetFirstChild(); cur;
+         cur = cur->GetNextNode(&aRoot)) {
+      if (!cur->IsElement()) {
+        continue;
+      }
+      const nsAttrValue* classes = cur->AsElement()->GetClasses();
+      if (classes && classes->Contains(atom, eCaseMatters)) {
+        return Some(cur->AsElement());
+      }
+    }
+    return Some(static_cast<Element*>(nullptr));
+  }
+
+  // Type selector.  Match the way the selector machinery does: elements in
+  // the HTML namespace in an HTML document match the lowercased name, and
+  // everything else matches the name as written.
+  RefPtr<nsAtom> atom = NS_Atomize(aSelector);
+  RefPtr<nsAtom> lowerAtom = atom;
+  if (doc->IsHTMLDocument()) {
+    nsAutoString lower;
+    nsContentUtils::ASCIIToLower(aSelector, lower);
+    if (lower != aSelector) {
+      lowerAtom = NS_Atomize(lower);
+    }
+  }
+  for (nsIContent* cur = aRoot.GetFirstChild(); cur;
+       cur = cur->GetNextNode(&aRoot)) {
+    if (!cur->IsElement()) {
+      continue;
+    }
+    nsAtom* name = cur->NodeInfo()->NameAtom();
+    if (name == (cur->IsHTMLElement() && doc->IsHTMLDocument() ? lowerAtom
+                                                               : atom)) {
+      return Some(cur->AsElement());
+    }
+  }
+  return Some(static_cast<Element*>(nullptr));
+}
+
 Element* nsINode::QuerySelector(const nsAString& aSelector,
                                 ErrorResult& aResult) {
   AUTO_PROFILER_LABEL_DYNAMIC_LOSSY_NSSTRING("nsINode::QuerySelector",
                                              LAYOUT_SelectorQuery, aSelector);
 
+  if (Maybe<Element*> result = TryQuerySelectorTrivial(*this, aSelector)) {
+    return result.value();
+  }
+
   const RawServoSelectorList* list = ParseSelectorList(aSelector, aResult);
   if (!list) {
     return nullptr;
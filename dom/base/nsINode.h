@@ -346,12 +346,16 @@ class nsINode : public mozilla::dom::EventTarget {
   virtual void AddSizeOfExcludingThis(nsWindowSizes& aSizes,
                                       size_t* aNodeSize) const;
 
-  // SizeOfIncludingThis doesn't need to be overridden by sub-classes because
-  // sub-classes of nsINode are guaranteed to be laid out in memory in such a
+  // Sub-classes of nsINode are guaranteed to be laid out in memory in such a
   // way that |this| points to the start of the allocated object, even in
-  // methods of nsINode's sub-classes, so aSizes.mState.mMallocSizeOf(this) is
-  // always safe to call no matter which object it was invoked on.
-  void AddSizeOfIncludingThis(nsWindowSizes& aSizes, size_t* aNodeSize) const;
+  // methods of nsINode's sub-classes, so for heap-allocated nodes the default
+  // implementation can simply call aSizes.mState.mMallocSizeOf(this).
+  // Sub-classes that are allocated out of a DOMArena instead of the heap
+  // (currently nsTextNode) must override this so that malloc isn't handed a
+  // pointer it doesn't own; their memory is measured by
+  // nsNodeInfoManager::AddSizeOfIncludingThis instead.
+  virtual void AddSizeOfIncludingThis(nsWindowSizes& aSizes,
+                                      size_t* aNodeSize) const;
 
   friend class nsNodeUtils;
   friend class nsNodeWeakReference;
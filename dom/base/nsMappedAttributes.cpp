@@ -281,3 +281,13 @@ void nsMappedAttributes::LazilyResolveServoDeclaration(dom::Document* aDoc) {
     mServoStyle = declarations.TakeDeclarationBlock();
   }
 }
+
+void nsMappedAttributes::ClearServoStyle() {
+  MOZ_ASSERT(NS_IsMainThread());
+  mServoStyle = nullptr;
+  if (mSheet) {
+    // Re-dirty the table so that the pre-traversal resolution pass picks this
+    // set up again; it only rescans when the sheet is marked dirty.
+    mSheet->SetMappedAttrsDirty();
+  }
+}
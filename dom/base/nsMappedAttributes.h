@@ -75,10 +75,7 @@ class nsMappedAttributes final {
     return mServoStyle;
   }
 
-  void ClearServoStyle() {
-    MOZ_ASSERT(NS_IsMainThread());
-    mServoStyle = nullptr;
-  }
+  void ClearServoStyle();
 
   size_t SizeOfIncludingThis(mozilla::MallocSizeOf aMallocSizeOf) const;
 
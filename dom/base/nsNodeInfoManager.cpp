@@ -12,6 +12,7 @@
 
 #include "mozilla/DebugOnly.h"
 #include "mozilla/dom/Document.h"
+#include "mozilla/dom/DOMArena.h"
 #include "mozilla/dom/NodeInfo.h"
 #include "mozilla/dom/NodeInfoInlines.h"
 #include "mozilla/NullPrincipal.h"
@@ -318,6 +319,13 @@ void nsNodeInfoManager::RemoveNodeInfo(NodeInfo* aNodeInfo) {
   MOZ_ASSERT(ret, "Can't find mozilla::dom::NodeInfo to remove!!!");
 }
 
+void* nsNodeInfoManager::Allocate(size_t aSize) {
+  if (!mArena) {
+    mArena = new mozilla::dom::DOMArena();
+  }
+  return mArena->AllocateObject(aSize);
+}
+
 bool nsNodeInfoManager::InternalSVGEnabled() {
   // If the svg.disabled pref. is true, convert all SVG nodes into
   // disabled SVG nodes by swapping the namespace.
@@ -365,6 +373,14 @@ void nsNodeInfoManager::AddSizeOfIncludingThis(nsWindowSizes& aSizes) const {
         mBindingManager->SizeOfIncludingThis(aSizes.mState.mMallocSizeOf);
   }
 
+  if (mArena) {
+    // Nodes allocated out of the arena don't report a self size of their own
+    // (see nsTextNode::AddSizeOfIncludingThis), so account for the arena's
+    // chunks here.  Only text nodes are allocated this way at the moment.
+    aSizes.mDOMTextNodesSize +=
+        mArena->SizeOfExcludingThis(aSizes.mState.mMallocSizeOf);
+  }
+
   // Measurement of the following members may be added later if DMD finds it
   // is worthwhile:
   // - mNodeInfoHash
@@ -29,7 +29,8 @@ struct already_AddRefed;
 namespace mozilla {
 namespace dom {
 class Document;
-}
+class DOMArena;
+}  // namespace dom
 }  // namespace mozilla
 
 class nsNodeInfoManager final {
@@ -122,6 +123,13 @@ class nsNodeInfoManager final {
 
   void AddSizeOfIncludingThis(nsWindowSizes& aSizes) const;
 
+  /**
+   * Allocate memory for a DOM node out of this document's arena, creating
+   * the arena on first use.  Memory allocated here must be freed with
+   * mozilla::dom::DOMArena::FreeObject.
+   */
+  void* Allocate(size_t aSize);
+
  protected:
   friend class mozilla::dom::Document;
   friend class nsXULPrototypeDocument;
@@ -171,6 +179,7 @@ class nsNodeInfoManager final {
       mDocumentNodeInfo;  // WEAK to avoid circular ownership
   RefPtr<nsBindingManager> mBindingManager;
   NodeInfoCache mRecentlyUsedNodeInfos;
+  RefPtr<mozilla::dom::DOMArena> mArena;
   Tri mSVGEnabled;
   Tri mMathMLEnabled;
 };
@@ -13,6 +13,7 @@
 #include "nsContentUtils.h"
 #include "mozilla/dom/DirectionalityUtils.h"
 #include "mozilla/dom/Document.h"
+#include "mozilla/dom/DOMArena.h"
 #include "nsIDOMEventListener.h"
 #include "nsThreadUtils.h"
 #include "nsStubMutationObserver.h"
@@ -50,8 +51,8 @@ class nsAttributeTextNode final : public nsTextNode,
 
   virtual already_AddRefed<CharacterData> CloneDataNode(
       mozilla::dom::NodeInfo* aNodeInfo, bool aCloneText) const override {
-    RefPtr<nsAttributeTextNode> it =
-        new nsAttributeTextNode(do_AddRef(aNodeInfo), mNameSpaceID, mAttrName);
+    RefPtr<nsAttributeTextNode> it = new (aNodeInfo->NodeInfoManager())
+        nsAttributeTextNode(do_AddRef(aNodeInfo), mNameSpaceID, mAttrName);
     if (aCloneText) {
       it->mText = mText;
     }
@@ -82,6 +83,23 @@ class nsAttributeTextNode final : public nsTextNode,
 
 nsTextNode::~nsTextNode() {}
 
+void* nsTextNode::operator new(size_t aSize, nsNodeInfoManager* aManager) {
+  MOZ_ASSERT(aManager, "Must have a node info manager to allocate from");
+  return aManager->Allocate(aSize);
+}
+
+void nsTextNode::operator delete(void* aPtr, size_t aSize) {
+  DOMArena::FreeObject(aPtr, aSize);
+}
+
+void nsTextNode::AddSizeOfIncludingThis(nsWindowSizes& aSizes,
+                                        size_t* aNodeSize) const {
+  // We were allocated out of our document's DOMArena, not the heap, so we
+  // must not hand |this| to malloc to be measured.  The arena's chunks are
+  // measured by nsNodeInfoManager::AddSizeOfIncludingThis instead.
+  AddSizeOfExcludingThis(aSizes, aNodeSize);
+}
+
 // Use the CC variant of this, even though this class does not define
 // a new CC participant, to make QIing to the CC interfaces faster.
 NS_IMPL_ISUPPORTS_CYCLE_COLLECTION_INHERITED_0(nsTextNode, CharacterData)
@@ -95,7 +113,8 @@ bool nsTextNode::IsNodeOfType(uint32_t aFlags) const { return false; }
 
 already_AddRefed<CharacterData> nsTextNode::CloneDataNode(
     mozilla::dom::NodeInfo* aNodeInfo, bool aCloneText) const {
-  RefPtr<nsTextNode> it = new nsTextNode(do_AddRef(aNodeInfo));
+  RefPtr<nsTextNode> it =
+      new (aNodeInfo->NodeInfoManager()) nsTextNode(do_AddRef(aNodeInfo));
   if (aCloneText) {
     it->mText = mText;
   }
@@ -182,8 +201,8 @@ nsresult NS_NewAttributeContent(nsNodeInfoManager* aNodeInfoManager,
 
   RefPtr<mozilla::dom::NodeInfo> ni = aNodeInfoManager->GetTextNodeInfo();
 
-  RefPtr<nsAttributeTextNode> textNode =
-      new nsAttributeTextNode(ni.forget(), aNameSpaceID, aAttrName);
+  RefPtr<nsAttributeTextNode> textNode = new (aNodeInfoManager)
+      nsAttributeTextNode(ni.forget(), aNameSpaceID, aAttrName);
   textNode.forget(aResult);
 
   return NS_OK;
@@ -37,12 +37,21 @@ class nsTextNode : public mozilla::dom::Text {
     Init();
   }
 
+  // Text nodes are created and destroyed in bulk with their document, so
+  // they are allocated out of the document's DOM arena rather than the
+  // heap; see nsNodeInfoManager::Allocate.
+  void* operator new(size_t aSize, nsNodeInfoManager* aManager);
+  void operator delete(void* aPtr, size_t aSize);
+
   // nsISupports
   NS_DECL_ISUPPORTS_INHERITED
 
   // nsINode
   virtual bool IsNodeOfType(uint32_t aFlags) const override;
 
+  virtual void AddSizeOfIncludingThis(nsWindowSizes& aSizes,
+                                      size_t* aNodeSize) const override;
+
   virtual already_AddRefed<CharacterData> CloneDataNode(
       mozilla::dom::NodeInfo* aNodeInfo, bool aCloneText) const override;
 
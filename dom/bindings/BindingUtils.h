@@ -875,6 +875,18 @@ bool MaybeWrapStringValue(JSContext* cx, JS::MutableHandle<JS::Value> rval) {
   return true;
 }
 
+// Make sure to wrap the given BigInt value into the right compartment, as
+// needed.
+MOZ_ALWAYS_INLINE
+bool MaybeWrapBigIntValue(JSContext* cx, JS::MutableHandle<JS::Value> rval) {
+  MOZ_ASSERT(rval.isBigInt());
+  JS::BigInt* bi = rval.toBigInt();
+  if (JS::GetBigIntZone(bi) != js::GetContextZone(cx)) {
+    return JS_WrapValue(cx, rval);
+  }
+  return true;
+}
+
 // Make sure to wrap the given object value into the right compartment as
 // needed.  This will work correctly, but possibly slowly, on all objects.
 MOZ_ALWAYS_INLINE
@@ -967,12 +979,8 @@ MOZ_ALWAYS_INLINE bool MaybeWrapValue(JSContext* cx,
     if (rval.isObject()) {
       return MaybeWrapObjectValue(cx, rval);
     }
-    // This could be optimized by checking the zone first, similar to
-    // the way strings are handled. At present, this is used primarily
-    // for structured cloning, so avoiding the overhead of JS_WrapValue
-    // calls is less important than for other types.
     if (rval.isBigInt()) {
-      return JS_WrapValue(cx, rval);
+      return MaybeWrapBigIntValue(cx, rval);
     }
     MOZ_ASSERT(rval.isSymbol());
     JS_MarkCrossZoneId(cx, SYMBOL_TO_JSID(rval.toSymbol()));
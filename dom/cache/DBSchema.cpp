@@ -375,10 +375,24 @@ static nsresult InsertEntry(mozIStorageConnection* aConn, CacheId aCacheId,
                             const nsID* aRequestBodyId,
                             const CacheResponse& aResponse,
                             const nsID* aResponseBodyId);
+static nsresult PrepareResponseStatements(
+    mozIStorageConnection* aConn, mozIStorageStatement** aEntryStateOut,
+    mozIStorageStatement** aHeadersStateOut,
+    mozIStorageStatement** aUrlListStateOut);
+static nsresult ReadResponse(mozIStorageConnection* aConn,
+                             mozIStorageStatement* aEntryState,
+                             mozIStorageStatement* aHeadersState,
+                             mozIStorageStatement* aUrlListState,
+                             EntryId aEntryId,
+                             SavedResponse* aSavedResponseOut);
 static nsresult ReadResponse(mozIStorageConnection* aConn, EntryId aEntryId,
                              SavedResponse* aSavedResponseOut);
-static nsresult ReadRequest(mozIStorageConnection* aConn, EntryId aEntryId,
-                            SavedRequest* aSavedRequestOut);
+static nsresult PrepareRequestStatements(
+    mozIStorageConnection* aConn, mozIStorageStatement** aEntryStateOut,
+    mozIStorageStatement** aHeadersStateOut);
+static nsresult ReadRequest(mozIStorageStatement* aEntryState,
+                            mozIStorageStatement* aHeadersState,
+                            EntryId aEntryId, SavedRequest* aSavedRequestOut);
 
 static void AppendListParamsToQuery(nsACString& aQuery,
                                     const nsTArray<EntryId>& aEntryIdList,
@@ -936,10 +950,27 @@ nsresult CacheMatchAll(mozIStorageConnection* aConn, CacheId aCacheId,
     }
   }
 
+  if (matches.IsEmpty()) {
+    return rv;
+  }
+
   // TODO: replace this with a bulk load using SQL IN clause (bug 1110458)
+  // Until then, at least prepare the statements once up front instead of
+  // re-compiling three queries for every matched entry.
+  nsCOMPtr<mozIStorageStatement> entryState;
+  nsCOMPtr<mozIStorageStatement> headersState;
+  nsCOMPtr<mozIStorageStatement> urlListState;
+  rv = PrepareResponseStatements(aConn, getter_AddRefs(entryState),
+                                 getter_AddRefs(headersState),
+                                 getter_AddRefs(urlListState));
+  if (NS_WARN_IF(NS_FAILED(rv))) {
+    return rv;
+  }
+
   for (uint32_t i = 0; i < matches.Length(); ++i) {
     SavedResponse savedResponse;
-    rv = ReadResponse(aConn, matches[i], &savedResponse);
+    rv = ReadResponse(aConn, entryState, headersState, urlListState,
+                      matches[i], &savedResponse);
     if (NS_WARN_IF(NS_FAILED(rv))) {
       return rv;
     }
@@ -1055,10 +1086,24 @@ nsresult CacheKeys(mozIStorageConnection* aConn, CacheId aCacheId,
     }
   }
 
+  if (matches.IsEmpty()) {
+    return rv;
+  }
+
   // TODO: replace this with a bulk load using SQL IN clause (bug 1110458)
+  // Until then, at least prepare the statements once up front instead of
+  // re-compiling two queries for every matched entry.
+  nsCOMPtr<mozIStorageStatement> entryState;
+  nsCOMPtr<mozIStorageStatement> headersState;
+  rv = PrepareRequestStatements(aConn, getter_AddRefs(entryState),
+                                getter_AddRefs(headersState));
+  if (NS_WARN_IF(NS_FAILED(rv))) {
+    return rv;
+  }
+
   for (uint32_t i = 0; i < matches.Length(); ++i) {
     SavedRequest savedRequest;
-    rv = ReadRequest(aConn, matches[i], &savedRequest);
+    rv = ReadRequest(entryState, headersState, matches[i], &savedRequest);
     if (NS_WARN_IF(NS_FAILED(rv))) {
       return rv;
     }
@@ -2384,13 +2429,16 @@ nsresult InsertEntry(mozIStorageConnection* aConn, CacheId aCacheId,
   return rv;
 }
 
-nsresult ReadResponse(mozIStorageConnection* aConn, EntryId aEntryId,
-                      SavedResponse* aSavedResponseOut) {
+nsresult PrepareResponseStatements(mozIStorageConnection* aConn,
+                                   mozIStorageStatement** aEntryStateOut,
+                                   mozIStorageStatement** aHeadersStateOut,
+                                   mozIStorageStatement** aUrlListStateOut) {
   MOZ_ASSERT(!NS_IsMainThread());
   MOZ_DIAGNOSTIC_ASSERT(aConn);
-  MOZ_DIAGNOSTIC_ASSERT(aSavedResponseOut);
+  MOZ_DIAGNOSTIC_ASSERT(aEntryStateOut);
+  MOZ_DIAGNOSTIC_ASSERT(aHeadersStateOut);
+  MOZ_DIAGNOSTIC_ASSERT(aUrlListStateOut);
 
-  nsCOMPtr<mozIStorageStatement> state;
   nsresult rv = aConn->CreateStatement(
       NS_LITERAL_CSTRING(
           "SELECT "
@@ -2406,12 +2454,49 @@ nsresult ReadResponse(mozIStorageConnection* aConn, EntryId aEntryId,
           "LEFT OUTER JOIN security_info "
           "ON entries.response_security_info_id=security_info.id "
           "WHERE entries.id=:id;"),
-      getter_AddRefs(state));
+      aEntryStateOut);
+  if (NS_WARN_IF(NS_FAILED(rv))) {
+    return rv;
+  }
+
+  rv = aConn->CreateStatement(NS_LITERAL_CSTRING("SELECT "
+                                                 "name, "
+                                                 "value "
+                                                 "FROM response_headers "
+                                                 "WHERE entry_id=:entry_id;"),
+                              aHeadersStateOut);
+  if (NS_WARN_IF(NS_FAILED(rv))) {
+    return rv;
+  }
+
+  rv = aConn->CreateStatement(NS_LITERAL_CSTRING("SELECT "
+                                                 "url "
+                                                 "FROM response_url_list "
+                                                 "WHERE entry_id=:entry_id;"),
+                              aUrlListStateOut);
   if (NS_WARN_IF(NS_FAILED(rv))) {
     return rv;
   }
 
-  rv = state->BindInt32ByName(NS_LITERAL_CSTRING("id"), aEntryId);
+  return rv;
+}
+
+nsresult ReadResponse(mozIStorageConnection* aConn,
+                      mozIStorageStatement* aEntryState,
+                      mozIStorageStatement* aHeadersState,
+                      mozIStorageStatement* aUrlListState, EntryId aEntryId,
+                      SavedResponse* aSavedResponseOut) {
+  MOZ_ASSERT(!NS_IsMainThread());
+  MOZ_DIAGNOSTIC_ASSERT(aConn);
+  MOZ_DIAGNOSTIC_ASSERT(aEntryState);
+  MOZ_DIAGNOSTIC_ASSERT(aHeadersState);
+  MOZ_DIAGNOSTIC_ASSERT(aUrlListState);
+  MOZ_DIAGNOSTIC_ASSERT(aSavedResponseOut);
+
+  mozIStorageStatement* state = aEntryState;
+  mozStorageStatementScoper entryScoper(aEntryState);
+
+  nsresult rv = state->BindInt32ByName(NS_LITERAL_CSTRING("id"), aEntryId);
   if (NS_WARN_IF(NS_FAILED(rv))) {
     return rv;
   }
@@ -2558,15 +2643,8 @@ nsresult ReadResponse(mozIStorageConnection* aConn, EntryId aEntryId,
   }
 #endif  // NIGHTLY_BUILD
 
-  rv = aConn->CreateStatement(NS_LITERAL_CSTRING("SELECT "
-                                                 "name, "
-                                                 "value "
-                                                 "FROM response_headers "
-                                                 "WHERE entry_id=:entry_id;"),
-                              getter_AddRefs(state));
-  if (NS_WARN_IF(NS_FAILED(rv))) {
-    return rv;
-  }
+  state = aHeadersState;
+  mozStorageStatementScoper headersScoper(aHeadersState);
 
   rv = state->BindInt32ByName(NS_LITERAL_CSTRING("entry_id"), aEntryId);
   if (NS_WARN_IF(NS_FAILED(rv))) {
@@ -2589,14 +2667,8 @@ nsresult ReadResponse(mozIStorageConnection* aConn, EntryId aEntryId,
     aSavedResponseOut->mValue.headers().AppendElement(header);
   }
 
-  rv = aConn->CreateStatement(NS_LITERAL_CSTRING("SELECT "
-                                                 "url "
-                                                 "FROM response_url_list "
-                                                 "WHERE entry_id=:entry_id;"),
-                              getter_AddRefs(state));
-  if (NS_WARN_IF(NS_FAILED(rv))) {
-    return rv;
-  }
+  state = aUrlListState;
+  mozStorageStatementScoper urlListScoper(aUrlListState);
 
   rv = state->BindInt32ByName(NS_LITERAL_CSTRING("entry_id"), aEntryId);
   if (NS_WARN_IF(NS_FAILED(rv))) {
@@ -2617,12 +2689,30 @@ nsresult ReadResponse(mozIStorageConnection* aConn, EntryId aEntryId,
   return rv;
 }
 
-nsresult ReadRequest(mozIStorageConnection* aConn, EntryId aEntryId,
-                     SavedRequest* aSavedRequestOut) {
+nsresult ReadResponse(mozIStorageConnection* aConn, EntryId aEntryId,
+                      SavedResponse* aSavedResponseOut) {
+  nsCOMPtr<mozIStorageStatement> entryState;
+  nsCOMPtr<mozIStorageStatement> headersState;
+  nsCOMPtr<mozIStorageStatement> urlListState;
+  nsresult rv = PrepareResponseStatements(aConn, getter_AddRefs(entryState),
+                                          getter_AddRefs(headersState),
+                                          getter_AddRefs(urlListState));
+  if (NS_WARN_IF(NS_FAILED(rv))) {
+    return rv;
+  }
+
+  return ReadResponse(aConn, entryState, headersState, urlListState, aEntryId,
+                      aSavedResponseOut);
+}
+
+nsresult PrepareRequestStatements(mozIStorageConnection* aConn,
+                                  mozIStorageStatement** aEntryStateOut,
+                                  mozIStorageStatement** aHeadersStateOut) {
   MOZ_ASSERT(!NS_IsMainThread());
   MOZ_DIAGNOSTIC_ASSERT(aConn);
-  MOZ_DIAGNOSTIC_ASSERT(aSavedRequestOut);
-  nsCOMPtr<mozIStorageStatement> state;
+  MOZ_DIAGNOSTIC_ASSERT(aEntryStateOut);
+  MOZ_DIAGNOSTIC_ASSERT(aHeadersStateOut);
+
   nsresult rv =
       aConn->CreateStatement(NS_LITERAL_CSTRING("SELECT "
                                                 "request_method, "
@@ -2641,12 +2731,36 @@ nsresult ReadRequest(mozIStorageConnection* aConn, EntryId aEntryId,
                                                 "request_body_id "
                                                 "FROM entries "
                                                 "WHERE id=:id;"),
-                             getter_AddRefs(state));
+                             aEntryStateOut);
   if (NS_WARN_IF(NS_FAILED(rv))) {
     return rv;
   }
 
-  rv = state->BindInt32ByName(NS_LITERAL_CSTRING("id"), aEntryId);
+  rv = aConn->CreateStatement(NS_LITERAL_CSTRING("SELECT "
+                                                 "name, "
+                                                 "value "
+                                                 "FROM request_headers "
+                                                 "WHERE entry_id=:entry_id;"),
+                              aHeadersStateOut);
+  if (NS_WARN_IF(NS_FAILED(rv))) {
+    return rv;
+  }
+
+  return rv;
+}
+
+nsresult ReadRequest(mozIStorageStatement* aEntryState,
+                     mozIStorageStatement* aHeadersState, EntryId aEntryId,
+                     SavedRequest* aSavedRequestOut) {
+  MOZ_ASSERT(!NS_IsMainThread());
+  MOZ_DIAGNOSTIC_ASSERT(aEntryState);
+  MOZ_DIAGNOSTIC_ASSERT(aHeadersState);
+  MOZ_DIAGNOSTIC_ASSERT(aSavedRequestOut);
+
+  mozIStorageStatement* state = aEntryState;
+  mozStorageStatementScoper entryScoper(aEntryState);
+
+  nsresult rv = state->BindInt32ByName(NS_LITERAL_CSTRING("id"), aEntryId);
   if (NS_WARN_IF(NS_FAILED(rv))) {
     return rv;
   }
@@ -2742,15 +2856,8 @@ nsresult ReadRequest(mozIStorageConnection* aConn, EntryId aEntryId,
       return rv;
     }
   }
-  rv = aConn->CreateStatement(NS_LITERAL_CSTRING("SELECT "
-                                                 "name, "
-                                                 "value "
-                                                 "FROM request_headers "
-                                                 "WHERE entry_id=:entry_id;"),
-                              getter_AddRefs(state));
-  if (NS_WARN_IF(NS_FAILED(rv))) {
-    return rv;
-  }
+  state = aHeadersState;
+  mozStorageStatementScoper headersScoper(aHeadersState);
 
   rv = state->BindInt32ByName(NS_LITERAL_CSTRING("entry_id"), aEntryId);
   if (NS_WARN_IF(NS_FAILED(rv))) {
@@ -4935,6 +4935,29 @@ nsresult CanvasRenderingContext2D::GetImageDataArray(
     return NS_OK;
   }
 
+  // Check for site-specific permission before we touch the buffer provider:
+  // if we're only going to return placeholder data there's no reason to do a
+  // (possibly synchronous GPU readback) snapshot of the canvas at all. This
+  // check is not needed if the canvas was created with a docshell (that is
+  // only done for special internal uses).
+  bool usePlaceholder = false;
+  if (mCanvasElement) {
+    nsCOMPtr<Document> ownerDoc = mCanvasElement->OwnerDoc();
+    usePlaceholder = !CanvasUtils::IsImageExtractionAllowed(ownerDoc, aCx,
+                                                            aSubjectPrincipal);
+  }
+
+  // Return all-white, opaque pixel data if no permission.
+  if (usePlaceholder) {
+    JS::AutoCheckCannotGC nogc;
+    bool isShared;
+    uint8_t* data = JS_GetUint8ClampedArrayData(darray, &isShared, nogc);
+    MOZ_ASSERT(!isShared);  // Should not happen, data was created above
+    memset(data, 0xFF, len.value());
+    *aRetval = darray;
+    return NS_OK;
+  }
+
   if (!mBufferProvider) {
     if (!EnsureTarget()) {
       return NS_ERROR_OUT_OF_MEMORY;
@@ -4957,17 +4980,7 @@ nsresult CanvasRenderingContext2D::GetImageDataArray(
   IntRect dstWriteRect = srcReadRect;
   dstWriteRect.MoveBy(-aX, -aY);
 
-  // Check for site-specific permission.  This check is not needed if the
-  // canvas was created with a docshell (that is only done for special
-  // internal uses).
-  bool usePlaceholder = false;
-  if (mCanvasElement) {
-    nsCOMPtr<Document> ownerDoc = mCanvasElement->OwnerDoc();
-    usePlaceholder = !CanvasUtils::IsImageExtractionAllowed(ownerDoc, aCx,
-                                                            aSubjectPrincipal);
-  }
-
-  do {
+  {
     JS::AutoCheckCannotGC nogc;
     bool isShared;
     uint8_t* data = JS_GetUint8ClampedArrayData(darray, &isShared, nogc);
@@ -4977,12 +4990,6 @@ nsresult CanvasRenderingContext2D::GetImageDataArray(
     uint8_t* src =
         rawData.mData + srcReadRect.y * srcStride + srcReadRect.x * 4;
 
-    // Return all-white, opaque pixel data if no permission.
-    if (usePlaceholder) {
-      memset(data, 0xFF, len.value());
-      break;
-    }
-
     uint8_t* dst = data + dstWriteRect.y * (aWidth * 4) + dstWriteRect.x * 4;
 
     if (mOpaque) {
@@ -4993,7 +5000,7 @@ nsresult CanvasRenderingContext2D::GetImageDataArray(
                         aWidth * 4, SurfaceFormat::R8G8B8A8,
                         dstWriteRect.Size());
     }
-  } while (false);
+  }
 
   readback->Unmap();
   *aRetval = darray;
@@ -269,79 +269,61 @@ static already_AddRefed<layers::Image> CreateImageFromSurface(
 }
 
 /*
- * CreateImageFromRawData(), CreateSurfaceFromRawData() and
- * CreateImageFromRawDataInMainThreadSyncTask are helpers for
- * create-from-ImageData case
+ * CreateImageFromRawData() and CreateImageFromRawDataInMainThreadSyncTask are
+ * helpers for create-from-ImageData case
  */
-static already_AddRefed<SourceSurface> CreateSurfaceFromRawData(
-    const gfx::IntSize& aSize, uint32_t aStride, gfx::SurfaceFormat aFormat,
-    uint8_t* aBuffer, uint32_t aBufferLength, const Maybe<IntRect>& aCropRect) {
-  MOZ_ASSERT(!aSize.IsEmpty());
-  MOZ_ASSERT(aBuffer);
-
-  // Wrap the source buffer into a SourceSurface.
-  RefPtr<DataSourceSurface> dataSurface =
-      Factory::CreateWrappingDataSourceSurface(aBuffer, aStride, aSize,
-                                               aFormat);
-
-  if (NS_WARN_IF(!dataSurface)) {
-    return nullptr;
-  }
-
-  // The temporary cropRect variable is equal to the size of source buffer if we
-  // do not need to crop, or it equals to the given cropping size.
-  const IntRect cropRect =
-      aCropRect.valueOr(IntRect(0, 0, aSize.width, aSize.height));
-
-  // Copy the source buffer in the _cropRect_ area into a new SourceSurface.
-  RefPtr<DataSourceSurface> result =
-      CropAndCopyDataSourceSurface(dataSurface, cropRect);
-
-  if (NS_WARN_IF(!result)) {
-    return nullptr;
-  }
-
-  return result.forget();
-}
-
 static already_AddRefed<layers::Image> CreateImageFromRawData(
     const gfx::IntSize& aSize, uint32_t aStride, gfx::SurfaceFormat aFormat,
     uint8_t* aBuffer, uint32_t aBufferLength, const Maybe<IntRect>& aCropRect) {
   MOZ_ASSERT(NS_IsMainThread());
 
-  // Copy and crop the source buffer into a SourceSurface.
-  RefPtr<SourceSurface> rgbaSurface = CreateSurfaceFromRawData(
-      aSize, aStride, aFormat, aBuffer, aBufferLength, aCropRect);
-
-  if (NS_WARN_IF(!rgbaSurface)) {
+  ErrorResult error;
+  const IntRect cropRect =
+      aCropRect ? FixUpNegativeDimension(aCropRect.ref(), error)
+                : IntRect(0, 0, aSize.width, aSize.height);
+  if (NS_WARN_IF(error.Failed())) {
+    error.SuppressException();
     return nullptr;
   }
 
-  // Convert RGBA to BGRA
-  RefPtr<DataSourceSurface> rgbaDataSurface = rgbaSurface->GetDataSurface();
-  DataSourceSurface::ScopedMap rgbaMap(rgbaDataSurface,
-                                       DataSourceSurface::READ);
-  if (NS_WARN_IF(!rgbaMap.IsMapped())) {
-    return nullptr;
-  }
+  // ImageData's underlying data is RGBA but layers want BGRA, so a conversion
+  // pass is needed either way. Crop and swizzle in a single pass straight
+  // from the caller's buffer, rather than copying the crop area and then
+  // converting the copy; this path runs once per ImageBitmap created from an
+  // ImageData. As in CropAndCopyDataSourceSurface, output pixels that fall
+  // outside the source are transparent black, so the destination is
+  // zero-initialized.
+  const SurfaceFormat format = SurfaceFormat::B8G8R8A8;
+  const int bytesPerPixel = BytesPerPixel(format);
+  const IntSize dstSize = IntSize(cropRect.width, cropRect.height);
+  const uint32_t dstStride = dstSize.width * bytesPerPixel;
 
   RefPtr<DataSourceSurface> bgraDataSurface =
-      Factory::CreateDataSourceSurfaceWithStride(rgbaDataSurface->GetSize(),
-                                                 SurfaceFormat::B8G8R8A8,
-                                                 rgbaMap.GetStride());
+      Factory::CreateDataSourceSurfaceWithStride(dstSize, format, dstStride,
+                                                 true);
   if (NS_WARN_IF(!bgraDataSurface)) {
     return nullptr;
   }
 
-  DataSourceSurface::ScopedMap bgraMap(bgraDataSurface,
-                                       DataSourceSurface::WRITE);
-  if (NS_WARN_IF(!bgraMap.IsMapped())) {
-    return nullptr;
-  }
+  const IntRect surfRect(IntPoint(0, 0), aSize);
+  if (surfRect.Intersects(cropRect)) {
+    const IntRect surfPortion = surfRect.Intersect(cropRect);
+    const IntPoint dest(std::max(0, surfPortion.X() - cropRect.X()),
+                        std::max(0, surfPortion.Y() - cropRect.Y()));
 
-  SwizzleData(rgbaMap.GetData(), rgbaMap.GetStride(), SurfaceFormat::R8G8B8A8,
-              bgraMap.GetData(), bgraMap.GetStride(), SurfaceFormat::B8G8R8A8,
-              bgraDataSurface->GetSize());
+    DataSourceSurface::ScopedMap dstMap(bgraDataSurface,
+                                        DataSourceSurface::WRITE);
+    if (NS_WARN_IF(!dstMap.IsMapped())) {
+      return nullptr;
+    }
+
+    const uint8_t* srcBufferPtr =
+        aBuffer + surfPortion.y * aStride + surfPortion.x * bytesPerPixel;
+    uint8_t* dstBufferPtr =
+        dstMap.GetData() + dest.y * dstMap.GetStride() + dest.x * bytesPerPixel;
+    SwizzleData(srcBufferPtr, aStride, aFormat, dstBufferPtr,
+                dstMap.GetStride(), format, surfPortion.Size());
+  }
 
   // Create an Image from the BGRA SourceSurface.
   RefPtr<layers::Image> image = CreateImageFromSurface(bgraDataSurface);
@@ -1560,10 +1542,14 @@ CreateImageBitmapFromBlob::OnImageReady(imgIContainer* aImgContainer,
   // MimeTypeAndDecodeAndCropBlobCompletedMainThread call.
   mSourceSize = surface->GetSize();
 
-  // Crop the source surface if needed.
+  // Crop the source surface if needed. If the crop rect covers exactly the
+  // decoded surface, the copy would reproduce it bit for bit, so use the
+  // surface as-is just like the uncropped case; SetPictureRect copes with
+  // the full-size rect.
   RefPtr<SourceSurface> croppedSurface = surface;
 
-  if (mCropRect.isSome()) {
+  if (mCropRect.isSome() &&
+      !mCropRect->IsEqualEdges(IntRect(IntPoint(0, 0), mSourceSize))) {
     // The blob is just decoded into a RasterImage and not optimized yet, so the
     // _surface_ we get is a DataSourceSurface which wraps the RasterImage's
     // raw buffer.
@@ -347,7 +347,8 @@ const webgl::CachedDrawFetchLimits* ValidateDraw(WebGLContext* const webgl,
         return true;
       };
 
-  if (!webgl->mRasterizerDiscardEnabled) {
+  if (!webgl->mRasterizerDiscardEnabled &&
+      !linkInfo->mValidFragOutputFBs.Find(fb.get())) {
     uint8_t fbZLayerCount = 1;
     if (fb) {
       const auto& info = *fb->GetCompletenessInfo();
@@ -372,6 +373,25 @@ const webgl::CachedDrawFetchLimits* ValidateDraw(WebGLContext* const webgl,
           uint32_t{linkInfo->zLayerCount}, uint32_t{fbZLayerCount});
       return nullptr;
     }
+
+    // Validation passed, so cache that against the attachment set. For the
+    // backbuffer there's nothing that could invalidate the result.
+    auto entry = linkInfo->mValidFragOutputFBs.MakeEntry(fb.get(), true);
+    if (fb) {
+      std::vector<const CacheInvalidator*> cacheDeps;
+      cacheDeps.push_back(fb.get());
+      for (const auto& attach : fb->ColorDrawBuffers()) {
+        const auto& tex = attach->Texture();
+        const auto& rb = attach->Renderbuffer();
+        if (tex) {
+          cacheDeps.push_back(tex);
+        } else if (rb) {
+          cacheDeps.push_back(rb);
+        }
+      }
+      entry->ResetInvalidators(std::move(cacheDeps));
+    }
+    linkInfo->mValidFragOutputFBs.Insert(std::move(entry));
   }
 
   // -
@@ -1110,6 +1110,9 @@ void WebGLFramebuffer::DrawBuffers(const dom::Sequence<GLenum>& buffers) {
 
   mColorDrawBuffers.swap(newColorDrawBuffers);
   RefreshDrawBuffers();  // Calls glDrawBuffers.
+  // Caches keyed on this framebuffer may depend on which attachments are
+  // selected for drawing, e.g. the frag output validation cache.
+  InvalidateCaches();
 }
 
 void WebGLFramebuffer::ReadBuffer(GLenum attachPoint) {
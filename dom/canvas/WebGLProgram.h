@@ -123,6 +123,12 @@ struct LinkedProgramInfo final : public RefCounted<LinkedProgramInfo>,
 
   const CachedDrawFetchLimits* GetDrawFetchLimits() const;
 
+  // Validation of the program's frag outputs against the draw framebuffer's
+  // attachments only depends on this link info and on the attachment formats,
+  // so successful validations are cached here to keep them off the per-draw
+  // path. Keyed by the draw framebuffer, nullptr for the backbuffer.
+  mutable CacheWeakMap<const WebGLFramebuffer*, bool> mValidFragOutputFBs;
+
   //////
 
   explicit LinkedProgramInfo(WebGLProgram* prog);
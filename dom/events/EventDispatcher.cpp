@@ -638,12 +638,18 @@ void EventTargetChainItem::HandleEventTargetChain(
   }
 }
 
-static nsTArray<EventTargetChainItem>* sCachedMainThreadChain = nullptr;
+// Event dispatch commonly nests: an event listener dispatches another event
+// before the outer dispatch has finished. A stack of cached chain buffers
+// keeps such nested dispatches from reallocating their chain every time.
+static const uint32_t kCachedMainThreadChainCapacity = 128;
+static const uint32_t kMaxCachedMainThreadChains = 8;
+static AutoTArray<nsTArray<EventTargetChainItem>, kMaxCachedMainThreadChains>*
+    sCachedMainThreadChains = nullptr;
 
 /* static */
 void EventDispatcher::Shutdown() {
-  delete sCachedMainThreadChain;
-  sCachedMainThreadChain = nullptr;
+  delete sCachedMainThreadChains;
+  sCachedMainThreadChains = nullptr;
 }
 
 EventTargetChainItem* EventTargetChainItemForChromeTarget(
@@ -841,11 +847,15 @@ nsresult EventDispatcher::Dispatch(nsISupports* aTarget,
   ELMCreationDetector cd;
   nsTArray<EventTargetChainItem> chain;
   if (cd.IsMainThread()) {
-    if (!sCachedMainThreadChain) {
-      sCachedMainThreadChain = new nsTArray<EventTargetChainItem>();
+    if (!sCachedMainThreadChains) {
+      sCachedMainThreadChains = new AutoTArray<nsTArray<EventTargetChainItem>,
+                                               kMaxCachedMainThreadChains>();
     }
-    chain.SwapElements(*sCachedMainThreadChain);
-    chain.SetCapacity(128);
+    if (!sCachedMainThreadChains->IsEmpty()) {
+      chain.SwapElements(sCachedMainThreadChains->LastElement());
+      sCachedMainThreadChains->RemoveLastElement();
+    }
+    chain.SetCapacity(kCachedMainThreadChainCapacity);
   }
 
   // Create the event target chain item for the event target.
@@ -1107,9 +1117,14 @@ nsresult EventDispatcher::Dispatch(nsISupports* aTarget,
     *aEventStatus = preVisitor.mEventStatus;
   }
 
-  if (cd.IsMainThread() && chain.Capacity() == 128 && sCachedMainThreadChain) {
+  // Only return the buffer to the cache if the chain never had to grow past
+  // the default capacity; oversized buffers are left to die with |chain|.
+  if (cd.IsMainThread() &&
+      chain.Capacity() == kCachedMainThreadChainCapacity &&
+      sCachedMainThreadChains &&
+      sCachedMainThreadChains->Length() < kMaxCachedMainThreadChains) {
     chain.ClearAndRetainStorage();
-    chain.SwapElements(*sCachedMainThreadChain);
+    chain.SwapElements(*sCachedMainThreadChains->AppendElement());
   }
 
   return rv;
@@ -98,7 +98,7 @@ static uint32_t MutationBitForEventType(EventMessage aEventType) {
 uint32_t EventListenerManager::sMainThreadCreatedCount = 0;
 
 EventListenerManagerBase::EventListenerManagerBase()
-    : mNoListenerForEvent(eVoidEvent),
+    : mNoListenerForEvents{eVoidEvent, eVoidEvent, eVoidEvent},
       mMayHavePaintEventListener(false),
       mMayHaveMutationListeners(false),
       mMayHaveCapturingListeners(false),
@@ -110,8 +110,9 @@ EventListenerManagerBase::EventListenerManagerBase()
       mMayHaveInputOrCompositionEventListener(false),
       mMayHaveSelectionChangeEventListener(false),
       mClearingListeners(false),
-      mIsMainThreadELM(NS_IsMainThread()) {
-  static_assert(sizeof(EventListenerManagerBase) == sizeof(uint32_t),
+      mIsMainThreadELM(NS_IsMainThread()),
+      mNoListenerForEventsIndex(0) {
+  static_assert(sizeof(EventListenerManagerBase) == 2 * sizeof(uint32_t),
                 "Keep the size of EventListenerManagerBase size compact!");
 }
 
@@ -228,8 +229,7 @@ void EventListenerManager::AddEventListenerInternal(
     }
   }
 
-  mNoListenerForEvent = eVoidEvent;
-  mNoListenerForEventAtom = nullptr;
+  ClearNoListenersForEvents();
 
   listener =
       aAllEvents ? mListeners.InsertElementAt(0) : mListeners.AppendElement();
@@ -556,8 +556,7 @@ void EventListenerManager::DisableDevice(EventMessage aEventMessage) {
 void EventListenerManager::NotifyEventListenerRemoved(nsAtom* aUserType) {
   // If the following code is changed, other callsites of EventListenerRemoved
   // and NotifyAboutMainThreadListenerChange should be changed too.
-  mNoListenerForEvent = eVoidEvent;
-  mNoListenerForEventAtom = nullptr;
+  ClearNoListenersForEvents();
   if (mTarget) {
     mTarget->EventListenerRemoved(aUserType);
   }
@@ -1293,8 +1292,26 @@ void EventListenerManager::HandleEventInternal(nsPresContext* aPresContext,
   }
 
   if (mIsMainThreadELM && !hasListener) {
-    mNoListenerForEvent = aEvent->mMessage;
-    mNoListenerForEventAtom = aEvent->mSpecifiedEventType;
+    // Remember that this event type has no listener here, so that the next
+    // dispatch can return early.  See EventListenerManagerBase for why
+    // several types are remembered at once.
+    uint32_t slot = mNoListenerForEventsIndex;
+    if (aEvent->mMessage == eUnidentifiedEvent) {
+      // There is only one cached atom, so make sure at most one slot refers
+      // to an unidentified event.
+      for (uint32_t i = 0; i < kNoListenerForEventsLength; ++i) {
+        if (mNoListenerForEvents[i] == eUnidentifiedEvent) {
+          slot = i;
+          break;
+        }
+      }
+      mNoListenerForEventAtom = aEvent->mSpecifiedEventType;
+    }
+    mNoListenerForEvents[slot] = aEvent->mMessage;
+    if (slot == mNoListenerForEventsIndex) {
+      mNoListenerForEventsIndex =
+          (mNoListenerForEventsIndex + 1) % kNoListenerForEventsLength;
+    }
   }
 
   if (aEvent->DefaultPrevented()) {
@@ -144,7 +144,15 @@ class EventListenerManagerBase {
  protected:
   EventListenerManagerBase();
 
-  EventMessage mNoListenerForEvent;
+  // A small negative cache of event messages that have no listener in this
+  // manager, so that repeated dispatches of the same few event types can
+  // return without scanning the listener array.  More than one message is
+  // remembered because interleaved streams of different types (e.g.
+  // ePointerMove and eMouseMove) would keep evicting each other from a
+  // single-entry cache.  A slot holding eUnidentifiedEvent refers to the
+  // event type in EventListenerManager::mNoListenerForEventAtom.
+  static const uint32_t kNoListenerForEventsLength = 3;
+  EventMessage mNoListenerForEvents[kNoListenerForEventsLength];
   uint16_t mMayHavePaintEventListener : 1;
   uint16_t mMayHaveMutationListeners : 1;
   uint16_t mMayHaveCapturingListeners : 1;
@@ -157,7 +165,9 @@ class EventListenerManagerBase {
   uint16_t mMayHaveSelectionChangeEventListener : 1;
   uint16_t mClearingListeners : 1;
   uint16_t mIsMainThreadELM : 1;
-  // uint16_t mUnused : 4;
+  // The next slot of mNoListenerForEvents to overwrite.
+  uint16_t mNoListenerForEventsIndex : 2;
+  // uint16_t mUnused : 2;
 };
 
 /*
@@ -345,10 +355,12 @@ class EventListenerManager final : public EventListenerManagerBase {
     }
 
     // Check if we already know that there is no event listener for the event.
-    if (mNoListenerForEvent == aEvent->mMessage &&
-        (mNoListenerForEvent != eUnidentifiedEvent ||
-         mNoListenerForEventAtom == aEvent->mSpecifiedEventType)) {
-      return;
+    for (EventMessage message : mNoListenerForEvents) {
+      if (message == aEvent->mMessage &&
+          (message != eUnidentifiedEvent ||
+           mNoListenerForEventAtom == aEvent->mSpecifiedEventType)) {
+        return;
+      }
     }
     HandleEventInternal(aPresContext, aEvent, aDOMEvent, aCurrentTarget,
                         aEventStatus, aItemInShadowTree);
@@ -601,6 +613,15 @@ class EventListenerManager final : public EventListenerManagerBase {
   bool ListenerCanHandle(const Listener* aListener, const WidgetEvent* aEvent,
                          EventMessage aEventMessage) const;
 
+  // Drop the "no listener for this event type" cache; must be called whenever
+  // a listener is added.
+  void ClearNoListenersForEvents() {
+    for (EventMessage& message : mNoListenerForEvents) {
+      message = eVoidEvent;
+    }
+    mNoListenerForEventAtom = nullptr;
+  }
+
   // BE AWARE, a lot of instances of EventListenerManager will be created.
   // Therefor, we need to keep this class compact.  When you add integer
   // members, please add them to EventListemerManagerBase and check the size
@@ -55,6 +55,11 @@ void RemoteDragStartData::AddInitialDnDDataTo(DataTransfer* aDataTransfer,
             continue;
           }
           variant->SetAsISupports(imageContainer);
+        } else if (item.shmemIsUTF16()) {
+          // A large string sent out-of-line.
+          Shmem data = item.data().get_Shmem();
+          variant->SetAsAString(nsDependentSubstring(data.get<char16_t>(),
+                                                     data.Size<char16_t>()));
         } else {
           Shmem data = item.data().get_Shmem();
           variant->SetAsACString(
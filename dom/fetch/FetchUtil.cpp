@@ -7,7 +7,12 @@
 #include "FetchUtil.h"
 
 #include "nsError.h"
+#include "nsIAsyncOutputStream.h"
+#include "nsICacheInfoChannel.h"
+#include "nsProxyRelease.h"
 #include "nsString.h"
+#include "nsThreadUtils.h"
+#include "mozilla/ScopeExit.h"
 #include "mozilla/dom/Document.h"
 
 #include "mozilla/dom/InternalRequest.h"
@@ -302,29 +307,51 @@ class WorkerStreamOwner final {
   RefPtr<WeakWorkerRef> mWorkerRef;
 };
 
-class JSStreamConsumer final : public nsIInputStreamCallback {
+class JSStreamConsumer final : public nsIInputStreamCallback,
+                               public JS::OptimizedEncodingListener {
   nsCOMPtr<nsIEventTarget> mOwningEventTarget;
   RefPtr<WindowStreamOwner> mWindowStreamOwner;
   RefPtr<WorkerStreamOwner> mWorkerStreamOwner;
   JS::StreamConsumer* mConsumer;
   bool mConsumerAborted;
 
+  // When streaming a saved optimized encoding (= compiled machine code)
+  // instead of wasm bytecode, the bytes are accumulated and handed to the
+  // consumer in one piece at end-of-stream.
+  const bool mOptimizedEncoding;
+  JS::OptimizedEncodingBytes mOptimizedEncodingBytes;
+
+  // Non-null when the response's cache entry may be used to store an
+  // optimized encoding of the module being streamed. Only dereferenced on
+  // the main thread.
+  nsMainThreadPtrHandle<nsICacheInfoChannel> mCacheInfoChannel;
+
   JSStreamConsumer(already_AddRefed<WindowStreamOwner> aWindowStreamOwner,
-                   nsIGlobalObject* aGlobal, JS::StreamConsumer* aConsumer)
+                   nsIGlobalObject* aGlobal, JS::StreamConsumer* aConsumer,
+                   nsMainThreadPtrHandle<nsICacheInfoChannel>&&
+                       aCacheInfoChannel,
+                   bool aOptimizedEncoding)
       : mOwningEventTarget(aGlobal->EventTargetFor(TaskCategory::Other)),
         mWindowStreamOwner(aWindowStreamOwner),
         mConsumer(aConsumer),
-        mConsumerAborted(false) {
+        mConsumerAborted(false),
+        mOptimizedEncoding(aOptimizedEncoding),
+        mCacheInfoChannel(std::move(aCacheInfoChannel)) {
     MOZ_DIAGNOSTIC_ASSERT(mWindowStreamOwner);
     MOZ_DIAGNOSTIC_ASSERT(mConsumer);
   }
 
   JSStreamConsumer(RefPtr<WorkerStreamOwner> aWorkerStreamOwner,
-                   nsIGlobalObject* aGlobal, JS::StreamConsumer* aConsumer)
+                   nsIGlobalObject* aGlobal, JS::StreamConsumer* aConsumer,
+                   nsMainThreadPtrHandle<nsICacheInfoChannel>&&
+                       aCacheInfoChannel,
+                   bool aOptimizedEncoding)
       : mOwningEventTarget(aGlobal->EventTargetFor(TaskCategory::Other)),
         mWorkerStreamOwner(std::move(aWorkerStreamOwner)),
         mConsumer(aConsumer),
-        mConsumerAborted(false) {
+        mConsumerAborted(false),
+        mOptimizedEncoding(aOptimizedEncoding),
+        mCacheInfoChannel(std::move(aCacheInfoChannel)) {
     MOZ_DIAGNOSTIC_ASSERT(mWorkerStreamOwner);
     MOZ_DIAGNOSTIC_ASSERT(mConsumer);
   }
@@ -353,7 +380,13 @@ class JSStreamConsumer final : public nsIInputStreamCallback {
 
     // This callback can be called on any thread which is explicitly allowed by
     // this particular JS API call.
-    if (!self->mConsumer->consumeChunk((const uint8_t*)aFromSegment, aCount)) {
+    if (self->mOptimizedEncoding) {
+      if (!self->mOptimizedEncodingBytes.append(
+              (const uint8_t*)aFromSegment, aCount)) {
+        return NS_ERROR_OUT_OF_MEMORY;
+      }
+    } else if (!self->mConsumer->consumeChunk((const uint8_t*)aFromSegment,
+                                              aCount)) {
       self->mConsumerAborted = true;
       return NS_ERROR_UNEXPECTED;
     }
@@ -367,7 +400,10 @@ class JSStreamConsumer final : public nsIInputStreamCallback {
 
   static bool Start(nsCOMPtr<nsIInputStream>&& aStream,
                     JS::StreamConsumer* aConsumer, nsIGlobalObject* aGlobal,
-                    WorkerPrivate* aMaybeWorker) {
+                    WorkerPrivate* aMaybeWorker,
+                    nsMainThreadPtrHandle<nsICacheInfoChannel>&&
+                        aCacheInfoChannel,
+                    bool aOptimizedEncoding) {
     nsCOMPtr<nsIAsyncInputStream> asyncStream;
     nsresult rv = NS_MakeAsyncNonBlockingInputStream(
         aStream.forget(), getter_AddRefs(asyncStream));
@@ -383,7 +419,9 @@ class JSStreamConsumer final : public nsIInputStreamCallback {
         return false;
       }
 
-      consumer = new JSStreamConsumer(std::move(owner), aGlobal, aConsumer);
+      consumer = new JSStreamConsumer(std::move(owner), aGlobal, aConsumer,
+                                      std::move(aCacheInfoChannel),
+                                      aOptimizedEncoding);
     } else {
       RefPtr<WindowStreamOwner> owner =
           WindowStreamOwner::Create(asyncStream, aGlobal);
@@ -391,7 +429,9 @@ class JSStreamConsumer final : public nsIInputStreamCallback {
         return false;
       }
 
-      consumer = new JSStreamConsumer(owner.forget(), aGlobal, aConsumer);
+      consumer = new JSStreamConsumer(owner.forget(), aGlobal, aConsumer,
+                                      std::move(aCacheInfoChannel),
+                                      aOptimizedEncoding);
     }
 
     // This AsyncWait() creates a ref-cycle between asyncStream and consumer:
@@ -420,7 +460,15 @@ class JSStreamConsumer final : public nsIInputStreamCallback {
     }
 
     if (rv == NS_BASE_STREAM_CLOSED) {
-      mConsumer->streamEnd();
+      if (mOptimizedEncoding) {
+        mConsumer->consumeOptimizedEncoding(mOptimizedEncodingBytes.begin(),
+                                            mOptimizedEncodingBytes.length());
+      } else {
+        // Passing 'this' as the listener lets SpiderMonkey hand back an
+        // optimized encoding of the module for storage in the cache entry
+        // once tier-2 compilation finishes.
+        mConsumer->streamEnd(mCacheInfoChannel ? this : nullptr);
+      }
       return NS_OK;
     }
 
@@ -449,10 +497,98 @@ class JSStreamConsumer final : public nsIInputStreamCallback {
 
     return NS_OK;
   }
+
+  // JS::OptimizedEncodingListener:
+
+  void storeOptimizedEncoding(
+      JS::UniqueOptimizedEncodingBytes aBytes) override {
+    MOZ_ASSERT(!mOptimizedEncoding);
+    MOZ_ASSERT(mCacheInfoChannel);
+
+    // SpiderMonkey calls this on a helper thread when tier-2 compilation
+    // finishes, but the cache channel may only be used on the main thread.
+    nsMainThreadPtrHandle<nsICacheInfoChannel> cacheInfoChannel =
+        mCacheInfoChannel;
+    nsCOMPtr<nsIRunnable> runnable = NS_NewRunnableFunction(
+        "JSStreamConsumer::storeOptimizedEncoding",
+        [cacheInfoChannel, bytes = std::move(aBytes)]() {
+          // If the entry already holds machine code, e.g. because this load
+          // happened on a worker thread, where the load path cannot consult
+          // the cache entry, don't overwrite it with identical bytes.
+          nsAutoCString altDataType;
+          if (NS_SUCCEEDED(
+                  cacheInfoChannel->GetAlternativeDataType(altDataType)) &&
+              !altDataType.IsEmpty()) {
+            return;
+          }
+
+          nsCOMPtr<nsIAsyncOutputStream> output;
+          nsresult rv = cacheInfoChannel->OpenAlternativeOutputStream(
+              NS_LITERAL_CSTRING(WASM_ALT_DATA_TYPE_V1), bytes->length(),
+              getter_AddRefs(output));
+          if (NS_FAILED(rv)) {
+            return;
+          }
+
+          auto closeStream =
+              MakeScopeExit([&]() { output->CloseWithStatus(rv); });
+
+          uint32_t written;
+          rv = output->Write(reinterpret_cast<const char*>(bytes->begin()),
+                             bytes->length(), &written);
+          if (NS_SUCCEEDED(rv) && written != bytes->length()) {
+            rv = NS_ERROR_FAILURE;
+          }
+        });
+    MOZ_ALWAYS_SUCCEEDS(NS_DispatchToMainThread(runnable.forget()));
+  }
 };
 
 NS_IMPL_ISUPPORTS(JSStreamConsumer, nsIInputStreamCallback)
 
+// Receives the machine code saved in the HTTP cache entry of a wasm response.
+// If the entry cannot be read after all, falls back to streaming (and
+// compiling) the response's original bytecode body.
+class WasmAltDataReceiver final : public nsIInputStreamReceiver {
+  nsCOMPtr<nsIGlobalObject> mGlobal;
+  nsCOMPtr<nsIInputStream> mBody;
+  JS::StreamConsumer* mConsumer;
+
+  ~WasmAltDataReceiver() = default;
+
+ public:
+  NS_DECL_ISUPPORTS
+
+  WasmAltDataReceiver(nsIGlobalObject* aGlobal, nsIInputStream* aBody,
+                      JS::StreamConsumer* aConsumer)
+      : mGlobal(aGlobal), mBody(aBody), mConsumer(aConsumer) {
+    MOZ_DIAGNOSTIC_ASSERT(mConsumer);
+  }
+
+  NS_IMETHOD
+  OnInputStreamReady(nsIInputStream* aStream) override {
+    AssertIsOnMainThread();
+
+    if (aStream) {
+      nsCOMPtr<nsIInputStream> altData(aStream);
+      if (JSStreamConsumer::Start(
+              std::move(altData), mConsumer, mGlobal, nullptr,
+              nsMainThreadPtrHandle<nsICacheInfoChannel>(), true)) {
+        return NS_OK;
+      }
+    }
+
+    if (!JSStreamConsumer::Start(
+            std::move(mBody), mConsumer, mGlobal, nullptr,
+            nsMainThreadPtrHandle<nsICacheInfoChannel>(), false)) {
+      mConsumer->streamError(size_t(NS_ERROR_OUT_OF_MEMORY));
+    }
+    return NS_OK;
+  }
+};
+
+NS_IMPL_ISUPPORTS(WasmAltDataReceiver, nsIInputStreamReceiver)
+
 static bool ThrowException(JSContext* aCx, unsigned errorNumber) {
   JS_ReportErrorNumberASCII(aCx, js::GetErrorMessage, nullptr, errorNumber);
   return false;
@@ -538,8 +674,44 @@ bool FetchUtil::StreamResponseToJS(JSContext* aCx, JS::HandleObject aObj,
 
   nsIGlobalObject* global = xpc::NativeGlobal(js::UncheckedUnwrap(aObj));
 
+  // A service worker may have delivered the machine code saved by a previous
+  // load of this module directly as the response's alternative body.
+  nsCOMPtr<nsIInputStream> altData = ir->TakeAlternativeBody();
+  if (altData) {
+    if (!JSStreamConsumer::Start(
+            std::move(altData), aConsumer, global, aMaybeWorker,
+            nsMainThreadPtrHandle<nsICacheInfoChannel>(), true)) {
+      return ThrowException(aCx, JSMSG_OUT_OF_MEMORY);
+    }
+    return true;
+  }
+
+  nsMainThreadPtrHandle<nsICacheInfoChannel> cacheInfoChannel;
+  if (ir->HasCacheInfoChannel()) {
+    cacheInfoChannel = ir->TakeCacheInfoChannel();
+  }
+
+  // On the main thread we can ask the cache entry whether it already holds
+  // machine code for this module and, if so, load that instead of compiling
+  // the bytecode all over again. (Worker threads cannot consult the cache
+  // entry here; they only use it to store newly compiled code, from the
+  // main-thread runnable in storeOptimizedEncoding().)
+  if (cacheInfoChannel && NS_IsMainThread()) {
+    nsAutoCString altDataType;
+    if (NS_SUCCEEDED(cacheInfoChannel->GetAlternativeDataType(altDataType)) &&
+        altDataType.EqualsLiteral(WASM_ALT_DATA_TYPE_V1)) {
+      RefPtr<WasmAltDataReceiver> receiver =
+          new WasmAltDataReceiver(global, body, aConsumer);
+      if (NS_SUCCEEDED(cacheInfoChannel->GetAltDataInputStream(
+              NS_LITERAL_CSTRING(WASM_ALT_DATA_TYPE_V1), receiver))) {
+        return true;
+      }
+    }
+  }
+
   if (!JSStreamConsumer::Start(std::move(body), aConsumer, global,
-                               aMaybeWorker)) {
+                               aMaybeWorker, std::move(cacheInfoChannel),
+                               false)) {
     return ThrowException(aCx, JSMSG_OUT_OF_MEMORY);
   }
 
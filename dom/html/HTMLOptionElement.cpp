@@ -310,8 +310,8 @@ already_AddRefed<HTMLOptionElement> HTMLOptionElement::Option(
 
   if (!aText.IsEmpty()) {
     // Create a new text node and append it to the option
-    RefPtr<nsTextNode> textContent =
-        new nsTextNode(option->NodeInfo()->NodeInfoManager());
+    nsNodeInfoManager* nim = option->NodeInfo()->NodeInfoManager();
+    RefPtr<nsTextNode> textContent = new (nim) nsTextNode(nim);
 
     textContent->SetText(aText, false);
 
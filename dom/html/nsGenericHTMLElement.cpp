@@ -2743,8 +2743,8 @@ void nsGenericHTMLElement::SetInnerText(const nsAString& aValue) {
     }
     if (s == end || *s == '\r' || *s == '\n') {
       if (!str.IsEmpty()) {
-        RefPtr<nsTextNode> textContent =
-            new nsTextNode(NodeInfo()->NodeInfoManager());
+        nsNodeInfoManager* nim = NodeInfo()->NodeInfoManager();
+        RefPtr<nsTextNode> textContent = new (nim) nsTextNode(nim);
         textContent->SetText(str, true);
         AppendChildTo(textContent, true);
       }
@@ -466,7 +466,13 @@ nsresult Key::EncodeAsString(const T* aStart, const T* aEnd, uint8_t aType) {
 
   const T* start = aStart;
   const T* end = aEnd;
-  for (const T* iter = start; iter < end; ++iter) {
+  const T* iter = start;
+  // Skip the leading one-byte units in a tight loop first; keys are
+  // overwhelmingly ASCII and the compiler can vectorize this.
+  while (iter < end && *iter <= ONE_BYTE_LIMIT) {
+    ++iter;
+  }
+  for (; iter < end; ++iter) {
     if (*iter > ONE_BYTE_LIMIT) {
       size += char16_t(*iter) > TWO_BYTE_LIMIT ? 2 : 1;
       if (!size.isValid()) {
@@ -496,10 +502,22 @@ nsresult Key::EncodeAsString(const T* aStart, const T* aEnd, uint8_t aType) {
   *(buffer++) = aType;
 
   // Encode string
-  for (const T* iter = start; iter < end; ++iter) {
+  for (iter = start; iter < end; ++iter) {
     if (*iter <= ONE_BYTE_LIMIT) {
-      *(buffer++) = *iter + ONE_BYTE_ADJUST;
-    } else if (char16_t(*iter) <= TWO_BYTE_LIMIT) {
+      // Find the extent of this run of one-byte units, then copy it with a
+      // counted loop that the compiler can vectorize.
+      const T* runEnd = iter + 1;
+      while (runEnd < end && *runEnd <= ONE_BYTE_LIMIT) {
+        ++runEnd;
+      }
+      for (; iter < runEnd; ++iter) {
+        *(buffer++) = *iter + ONE_BYTE_ADJUST;
+      }
+      if (iter == end) {
+        break;
+      }
+    }
+    if (char16_t(*iter) <= TWO_BYTE_LIMIT) {
       char16_t c = char16_t(*iter) + TWO_BYTE_ADJUST + 0x8000;
       *(buffer++) = (char)(c >> 8);
       *(buffer++) = (char)(c & 0xFF);
@@ -566,10 +584,14 @@ void Key::DecodeString(const unsigned char*& aPos, const unsigned char* aEnd,
 
   const unsigned char* buffer = aPos + 1;
 
-  // First measure how big the decoded string will be.
-  uint32_t size = 0;
-  const unsigned char* iter;
-  for (iter = buffer; iter < aEnd && *iter != eTerminator; ++iter) {
+  // First measure how big the decoded string will be.  One-byte units are the
+  // common case, so count the leading run of them in a tight loop first.
+  const unsigned char* iter = buffer;
+  while (iter < aEnd && *iter != eTerminator && !(*iter & 0x80)) {
+    ++iter;
+  }
+  uint32_t size = iter - buffer;
+  for (; iter < aEnd && *iter != eTerminator; ++iter) {
     if (*iter & 0x80) {
       iter += (*iter & 0x40) ? 2 : 1;
     }
@@ -589,8 +611,18 @@ void Key::DecodeString(const unsigned char*& aPos, const unsigned char* aEnd,
 
   for (iter = buffer; iter < aEnd;) {
     if (!(*iter & 0x80)) {
-      *out = *(iter++) - ONE_BYTE_ADJUST;
-    } else if (!(*iter & 0x40)) {
+      // Find the extent of this run of one-byte units, then decode it with a
+      // counted loop that the compiler can vectorize.
+      const unsigned char* runEnd = iter + 1;
+      while (runEnd < aEnd && !(*runEnd & 0x80)) {
+        ++runEnd;
+      }
+      for (; iter < runEnd; ++iter) {
+        *(out++) = *iter - ONE_BYTE_ADJUST;
+      }
+      continue;
+    }
+    if (!(*iter & 0x40)) {
       char16_t c = (char16_t(*(iter++)) << 8);
       if (iter < aEnd) {
         c |= *(iter++);
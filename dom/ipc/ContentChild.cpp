@@ -3272,8 +3272,14 @@ mozilla::ipc::IPCResult ContentChild::RecvInvokeDragSession(
             variant->SetAsAString(data);
           } else if (item.data().type() == IPCDataTransferData::TShmem) {
             Shmem data = item.data().get_Shmem();
-            variant->SetAsACString(
-                nsDependentCSubstring(data.get<char>(), data.Size<char>()));
+            if (item.shmemIsUTF16()) {
+              // A large string sent out-of-line.
+              variant->SetAsAString(nsDependentSubstring(
+                  data.get<char16_t>(), data.Size<char16_t>()));
+            } else {
+              variant->SetAsACString(
+                  nsDependentCSubstring(data.get<char>(), data.Size<char>()));
+            }
             Unused << DeallocShmem(data);
           } else if (item.data().type() == IPCDataTransferData::TIPCBlob) {
             RefPtr<BlobImpl> blobImpl =
@@ -44,6 +44,7 @@ class PreallocatedProcessManagerImpl final : public nsIObserver {
  private:
   static mozilla::StaticRefPtr<PreallocatedProcessManagerImpl> sSingleton;
   static uint32_t sPrelaunchDelayMS;
+  static uint32_t sPoolSize;
 
   PreallocatedProcessManagerImpl();
   ~PreallocatedProcessManagerImpl();
@@ -59,17 +60,21 @@ class PreallocatedProcessManagerImpl final : public nsIObserver {
   void RereadPrefs();
   void Enable();
   void Disable();
-  void CloseProcess();
+  void CloseProcesses();
 
   void ObserveProcessShutdown(nsISupports* aSubject);
 
   bool mEnabled;
   bool mShutdown;
   bool mLaunchInProgress;
-  RefPtr<ContentParent> mPreallocatedProcess;
+  // Oldest process first, so that the one handed out by Take() has had the
+  // most time to finish starting up.
+  AutoTArray<RefPtr<ContentParent>, 4> mPreallocatedProcesses;
   nsTHashtable<nsUint64HashKey> mBlockers;
 
-  bool IsEmpty() const { return !mPreallocatedProcess && !mLaunchInProgress; }
+  bool PoolIsFull() const {
+    return mPreallocatedProcesses.Length() >= sPoolSize;
+  }
 };
 
 /* static */
@@ -77,6 +82,8 @@ StaticRefPtr<PreallocatedProcessManagerImpl>
     PreallocatedProcessManagerImpl::sSingleton;
 /* static */
 uint32_t PreallocatedProcessManagerImpl::sPrelaunchDelayMS = 0;
+/* static */
+uint32_t PreallocatedProcessManagerImpl::sPoolSize = 1;
 
 /* static */
 PreallocatedProcessManagerImpl* PreallocatedProcessManagerImpl::Singleton() {
@@ -105,6 +112,11 @@ void PreallocatedProcessManagerImpl::Init() {
   Preferences::AddUintVarCache(&sPrelaunchDelayMS,
                                "dom.ipc.processPrelaunch.delayMs",
                                DEFAULT_ALLOCATE_DELAY);
+  // How many processes the pool tries to keep ready.  The default of one
+  // keeps the historical behavior; configurations that churn through many
+  // processes can raise it to hide launch latency on consecutive tab opens.
+  Preferences::AddUintVarCache(&sPoolSize, "dom.ipc.processPrelaunch.poolSize",
+                               1);
   Preferences::AddStrongObserver(this, "dom.ipc.processPrelaunch.enabled");
   // We have to respect processCount at all time. This is especially important
   // for testing.
@@ -141,9 +153,9 @@ PreallocatedProcessManagerImpl::Observe(nsISupports* aSubject,
       os->RemoveObserver(this, "profile-change-teardown");
     }
     // Let's prevent any new preallocated processes from starting. ContentParent
-    // will handle the shutdown of the existing process and the
-    // mPreallocatedProcess reference will be cleared by the ClearOnShutdown of
-    // the manager singleton.
+    // will handle the shutdown of the existing processes and the
+    // mPreallocatedProcesses references will be cleared by the ClearOnShutdown
+    // of the manager singleton.
     mShutdown = true;
   } else {
     MOZ_ASSERT(false);
@@ -162,37 +174,47 @@ void PreallocatedProcessManagerImpl::RereadPrefs() {
 
   if (ContentParent::IsMaxProcessCountReached(
           NS_LITERAL_STRING(DEFAULT_REMOTE_TYPE))) {
-    CloseProcess();
+    CloseProcesses();
+    return;
+  }
+
+  // The pool size pref may have been lowered; shut down any excess
+  // processes, newest first.
+  while (mPreallocatedProcesses.Length() > sPoolSize) {
+    RefPtr<ContentParent> process = mPreallocatedProcesses.PopLastElement();
+    process->ShutDownProcess(ContentParent::SEND_SHUTDOWN_MESSAGE);
   }
 }
 
 already_AddRefed<ContentParent> PreallocatedProcessManagerImpl::Take() {
-  if (!mEnabled || mShutdown) {
+  if (!mEnabled || mShutdown || mPreallocatedProcesses.IsEmpty()) {
     return nullptr;
   }
 
-  if (mPreallocatedProcess) {
-    // The preallocated process is taken. Let's try to start up a new one soon.
-    ProcessPriorityManager::SetProcessPriority(mPreallocatedProcess,
-                                               PROCESS_PRIORITY_FOREGROUND);
-    AllocateOnIdle();
-  }
+  RefPtr<ContentParent> process = std::move(mPreallocatedProcesses[0]);
+  mPreallocatedProcesses.RemoveElementAt(0);
 
-  return mPreallocatedProcess.forget();
+  // A process was taken from the pool. Let's try to start up a new one soon.
+  ProcessPriorityManager::SetProcessPriority(process,
+                                             PROCESS_PRIORITY_FOREGROUND);
+  AllocateOnIdle();
+
+  return process.forget();
 }
 
 bool PreallocatedProcessManagerImpl::Provide(ContentParent* aParent) {
   // This will take the already-running process even if there's a
   // launch in progress; if that process hasn't been taken by the
   // time the launch completes, the new process will be shut down.
-  if (mEnabled && !mShutdown && !mPreallocatedProcess) {
-    mPreallocatedProcess = aParent;
+  if (mEnabled && !mShutdown && !PoolIsFull() &&
+      !mPreallocatedProcesses.Contains(aParent)) {
+    mPreallocatedProcesses.AppendElement(aParent);
   }
 
   // We might get a call from both NotifyTabDestroying and NotifyTabDestroyed
   // with the same ContentParent. Returning true here for both calls is
   // important to avoid the cached process to be destroyed.
-  return aParent == mPreallocatedProcess;
+  return mPreallocatedProcesses.Contains(aParent);
 }
 
 void PreallocatedProcessManagerImpl::Enable() {
@@ -220,13 +242,17 @@ void PreallocatedProcessManagerImpl::RemoveBlocker(ContentParent* aParent) {
   // it's possible for a short-lived process to be recycled through
   // Provide() and Take() before reaching RecvFirstIdle.)
   mBlockers.RemoveEntry(childID);
-  if (IsEmpty() && mBlockers.IsEmpty()) {
+  if (!PoolIsFull() && !mLaunchInProgress && mBlockers.IsEmpty()) {
     AllocateAfterDelay();
   }
 }
 
 bool PreallocatedProcessManagerImpl::CanAllocate() {
-  return mEnabled && mBlockers.IsEmpty() && IsEmpty() && !mShutdown &&
+  // Launches stay serialized even when the pool wants several processes, to
+  // limit the CPU/memory/IO contention a launch causes (see
+  // DEFAULT_ALLOCATE_DELAY).
+  return mEnabled && mBlockers.IsEmpty() && !PoolIsFull() &&
+         !mLaunchInProgress && !mShutdown &&
          !ContentParent::IsMaxProcessCountReached(
              NS_LITERAL_STRING(DEFAULT_REMOTE_TYPE));
 }
@@ -255,7 +281,8 @@ void PreallocatedProcessManagerImpl::AllocateOnIdle() {
 
 void PreallocatedProcessManagerImpl::AllocateNow() {
   if (!CanAllocate()) {
-    if (mEnabled && !mShutdown && IsEmpty() && !mBlockers.IsEmpty()) {
+    if (mEnabled && !mShutdown && !PoolIsFull() && !mLaunchInProgress &&
+        !mBlockers.IsEmpty()) {
       // If it's too early to allocate a process let's retry later.
       AllocateAfterDelay();
     }
@@ -271,7 +298,11 @@ void PreallocatedProcessManagerImpl::AllocateNow() {
       [self, this](const RefPtr<ContentParent>& process) {
         mLaunchInProgress = false;
         if (CanAllocate()) {
-          mPreallocatedProcess = process;
+          mPreallocatedProcesses.AppendElement(process);
+          if (!PoolIsFull()) {
+            // Keep refilling until the pool is full, one process at a time.
+            AllocateAfterDelay();
+          }
         } else {
           process->ShutDownProcess(ContentParent::SEND_SHUTDOWN_MESSAGE);
         }
@@ -288,14 +319,14 @@ void PreallocatedProcessManagerImpl::Disable() {
   }
 
   mEnabled = false;
-  CloseProcess();
+  CloseProcesses();
 }
 
-void PreallocatedProcessManagerImpl::CloseProcess() {
-  if (mPreallocatedProcess) {
-    mPreallocatedProcess->ShutDownProcess(ContentParent::SEND_SHUTDOWN_MESSAGE);
-    mPreallocatedProcess = nullptr;
+void PreallocatedProcessManagerImpl::CloseProcesses() {
+  for (RefPtr<ContentParent>& process : mPreallocatedProcesses) {
+    process->ShutDownProcess(ContentParent::SEND_SHUTDOWN_MESSAGE);
   }
+  mPreallocatedProcesses.Clear();
 }
 
 void PreallocatedProcessManagerImpl::ObserveProcessShutdown(
@@ -307,8 +338,11 @@ void PreallocatedProcessManagerImpl::ObserveProcessShutdown(
   props->GetPropertyAsUint64(NS_LITERAL_STRING("childID"), &childID);
   NS_ENSURE_TRUE_VOID(childID != CONTENT_PROCESS_ID_UNKNOWN);
 
-  if (mPreallocatedProcess && childID == mPreallocatedProcess->ChildID()) {
-    mPreallocatedProcess = nullptr;
+  for (uint32_t i = 0; i < mPreallocatedProcesses.Length(); i++) {
+    if (childID == mPreallocatedProcesses[i]->ChildID()) {
+      mPreallocatedProcesses.RemoveElementAt(i);
+      break;
+    }
   }
 
   mBlockers.RemoveEntry(childID);
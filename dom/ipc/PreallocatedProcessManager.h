@@ -16,14 +16,18 @@ class ContentParent;
 }  // namespace dom
 
 /**
- * This class manages a ContentParent that it starts up ahead of any particular
- * need.  You can then call Take() to get this process and use it.  Since we
- * already started it up, it should be ready for use faster than if you'd
- * created the process when you needed it.
+ * This class manages a pool of ContentParents that it starts up ahead of any
+ * particular need.  You can then call Take() to get one of these processes
+ * and use it.  Since we already started it up, it should be ready for use
+ * faster than if you'd created the process when you needed it.
  *
- * This class watches the dom.ipc.processPrelaunch.enabled pref.  If it changes
- * from false to true, it preallocates a process.  If it changes from true to
- * false, it kills the preallocated process, if any.
+ * The pool tries to keep dom.ipc.processPrelaunch.poolSize processes ready
+ * (one by default), launching them one at a time so they don't contend with
+ * each other or with foreground work.
+ *
+ * This class watches the dom.ipc.processPrelaunch.enabled pref.  If it
+ * changes from false to true, it fills the pool.  If it changes from true to
+ * false, it kills the pooled processes, if any.
  *
  * We don't expect this pref to flip between true and false in production, but
  * flipping the pref is important for tests.
@@ -41,15 +45,10 @@ class PreallocatedProcessManager final {
   static void RemoveBlocker(ContentParent* aParent);
 
   /**
-   * Take the preallocated process, if we have one.  If we don't have one, this
-   * returns null.
-   *
-   * If you call Take() twice in a row, the second call is guaranteed to return
-   * null.
+   * Take a preallocated process, if we have one.  If we don't have one, this
+   * returns null.  Taking a process schedules a launch to refill the pool.
    *
-   * After you Take() the preallocated process, you need to call one of the
-   * Allocate* functions (or change the dom.ipc.processPrelaunch pref from
-   * false to true) before we'll create a new process.
+   * Calling Take() repeatedly returns null once the pool has been drained.
    */
   static already_AddRefed<ContentParent> Take();
 
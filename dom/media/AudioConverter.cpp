@@ -9,6 +9,11 @@
 #include <string.h>
 #include <cmath>
 
+#ifdef USE_SSE2
+#  include "AudioConverterSSE2.h"
+#  include "mozilla/SSE.h"
+#endif
+
 /*
  *  Parts derived from MythTV AudioConvert Class
  *  Created by Jean-Yves Avenard.
@@ -226,6 +231,21 @@ size_t AudioConverter::DownmixAudio(void* aOut, const void* aIn,
       // Re-write the buffer with downmixed data
       const float* in = static_cast<const float*>(aIn);
       float* out = static_cast<float*>(aOut);
+#ifdef USE_SSE2
+      if (supports_sse2()) {
+        // The SSE kernel wants the matrix transposed into one zero-padded
+        // coefficient array per output channel.
+        float matrixL[8] = {};
+        float matrixR[8] = {};
+        for (uint32_t j = 0; j < inChannels; j++) {
+          matrixL[j] = dmatrix[inChannels - 3][j][0];
+          matrixR[j] = dmatrix[inChannels - 3][j][1];
+        }
+        DownmixInterleavedToStereo_SSE(in, inChannels, matrixL, matrixR,
+                                       outChannels, out, aFrames);
+        return aFrames;
+      }
+#endif
       for (uint32_t i = 0; i < aFrames; i++) {
         float sampL = 0.0;
         float sampR = 0.0;
@@ -301,6 +321,12 @@ size_t AudioConverter::DownmixAudio(void* aOut, const void* aIn,
   if (mIn.Format() == AudioConfig::FORMAT_FLT) {
     const float* in = static_cast<const float*>(aIn);
     float* out = static_cast<float*>(aOut);
+#ifdef USE_SSE2
+    if (supports_sse2()) {
+      DownmixStereoToMono_SSE(in, out, aFrames);
+      return aFrames;
+    }
+#endif
     for (size_t fIdx = 0; fIdx < aFrames; ++fIdx) {
       float sample = 0.0;
       // The sample of the buffer would be interleaved.
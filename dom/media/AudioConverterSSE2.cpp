@@ -0,0 +1,91 @@
+/* -*- Mode: C++; tab-width: 2; indent-tabs-mode: nil; c-basic-offset: 2 -*- */
+/* vim: set ts=8 sts=2 et sw=2 tw=80: */
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "AudioConverterSSE2.h"
+
+#include <emmintrin.h>
+
+#include "mozilla/Assertions.h"
+
+namespace mozilla {
+
+static inline float HorizontalSum(__m128 aValue) {
+  __m128 shuffled =
+      _mm_shuffle_ps(aValue, aValue, _MM_SHUFFLE(1, 0, 3, 2));
+  aValue = _mm_add_ps(aValue, shuffled);
+  shuffled = _mm_shuffle_ps(aValue, aValue, _MM_SHUFFLE(2, 3, 0, 1));
+  aValue = _mm_add_ps(aValue, shuffled);
+  return _mm_cvtss_f32(aValue);
+}
+
+void DownmixStereoToMono_SSE(const float* aInput, float* aOutput,
+                             uint32_t aFrames) {
+  const __m128 half = _mm_set1_ps(0.5f);
+  uint32_t i = 0;
+  for (; i + 4 <= aFrames; i += 4) {
+    __m128 in0 = _mm_loadu_ps(&aInput[i * 2]);      // L0 R0 L1 R1
+    __m128 in1 = _mm_loadu_ps(&aInput[i * 2 + 4]);  // L2 R2 L3 R3
+    __m128 left = _mm_shuffle_ps(in0, in1, _MM_SHUFFLE(2, 0, 2, 0));
+    __m128 right = _mm_shuffle_ps(in0, in1, _MM_SHUFFLE(3, 1, 3, 1));
+    _mm_storeu_ps(&aOutput[i], _mm_mul_ps(_mm_add_ps(left, right), half));
+  }
+  for (; i < aFrames; i++) {
+    aOutput[i] = (aInput[i * 2] + aInput[i * 2 + 1]) * 0.5f;
+  }
+}
+
+void DownmixInterleavedToStereo_SSE(const float* aInput, uint32_t aChannels,
+                                    const float* aMatrixLeft,
+                                    const float* aMatrixRight,
+                                    uint32_t aOutChannels, float* aOutput,
+                                    uint32_t aFrames) {
+  MOZ_ASSERT(aChannels > 2 && aChannels <= 8);
+  MOZ_ASSERT(aOutChannels == 1 || aOutChannels == 2);
+
+  const __m128 left0 = _mm_loadu_ps(aMatrixLeft);
+  const __m128 left1 = _mm_loadu_ps(aMatrixLeft + 4);
+  const __m128 right0 = _mm_loadu_ps(aMatrixRight);
+  const __m128 right1 = _mm_loadu_ps(aMatrixRight + 4);
+
+  // Each vectorized frame reads 8 samples regardless of the channel count;
+  // the zero padding of the matrix discards the samples of the next frame,
+  // but the reads must stay inside the buffer, so the last few frames take
+  // the scalar loop below.
+  const uint32_t total = aFrames * aChannels;
+  uint32_t i = 0;
+  for (; i < aFrames && i * aChannels + 8 <= total; i++) {
+    const float* in = &aInput[i * aChannels];
+    __m128 in0 = _mm_loadu_ps(in);
+    __m128 in1 = _mm_loadu_ps(in + 4);
+    float sampL = HorizontalSum(
+        _mm_add_ps(_mm_mul_ps(in0, left0), _mm_mul_ps(in1, left1)));
+    float sampR = HorizontalSum(
+        _mm_add_ps(_mm_mul_ps(in0, right0), _mm_mul_ps(in1, right1)));
+    if (aOutChannels == 2) {
+      aOutput[i * 2] = sampL;
+      aOutput[i * 2 + 1] = sampR;
+    } else {
+      aOutput[i] = (sampL + sampR) * 0.5f;
+    }
+  }
+  for (; i < aFrames; i++) {
+    const float* in = &aInput[i * aChannels];
+    float sampL = 0.0f;
+    float sampR = 0.0f;
+    for (uint32_t j = 0; j < aChannels; j++) {
+      sampL += in[j] * aMatrixLeft[j];
+      sampR += in[j] * aMatrixRight[j];
+    }
+    if (aOutChannels == 2) {
+      aOutput[i * 2] = sampL;
+      aOutput[i * 2 + 1] = sampR;
+    } else {
+      aOutput[i] = (sampL + sampR) * 0.5f;
+    }
+  }
+}
+
+}  // namespace mozilla
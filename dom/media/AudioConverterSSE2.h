@@ -0,0 +1,31 @@
+/* -*- Mode: C++; tab-width: 2; indent-tabs-mode: nil; c-basic-offset: 2 -*- */
+/* vim: set ts=8 sts=2 et sw=2 tw=80: */
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#if !defined(AudioConverterSSE2_h)
+#  define AudioConverterSSE2_h
+
+#  include <stdint.h>
+
+namespace mozilla {
+
+// Average an interleaved stereo float buffer down to mono.
+// Can work in place (aOutput == aInput).
+void DownmixStereoToMono_SSE(const float* aInput, float* aOutput,
+                             uint32_t aFrames);
+
+// Downmix interleaved float audio of 3 to 8 channels to stereo or mono using
+// the given per-channel left/right coefficients. The coefficient arrays must
+// hold 8 entries each, zero-padded past aChannels.
+// Can work in place (aOutput == aInput).
+void DownmixInterleavedToStereo_SSE(const float* aInput, uint32_t aChannels,
+                                    const float* aMatrixLeft,
+                                    const float* aMatrixRight,
+                                    uint32_t aOutChannels, float* aOutput,
+                                    uint32_t aFrames);
+
+}  // namespace mozilla
+
+#endif /* AudioConverterSSE2_h */
@@ -946,10 +946,12 @@ long AudioCallbackDriver::DataCallback(const AudioDataValue* aInputBuffer,
     return aFrames - 1;
   }
 
+  // If the monitor is contended, don't block a real-time thread on it; a
+  // pending driver switch is simply picked up on the next callback.
   bool switching = false;
-  {
-    MonitorAutoLock mon(GraphImpl()->GetMonitor());
+  if (GraphImpl()->GetMonitor().TryLock()) {
     switching = !!NextDriver();
+    GraphImpl()->GetMonitor().Unlock();
   }
 
   if (switching) {
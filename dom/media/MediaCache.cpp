@@ -828,8 +828,16 @@ nsresult MediaCache::ReadCacheFile(AutoLock&, int64_t aOffset, void* aData,
   if (!mBlockCache) {
     return NS_ERROR_FAILURE;
   }
-  return mBlockCache->Read(aOffset, reinterpret_cast<uint8_t*>(aData), aLength,
-                           aBytes);
+  RefPtr<MediaBlockCacheBase> blockCache = mBlockCache;
+  {
+    // The block cache does its own locking, so don't hold the cache monitor
+    // across the file IO; otherwise a single slow disk read stalls every
+    // other stream sharing this cache. Callers must revalidate any cache
+    // state they depend on after we return since the monitor was released.
+    MonitorAutoUnlock unlock(mMonitor);
+    return blockCache->Read(aOffset, reinterpret_cast<uint8_t*>(aData),
+                            aLength, aBytes);
+  }
 }
 
 // Allowed range is whatever can be accessed with an int32_t block index.
@@ -2474,6 +2482,18 @@ Result<uint32_t, nsresult> MediaCacheStream::ReadBlockFromCache(
     return mozilla::Err(rv);
   }
 
+  // ReadCacheFile releases the monitor while reading from the file, so the
+  // cache may have changed under us.
+  if (mClosed) {
+    return mozilla::Err(NS_ERROR_ABORT);
+  }
+  if (index >= mBlocks.Length() || mBlocks[index] != cacheBlock) {
+    // The block was evicted or recycled for other data while we were off the
+    // monitor, so the bytes we read can't be trusted. Report a cache miss
+    // and let the caller wait for the data to be downloaded again.
+    return 0;
+  }
+
   if (aNoteBlockUsage) {
     mMediaCache->NoteBlockUsage(aLock, this, cacheBlock, aOffset, mCurrentMode,
                                 TimeStamp::Now());
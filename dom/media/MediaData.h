@@ -68,15 +68,18 @@ class AlignedBuffer {
 
   explicit AlignedBuffer(size_t aLength)
       : mData(nullptr), mLength(0), mBuffer(nullptr), mCapacity(0) {
-    if (EnsureCapacity(aLength)) {
+    if (EnsureCapacity(aLength, /* aZeroNewData = */ true)) {
       mLength = aLength;
     }
   }
 
-  AlignedBuffer(const Type* aData, size_t aLength) : AlignedBuffer(aLength) {
-    if (!mData) {
+  AlignedBuffer(const Type* aData, size_t aLength) : AlignedBuffer() {
+    // The buffer is going to be fully overwritten with aData, there's no need
+    // to zero it first.
+    if (!EnsureCapacity(aLength, /* aZeroNewData = */ false) || !mData) {
       return;
     }
+    mLength = aLength;
     PodCopy(mData, aData, aLength);
   }
 
@@ -113,7 +116,8 @@ class AlignedBuffer {
   // Set length of buffer, allocating memory as required.
   // If length is increased, new buffer area is filled with 0.
   bool SetLength(size_t aLength) {
-    if (aLength > mLength && !EnsureCapacity(aLength)) {
+    if (aLength > mLength &&
+        !EnsureCapacity(aLength, /* aZeroNewData = */ true)) {
       return false;
     }
     mLength = aLength;
@@ -121,7 +125,9 @@ class AlignedBuffer {
   }
   // Add aData at the beginning of buffer.
   bool Prepend(const Type* aData, size_t aLength) {
-    if (!EnsureCapacity(aLength + mLength)) {
+    // The new area is entirely overwritten below, either by the shifted
+    // existing data or by aData, so skip zeroing it.
+    if (!EnsureCapacity(aLength + mLength, /* aZeroNewData = */ false)) {
       return false;
     }
 
@@ -134,7 +140,8 @@ class AlignedBuffer {
   }
   // Add aData at the end of buffer.
   bool Append(const Type* aData, size_t aLength) {
-    if (!EnsureCapacity(aLength + mLength)) {
+    // aData is copied over the entire new area, no need to zero it first.
+    if (!EnsureCapacity(aLength + mLength, /* aZeroNewData = */ false)) {
       return false;
     }
 
@@ -146,8 +153,9 @@ class AlignedBuffer {
   // Replace current content with aData.
   bool Replace(const Type* aData, size_t aLength) {
     // If aLength is smaller than our current length, we leave the buffer as is,
-    // only adjusting the reported length.
-    if (!EnsureCapacity(aLength)) {
+    // only adjusting the reported length. aData is copied over the entire new
+    // area, no need to zero it first.
+    if (!EnsureCapacity(aLength, /* aZeroNewData = */ false)) {
       return false;
     }
 
@@ -194,8 +202,11 @@ class AlignedBuffer {
   // Will enforce that the start of allocated data is always Alignment bytes
   // aligned and that it has sufficient end padding to allow for Alignment bytes
   // block read as required by some data decoders.
+  // If aZeroNewData is true the area between the old and the new length is
+  // filled with 0; callers that overwrite the whole new area pass false to
+  // save a redundant memset on every demuxed sample.
   // Returns false if memory couldn't be allocated.
-  bool EnsureCapacity(size_t aLength) {
+  bool EnsureCapacity(size_t aLength, bool aZeroNewData) {
     if (!aLength) {
       // No need to allocate a buffer yet.
       return true;
@@ -224,7 +235,9 @@ class AlignedBuffer {
 
     MOZ_ASSERT(!mLength || mData);
 
-    PodZero(newData + mLength, aLength - mLength);
+    if (aZeroNewData) {
+      PodZero(newData + mLength, aLength - mLength);
+    }
     if (mLength) {
       PodCopy(newData, mData, mLength);
     }
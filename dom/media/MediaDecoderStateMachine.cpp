@@ -95,6 +95,18 @@ static const int64_t AMPLE_AUDIO_USECS = 2000000;
 static constexpr auto AMPLE_AUDIO_THRESHOLD =
     TimeUnit::FromMicroseconds(AMPLE_AUDIO_USECS);
 
+// If the average time the reader needs to deliver a video frame is within
+// this factor of the frame's on-screen duration, decoding is only just
+// keeping up with playback and we grow the decode-ahead thresholds; see
+// AdjustDecodeAhead(). Shrinking requires twice this margin, so that the
+// thresholds themselves don't oscillate.
+static const uint32_t SLOW_DECODE_THRESHOLD_FACTOR = 2;
+
+// Step by which AdjustDecodeAhead() grows or shrinks the ample audio
+// threshold per decoded video frame.
+static constexpr auto AMPLE_AUDIO_ADJUSTMENT =
+    TimeUnit::FromMicroseconds(250000);
+
 }  // namespace detail
 
 // If we have fewer than LOW_VIDEO_FRAMES decoded frames, and
@@ -573,6 +585,7 @@ class MediaDecoderStateMachine::DecodingState
   }
 
   void HandleVideoDecoded(VideoData* aVideo, TimeStamp aDecodeStart) override {
+    mMaster->AdjustDecodeAhead(aDecodeStart, aVideo);
     mMaster->PushVideo(aVideo);
     DispatchDecodeTasksIfNeeded();
     MaybeStopPrerolling();
@@ -3697,9 +3710,66 @@ void MediaDecoderStateMachine::SetAudioCaptured(bool aCaptured,
 
 uint32_t MediaDecoderStateMachine::GetAmpleVideoFrames() const {
   MOZ_ASSERT(OnTaskQueue());
-  return mReader->VideoIsHardwareAccelerated()
-             ? std::max<uint32_t>(sVideoQueueHWAccelSize, MIN_VIDEO_QUEUE_SIZE)
-             : std::max<uint32_t>(sVideoQueueDefaultSize, MIN_VIDEO_QUEUE_SIZE);
+  uint32_t frames =
+      mReader->VideoIsHardwareAccelerated()
+          ? std::max<uint32_t>(sVideoQueueHWAccelSize, MIN_VIDEO_QUEUE_SIZE)
+          : std::max<uint32_t>(sVideoQueueDefaultSize, MIN_VIDEO_QUEUE_SIZE);
+  return frames + mAmpleVideoFramesAdjustment;
+}
+
+void MediaDecoderStateMachine::AdjustDecodeAhead(TimeStamp aDecodeStart,
+                                                 const VideoData* aVideo) {
+  MOZ_ASSERT(OnTaskQueue());
+
+  TimeDuration decodeTime = TimeStamp::Now() - aDecodeStart;
+  // Average over several frames so a single expensive frame (a keyframe, or
+  // the first sample after the decoder went idle) doesn't resize anything;
+  // the burst/underrun oscillation we're damping builds up over many frames.
+  mVideoDecodeLatencyAverage =
+      mVideoDecodeLatencyAverage.IsZero()
+          ? decodeTime
+          : mVideoDecodeLatencyAverage * 0.75 + decodeTime * 0.25;
+
+  // The time one decoded frame buys us at the current playback rate.
+  double frameBudgetUs = aVideo->mDuration.ToMicroseconds() / mPlaybackRate;
+  if (frameBudgetUs <= 0) {
+    return;
+  }
+
+  double avgUs = mVideoDecodeLatencyAverage.ToMicroseconds();
+  uint32_t maxAdjustment =
+      mReader->VideoIsHardwareAccelerated()
+          ? std::max<uint32_t>(sVideoQueueHWAccelSize, MIN_VIDEO_QUEUE_SIZE)
+          : std::max<uint32_t>(sVideoQueueDefaultSize, MIN_VIDEO_QUEUE_SIZE);
+
+  if (avgUs * detail::SLOW_DECODE_THRESHOLD_FACTOR > frameBudgetUs) {
+    // Decoding only just keeps up with playback. Deepen the decode-ahead so
+    // that transient decode stalls are absorbed by the queues instead of
+    // draining them; refilling in a burst right at the underrun point is
+    // exactly the oscillation we want to avoid.
+    if (mAmpleVideoFramesAdjustment < maxAdjustment) {
+      mAmpleVideoFramesAdjustment++;
+      LOGV("Slow video decode (avg %.1lfms/frame), ample video frames + %u",
+           avgUs / 1000.0, mAmpleVideoFramesAdjustment);
+    }
+    if (!mAudioCaptured &&
+        mAmpleAudioThreshold < detail::AMPLE_AUDIO_THRESHOLD * 2) {
+      mAmpleAudioThreshold += detail::AMPLE_AUDIO_ADJUSTMENT;
+    }
+  } else if (avgUs * 2 * detail::SLOW_DECODE_THRESHOLD_FACTOR <
+             frameBudgetUs) {
+    // Decoding is comfortably faster than playback; give back the extra
+    // memory a step at a time.
+    if (mAmpleVideoFramesAdjustment > 0) {
+      mAmpleVideoFramesAdjustment--;
+    }
+    auto baseThreshold = mAudioCaptured ? detail::AMPLE_AUDIO_THRESHOLD / 2
+                                        : detail::AMPLE_AUDIO_THRESHOLD;
+    if (mAmpleAudioThreshold > baseThreshold) {
+      mAmpleAudioThreshold = std::max(
+          baseThreshold, mAmpleAudioThreshold - detail::AMPLE_AUDIO_ADJUSTMENT);
+    }
+  }
 }
 
 void MediaDecoderStateMachine::GetDebugInfo(
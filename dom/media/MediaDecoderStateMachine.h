@@ -611,6 +611,22 @@ class MediaDecoderStateMachine
   // pause decoding.
   media::TimeUnit mAmpleAudioThreshold;
 
+  // Resizes the decode-ahead thresholds based on how long the reader took to
+  // deliver the given video frame relative to the frame's on-screen duration,
+  // so that slow decoders get a deeper queue to absorb decode stalls. Called
+  // for every frame decoded while in the DECODING state.
+  void AdjustDecodeAhead(TimeStamp aDecodeStart, const VideoData* aVideo);
+
+  // Moving average of the time the reader takes to deliver a video frame,
+  // measured from the decode request to the resolved sample. Maintained by
+  // AdjustDecodeAhead().
+  TimeDuration mVideoDecodeLatencyAverage;
+
+  // Extra frames added to GetAmpleVideoFrames() while video decoding is slow
+  // enough to need the headroom. Bounded by the preffed queue size, so the
+  // queue can at most double.
+  uint32_t mAmpleVideoFramesAdjustment = 0;
+
   // Only one of a given pair of ({Audio,Video}DataPromise, WaitForDataPromise)
   // should exist at any given moment.
   using AudioDataPromise = MediaFormatReader::AudioDataPromise;
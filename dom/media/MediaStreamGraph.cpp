@@ -1343,7 +1343,20 @@ void MediaStreamGraphImpl::Process() {
 
 bool MediaStreamGraphImpl::UpdateMainThreadState() {
   MOZ_ASSERT(OnGraphThread());
-  MonitorAutoLock lock(mMonitor);
+  if (CurrentDriver()->AsAudioCallbackDriver()) {
+    // The audio callback thread must not block on the monitor: if the main
+    // thread holds it (e.g. RunInStableState() shipping the previous batch
+    // of updates), a default-priority thread would be holding up a real-time
+    // thread and we glitch under CPU load. Skip this update instead; newly
+    // queued messages and main thread updates just wait for the next
+    // callback, and WaitForNextIteration() is a no-op for this driver so
+    // skipping cannot park the graph.
+    if (!mMonitor.TryLock()) {
+      return true;
+    }
+  } else {
+    mMonitor.Lock();
+  }
   bool finalUpdate =
       mForceShutDown || (IsEmpty() && mBackMessageQueue.IsEmpty());
   PrepareUpdatesToMainThreadState(finalUpdate);
@@ -1351,12 +1364,14 @@ bool MediaStreamGraphImpl::UpdateMainThreadState() {
     // Enter shutdown mode when this iteration is completed.
     // No need to Destroy streams here. The main-thread owner of each
     // stream is responsible for calling Destroy on them.
+    mMonitor.Unlock();
     return false;
   }
 
   CurrentDriver()->WaitForNextIteration();
 
   SwapMessageQueues();
+  mMonitor.Unlock();
   return true;
 }
 
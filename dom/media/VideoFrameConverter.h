@@ -317,6 +317,7 @@ class VideoFrameConverter {
       return;
     }
 
+    TimeStamp conversionStart = TimeStamp::Now();
     nsresult rv =
         ConvertToI420(aImage, buffer->MutableDataY(), buffer->StrideY(),
                       buffer->MutableDataU(), buffer->StrideU(),
@@ -328,6 +329,11 @@ class VideoFrameConverter {
       return;
     }
 
+    MOZ_LOG(gVideoFrameConverterLog, LogLevel::Debug,
+            ("Converted a %dx%d frame to I420 in %.1fms", aSize.width,
+             aSize.height,
+             (TimeStamp::Now() - conversionStart).ToMilliseconds()));
+
     webrtc::VideoFrame frame(buffer, 0,  // not setting rtp timestamp
                              now, webrtc::kVideoRotation_0);
     VideoFrameConverted(frame);
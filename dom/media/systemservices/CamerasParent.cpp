@@ -122,7 +122,8 @@ void InputObserver::OnDeviceChange() {
 class DeliverFrameRunnable : public mozilla::Runnable {
  public:
   DeliverFrameRunnable(CamerasParent* aParent, CaptureEngine aEngine,
-                       uint32_t aStreamId, const webrtc::VideoFrame& aFrame,
+                       uint32_t aStreamId,
+                       const webrtc::I420BufferInterface& aBuffer,
                        const VideoFrameProperties& aProperties)
       : Runnable("camera::DeliverFrameRunnable"),
         mParent(aParent),
@@ -138,7 +139,7 @@ class DeliverFrameRunnable : public mozilla::Runnable {
     // using ShmemBuffers to avoid the extra copy.
     mAlternateBuffer.reset(new unsigned char[aProperties.bufferSize()]);
     VideoFrameUtils::CopyVideoFrameBuffers(mAlternateBuffer.get(),
-                                           aProperties.bufferSize(), aFrame);
+                                           aProperties.bufferSize(), aBuffer);
   }
 
   DeliverFrameRunnable(CamerasParent* aParent, CaptureEngine aEngine,
@@ -285,9 +286,14 @@ ShmemBuffer CamerasParent::GetBuffer(size_t aSize) {
 void CallbackHelper::OnFrame(const webrtc::VideoFrame& aVideoFrame) {
   LOG_VERBOSE((__PRETTY_FUNCTION__));
   RefPtr<DeliverFrameRunnable> runnable = nullptr;
+  // Convert the frame's buffer to I420 once; for native buffers ToI420() runs
+  // a full software conversion, so everything below works on this result
+  // rather than converting again per helper call.
+  rtc::scoped_refptr<webrtc::I420BufferInterface> i420 =
+      aVideoFrame.video_frame_buffer()->ToI420();
   // Get frame properties
   camera::VideoFrameProperties properties;
-  VideoFrameUtils::InitFrameBufferProperties(aVideoFrame, properties);
+  VideoFrameUtils::InitFrameBufferProperties(aVideoFrame, *i420, properties);
   // Get a shared memory buffer to copy the frame data into
   ShmemBuffer shMemBuffer = mParent->GetBuffer(properties.bufferSize());
   if (!shMemBuffer.Valid()) {
@@ -297,14 +303,14 @@ void CallbackHelper::OnFrame(const webrtc::VideoFrame& aVideoFrame) {
     // the DeliverFrameRunnable constructor.
   } else {
     // Shared memory buffers of the right size are available, do the copy here.
-    VideoFrameUtils::CopyVideoFrameBuffers(
-        shMemBuffer.GetBytes(), properties.bufferSize(), aVideoFrame);
+    VideoFrameUtils::CopyVideoFrameBuffers(shMemBuffer.GetBytes(),
+                                           properties.bufferSize(), *i420);
     runnable = new DeliverFrameRunnable(mParent, mCapEngine, mStreamId,
                                         std::move(shMemBuffer), properties);
   }
   if (!runnable) {
-    runnable = new DeliverFrameRunnable(mParent, mCapEngine, mStreamId,
-                                        aVideoFrame, properties);
+    runnable = new DeliverFrameRunnable(mParent, mCapEngine, mStreamId, *i420,
+                                        properties);
   }
   MOZ_ASSERT(mParent);
   nsIEventTarget* target = mParent->GetBackgroundEventTarget();
@@ -11,22 +11,22 @@
 namespace mozilla {
 
 uint32_t VideoFrameUtils::TotalRequiredBufferSize(
-    const webrtc::VideoFrame& aVideoFrame) {
-  auto i420 = aVideoFrame.video_frame_buffer()->ToI420();
-  auto height = i420->height();
-  size_t size = height * i420->StrideY() +
-                ((height + 1) / 2) * i420->StrideU() +
-                ((height + 1) / 2) * i420->StrideV();
+    const webrtc::I420BufferInterface& aBuffer) {
+  auto height = aBuffer.height();
+  size_t size = height * aBuffer.StrideY() +
+                ((height + 1) / 2) * aBuffer.StrideU() +
+                ((height + 1) / 2) * aBuffer.StrideV();
   MOZ_RELEASE_ASSERT(size < std::numeric_limits<uint32_t>::max());
   return static_cast<uint32_t>(size);
 }
 
 void VideoFrameUtils::InitFrameBufferProperties(
     const webrtc::VideoFrame& aVideoFrame,
+    const webrtc::I420BufferInterface& aBuffer,
     camera::VideoFrameProperties& aDestProps) {
   // The VideoFrameBuffer image data stored in the accompanying buffer
   // the buffer is at least this size of larger.
-  aDestProps.bufferSize() = TotalRequiredBufferSize(aVideoFrame);
+  aDestProps.bufferSize() = TotalRequiredBufferSize(aBuffer);
 
   aDestProps.timeStamp() = aVideoFrame.timestamp();
   aDestProps.ntpTimeMs() = aVideoFrame.ntp_time_ms();
@@ -34,57 +34,56 @@ void VideoFrameUtils::InitFrameBufferProperties(
 
   aDestProps.rotation() = aVideoFrame.rotation();
 
-  auto i420 = aVideoFrame.video_frame_buffer()->ToI420();
-  auto height = i420->height();
-  aDestProps.yAllocatedSize() = height * i420->StrideY();
-  aDestProps.uAllocatedSize() = ((height + 1) / 2) * i420->StrideU();
-  aDestProps.vAllocatedSize() = ((height + 1) / 2) * i420->StrideV();
+  auto height = aBuffer.height();
+  aDestProps.yAllocatedSize() = height * aBuffer.StrideY();
+  aDestProps.uAllocatedSize() = ((height + 1) / 2) * aBuffer.StrideU();
+  aDestProps.vAllocatedSize() = ((height + 1) / 2) * aBuffer.StrideV();
 
-  aDestProps.width() = i420->width();
+  aDestProps.width() = aBuffer.width();
   aDestProps.height() = height;
 
-  aDestProps.yStride() = i420->StrideY();
-  aDestProps.uStride() = i420->StrideU();
-  aDestProps.vStride() = i420->StrideV();
+  aDestProps.yStride() = aBuffer.StrideY();
+  aDestProps.uStride() = aBuffer.StrideU();
+  aDestProps.vStride() = aBuffer.StrideV();
 }
 
-void VideoFrameUtils::CopyVideoFrameBuffers(uint8_t* aDestBuffer,
-                                            const size_t aDestBufferSize,
-                                            const webrtc::VideoFrame& aFrame) {
-  size_t aggregateSize = TotalRequiredBufferSize(aFrame);
+void VideoFrameUtils::CopyVideoFrameBuffers(
+    uint8_t* aDestBuffer, const size_t aDestBufferSize,
+    const webrtc::I420BufferInterface& aBuffer) {
+  size_t aggregateSize = TotalRequiredBufferSize(aBuffer);
 
   MOZ_ASSERT(aDestBufferSize >= aggregateSize);
-  auto i420 = aFrame.video_frame_buffer()->ToI420();
 
   // If planes are ordered YUV and contiguous then do a single copy
-  if ((i420->DataY() != nullptr) &&
+  if ((aBuffer.DataY() != nullptr) &&
       // Check that the three planes are ordered
-      (i420->DataY() < i420->DataU()) && (i420->DataU() < i420->DataV()) &&
+      (aBuffer.DataY() < aBuffer.DataU()) &&
+      (aBuffer.DataU() < aBuffer.DataV()) &&
       //  Check that the last plane ends at firstPlane[totalsize]
-      (&i420->DataY()[aggregateSize] ==
-       &i420->DataV()[((i420->height() + 1) / 2) * i420->StrideV()])) {
-    memcpy(aDestBuffer, i420->DataY(), aggregateSize);
+      (&aBuffer.DataY()[aggregateSize] ==
+       &aBuffer.DataV()[((aBuffer.height() + 1) / 2) * aBuffer.StrideV()])) {
+    memcpy(aDestBuffer, aBuffer.DataY(), aggregateSize);
     return;
   }
 
   // Copy each plane
   size_t offset = 0;
   size_t size;
-  auto height = i420->height();
-  size = height * i420->StrideY();
-  memcpy(&aDestBuffer[offset], i420->DataY(), size);
+  auto height = aBuffer.height();
+  size = height * aBuffer.StrideY();
+  memcpy(&aDestBuffer[offset], aBuffer.DataY(), size);
   offset += size;
-  size = ((height + 1) / 2) * i420->StrideU();
-  memcpy(&aDestBuffer[offset], i420->DataU(), size);
+  size = ((height + 1) / 2) * aBuffer.StrideU();
+  memcpy(&aDestBuffer[offset], aBuffer.DataU(), size);
   offset += size;
-  size = ((height + 1) / 2) * i420->StrideV();
-  memcpy(&aDestBuffer[offset], i420->DataV(), size);
+  size = ((height + 1) / 2) * aBuffer.StrideV();
+  memcpy(&aDestBuffer[offset], aBuffer.DataV(), size);
 }
 
 void VideoFrameUtils::CopyVideoFrameBuffers(
-    ShmemBuffer& aDestShmem, const webrtc::VideoFrame& aVideoFrame) {
+    ShmemBuffer& aDestShmem, const webrtc::I420BufferInterface& aBuffer) {
   CopyVideoFrameBuffers(aDestShmem.Get().get<uint8_t>(),
-                        aDestShmem.Get().Size<uint8_t>(), aVideoFrame);
+                        aDestShmem.Get().Size<uint8_t>(), aBuffer);
 }
 
 }  // namespace mozilla
@@ -10,8 +10,9 @@
 #include "mozilla/camera/PCameras.h"
 
 namespace webrtc {
+class I420BufferInterface;
 class VideoFrame;
-}
+}  // namespace webrtc
 
 namespace mozilla {
 class ShmemBuffer;
@@ -19,28 +20,36 @@ class ShmemBuffer;
 // Util methods for working with webrtc::VideoFrame(s) and
 // the IPC classes that are used to deliver their contents to the
 // MediaEnginge
+//
+// These all take the frame's buffer as an I420BufferInterface. The caller
+// converts the frame's buffer with ToI420() exactly once per frame and passes
+// the result around; calling ToI420() in each helper would re-run the full
+// software conversion every time for frames backed by a native buffer.
 
 class VideoFrameUtils {
  public:
-  // Returns the total number of bytes necessary to copy a VideoFrame's buffer
+  // Returns the total number of bytes necessary to copy an I420 buffer
   // across all planes.
-  static uint32_t TotalRequiredBufferSize(const webrtc::VideoFrame& frame);
+  static uint32_t TotalRequiredBufferSize(
+      const webrtc::I420BufferInterface& aBuffer);
 
-  // Initializes a camera::VideoFrameProperties from a VideoFrameBuffer
+  // Initializes a camera::VideoFrameProperties from a VideoFrame and its
+  // I420 buffer.
   static void InitFrameBufferProperties(
       const webrtc::VideoFrame& aVideoFrame,
+      const webrtc::I420BufferInterface& aBuffer,
       camera::VideoFrameProperties& aDestProperties);
 
-  // Copies the buffers out of a VideoFrameBuffer into a buffer.
+  // Copies the planes of an I420 buffer into a buffer.
   // Attempts to make as few memcopies as possible.
   static void CopyVideoFrameBuffers(uint8_t* aDestBuffer,
                                     const size_t aDestBufferSize,
-                                    const webrtc::VideoFrame& aVideoFrame);
+                                    const webrtc::I420BufferInterface& aBuffer);
 
-  // Copies the buffers in a VideoFrameBuffer into a Shmem
+  // Copies the planes of an I420 buffer into a Shmem
   // returns the eno from the underlying memcpy.
   static void CopyVideoFrameBuffers(ShmemBuffer& aDestShmem,
-                                    const webrtc::VideoFrame& aVideoFrame);
+                                    const webrtc::I420BufferInterface& aBuffer);
 };
 
 } /* namespace mozilla */
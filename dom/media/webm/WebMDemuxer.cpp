@@ -254,23 +254,24 @@ nsresult WebMDemuxer::ReadMetadata() {
   MediaResourceIndex& resource = Resource(TrackInfo::kVideoTrack);
   nestegg* context = Context(TrackInfo::kVideoTrack);
 
-  {
-    // Check how much data nestegg read and force feed it to BufferedState.
-    RefPtr<MediaByteBuffer> buffer = resource.MediaReadAt(0, resource.Tell());
-    if (!buffer) {
-      return NS_ERROR_FAILURE;
-    }
-    mBufferedState->NotifyDataArrived(buffer->Elements(), buffer->Length(), 0);
-    if (mBufferedState->GetInitEndOffset() < 0) {
-      return NS_ERROR_FAILURE;
-    }
-    MOZ_ASSERT(mBufferedState->GetInitEndOffset() <= resource.Tell());
+  // Check how much data nestegg read and force feed it to BufferedState.
+  RefPtr<MediaByteBuffer> buffer = resource.MediaReadAt(0, resource.Tell());
+  if (!buffer) {
+    return NS_ERROR_FAILURE;
+  }
+  mBufferedState->NotifyDataArrived(buffer->Elements(), buffer->Length(), 0);
+  int64_t initEndOffset = mBufferedState->GetInitEndOffset();
+  if (initEndOffset < 0) {
+    return NS_ERROR_FAILURE;
   }
-  mInitData = resource.MediaReadAt(0, mBufferedState->GetInitEndOffset());
-  if (!mInitData ||
-      mInitData->Length() != size_t(mBufferedState->GetInitEndOffset())) {
+  MOZ_ASSERT(initEndOffset <= resource.Tell());
+  if (buffer->Length() < size_t(initEndOffset)) {
     return NS_ERROR_FAILURE;
   }
+  // The init segment is a prefix of what nestegg has just read; truncate the
+  // buffer we already have instead of copying it out of the resource again.
+  mInitData = std::move(buffer);
+  mInitData->SetLength(initEndOffset);
 
   unsigned int ntracks = 0;
   r = nestegg_track_count(context, &ntracks);
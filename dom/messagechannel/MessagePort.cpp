@@ -30,6 +30,7 @@
 #include "nsContentUtils.h"
 #include "nsGlobalWindow.h"
 #include "nsPresContext.h"
+#include "nsThreadUtils.h"
 #include "SharedMessagePortMessage.h"
 
 #include "nsIBFCacheEntry.h"
@@ -169,6 +170,7 @@ NS_IMPL_CYCLE_COLLECTION_UNLINK_BEGIN_INHERITED(MessagePort,
   }
 
   NS_IMPL_CYCLE_COLLECTION_UNLINK(mMessagesForTheOtherPort);
+  NS_IMPL_CYCLE_COLLECTION_UNLINK(mBatchedMessages);
 
   tmp->CloseForced();
 NS_IMPL_CYCLE_COLLECTION_UNLINK_END
@@ -380,15 +382,37 @@ void MessagePort::PostMessage(JSContext* aCx, JS::Handle<JS::Value> aMessage,
   MOZ_ASSERT(mActor);
   MOZ_ASSERT(mMessagesForTheOtherPort.IsEmpty());
 
-  AutoTArray<RefPtr<SharedMessagePortMessage>, 1> array;
-  array.AppendElement(data);
+  // Messages posted from the same task are batched and sent to the actor as
+  // a single IPC message in the next stable state, so that a tight
+  // postMessage() loop doesn't pay one IPC wakeup per call.
+  mBatchedMessages.AppendElement(data);
+  if (mBatchedMessages.Length() == 1) {
+    nsContentUtils::RunInStableState(
+        NewRunnableMethod("MessagePort::FlushBatchedMessages", this,
+                          &MessagePort::FlushBatchedMessages));
+  }
+}
+
+void MessagePort::FlushBatchedMessages() {
+  if (mBatchedMessages.IsEmpty()) {
+    return;
+  }
 
-  AutoTArray<ClonedMessageData, 1> messages;
-  // note: `messages` will borrow the underlying buffer, but this is okay
-  // because reverse destruction order means `messages` will be destroyed prior
-  // to `array`/`data`.
-  SharedMessagePortMessage::FromSharedToMessagesChild(mActor, array, messages);
-  mActor->SendPostMessages(messages);
+  // Any transition away from the entangled state either sends or drops the
+  // batched messages, so finding some here means we are still entangled.
+  MOZ_ASSERT(mState == eStateEntangled);
+  MOZ_ASSERT(mActor);
+
+  {
+    nsTArray<ClonedMessageData> messages;
+    // note: `messages` will borrow the underlying buffers, but this is okay
+    // because reverse destruction order means `messages` will be destroyed
+    // prior to `mBatchedMessages`.
+    SharedMessagePortMessage::FromSharedToMessagesChild(
+        mActor, mBatchedMessages, messages);
+    mActor->SendPostMessages(messages);
+  }
+  mBatchedMessages.Clear();
 }
 
 void MessagePort::PostMessage(JSContext* aCx, JS::Handle<JS::Value> aMessage,
@@ -483,6 +507,7 @@ void MessagePort::CloseInternal(bool aSoftly) {
   // to flush them now.
   if (!aSoftly) {
     mMessages.Clear();
+    mBatchedMessages.Clear();
   }
 
   if (mState == eStateUnshippedEntangled) {
@@ -521,12 +546,15 @@ void MessagePort::CloseInternal(bool aSoftly) {
     return;
   }
 
+  MOZ_ASSERT(mActor);
+
+  // A 'soft' close still delivers the messages posted so far.
+  FlushBatchedMessages();
+
   // We don't care about stopping the sending of messages because from now all
   // the incoming messages will be ignored.
   mState = eStateDisentangledForClose;
 
-  MOZ_ASSERT(mActor);
-
   mActor->SendClose();
   mActor->SetPort(nullptr);
   mActor = nullptr;
@@ -601,6 +629,9 @@ void MessagePort::StartDisentangling() {
   MOZ_ASSERT(mActor);
   MOZ_ASSERT(mState == eStateEntangled);
 
+  // Posted messages must reach the actor before the StopSendingData request.
+  FlushBatchedMessages();
+
   mState = eStateDisentangling;
 
   // Sending this message we communicate to the parent actor that we don't want
@@ -739,6 +770,9 @@ void MessagePort::Closed() {
     return;
   }
 
+  // The other side is gone; anything still batched cannot be delivered.
+  mBatchedMessages.Clear();
+
   mState = eStateDisentangledForClose;
 
   if (mActor) {
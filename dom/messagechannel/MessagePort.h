@@ -148,6 +148,11 @@ class MessagePort final : public DOMEventTargetHelper {
   void StartDisentangling();
   void Disentangle();
 
+  // Sends the messages batched by PostMessage() to the actor as a single
+  // IPC message.  Runs in the next stable state after the first message of
+  // the batch was posted.
+  void FlushBatchedMessages();
+
   void RemoveDocFromBFCache();
 
   void CloseInternal(bool aSoftly);
@@ -170,6 +175,10 @@ class MessagePort final : public DOMEventTargetHelper {
   nsTArray<RefPtr<SharedMessagePortMessage>> mMessages;
   nsTArray<RefPtr<SharedMessagePortMessage>> mMessagesForTheOtherPort;
 
+  // Messages posted while entangled, waiting for FlushBatchedMessages() to
+  // send them all in one IPC message at the next stable state.
+  nsTArray<RefPtr<SharedMessagePortMessage>> mBatchedMessages;
+
   nsAutoPtr<MessagePortIdentifier> mIdentifier;
 
   State mState;
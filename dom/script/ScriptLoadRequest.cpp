@@ -228,6 +228,12 @@ void ScriptLoadRequest::ClearScriptSource() {
   }
 }
 
+void ScriptLoadRequest::DropBytecode() {
+  MOZ_ASSERT(IsBytecode());
+  mScriptBytecode.clearAndFree();
+  mBytecodeOffset = 0;
+}
+
 void ScriptLoadRequest::SetScript(JSScript* aScript) {
   MOZ_ASSERT(!mScript);
   mScript = aScript;
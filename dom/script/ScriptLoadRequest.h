@@ -262,6 +262,12 @@ class ScriptLoadRequest
 
   void ClearScriptSource();
 
+  // Drop the cached bytecode once it has been handed to the JS engine. The
+  // decoded script owns copies of everything it needs, so there is no reason
+  // to keep a second copy of the bytecode alive for the lifetime of the
+  // request.
+  void DropBytecode();
+
   void SetScript(JSScript* aScript);
 
   void MaybeCancelOffThreadScript();
@@ -1999,6 +1999,16 @@ nsresult ScriptLoader::ProcessOffThreadRequest(ScriptLoadRequest* aRequest) {
     return NS_OK;
   }
 
+  // A request that is still in a pending list was compiled eagerly, before
+  // its turn to run came up. Leave it in place; ProcessPendingRequests()
+  // will run it in order now that it is ready.
+  if (aRequest->isInList()) {
+    MOZ_ASSERT(aRequest->IsDeferredScript());
+    ProcessPendingRequestsAsync();
+    mDocument->UnblockOnload(false);
+    return NS_OK;
+  }
+
   nsresult rv = ProcessRequest(aRequest);
   mDocument->UnblockOnload(false);
   return rv;
@@ -2762,6 +2772,13 @@ nsresult ScriptLoader::EvaluateScript(ScriptLoadRequest* aRequest) {
           // We do not expect to be saving anything when we already have some
           // bytecode.
           MOZ_ASSERT(!aRequest->mCacheInfo);
+
+          // The decoded script holds copies of everything it needs, so
+          // release our copy of the bytecode now rather than keeping it
+          // alive until the request is destroyed. These buffers are large
+          // for framework bundles and are duplicated in every content
+          // process which loads the same script.
+          aRequest->DropBytecode();
         } else {
           MOZ_ASSERT(aRequest->IsSource());
           JS::Rooted<JSScript*> script(cx);
@@ -3730,6 +3747,26 @@ nsresult ScriptLoader::PrepareLoadedRequest(ScriptLoadRequest* aRequest,
     // If off-thread compile was rejected, continue with regular processing.
   }
 
+  // A deferred script can't run until the document has finished parsing, so
+  // there is time to compile it off the main thread while the parser keeps
+  // going. The request stays in mDeferRequests to preserve execution order;
+  // ProcessPendingRequests() won't steal a request that is still compiling,
+  // and ProcessOffThreadRequest() leaves listed requests to be run in turn.
+  if (aRequest->IsDeferredScript() && !mDocumentParsingDone &&
+      NumberOfProcessors() > 1) {
+    MOZ_ASSERT(!aRequest->IsModuleRequest());
+    bool couldCompile = false;
+    nsresult rv = AttemptAsyncScriptCompile(aRequest, &couldCompile);
+    NS_ENSURE_SUCCESS(rv, rv);
+    if (couldCompile) {
+      MOZ_ASSERT(aRequest->mProgress == ScriptLoadRequest::Progress::eCompiling,
+                 "Request should be off-thread compiling now.");
+      return NS_OK;
+    }
+
+    // If off-thread compile was rejected, continue with regular processing.
+  }
+
   MaybeMoveToLoadedList(aRequest);
 
   return NS_OK;
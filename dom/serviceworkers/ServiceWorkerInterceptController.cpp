@@ -54,6 +54,13 @@ ServiceWorkerInterceptController::ShouldPrepareForIntercept(
   }
 
   *aShouldIntercept = true;
+
+  // A fetch event is coming for this channel once the interception machinery
+  // finishes setting up.  Start the service worker now so spawning its thread
+  // and evaluating its script overlap with that setup instead of adding to
+  // the navigation's first fetch event latency.
+  swm->WarmUpServiceWorker(principal, aURI);
+
   return NS_OK;
 }
 
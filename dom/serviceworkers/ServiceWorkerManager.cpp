@@ -2116,6 +2116,26 @@ bool ServiceWorkerManager::IsAvailable(nsIPrincipal* aPrincipal, nsIURI* aURI) {
   return registration && registration->GetActive();
 }
 
+void ServiceWorkerManager::WarmUpServiceWorker(nsIPrincipal* aPrincipal,
+                                               nsIURI* aURI) {
+  MOZ_ASSERT(NS_IsMainThread());
+  MOZ_ASSERT(aPrincipal);
+  MOZ_ASSERT(aURI);
+
+  RefPtr<ServiceWorkerRegistrationInfo> registration =
+      GetServiceWorkerRegistrationInfo(aPrincipal, aURI);
+  if (!registration) {
+    return;
+  }
+
+  ServiceWorkerInfo* active = registration->GetActive();
+  if (!active) {
+    return;
+  }
+
+  active->WorkerPrivate()->SpawnWorkerForFetchEvent();
+}
+
 nsresult ServiceWorkerManager::GetClientRegistration(
     const ClientInfo& aClientInfo,
     ServiceWorkerRegistrationInfo** aRegistrationInfo) {
@@ -119,6 +119,12 @@ class ServiceWorkerManager final : public nsIServiceWorkerManager,
 
   bool IsAvailable(nsIPrincipal* aPrincipal, nsIURI* aURI);
 
+  // Start the active worker controlling the given URI ahead of an expected
+  // fetch event, so worker startup overlaps with interception setup.  Does
+  // nothing if there is no matching active worker or the worker is already
+  // running.
+  void WarmUpServiceWorker(nsIPrincipal* aPrincipal, nsIURI* aURI);
+
   // Return true if the given content process could potentially be executing
   // service worker code with the given principal.  At the current time, this
   // just means that we have any registration for the origin, regardless of
@@ -1620,6 +1620,18 @@ nsresult ServiceWorkerPrivate::SendFetchEvent(
   return NS_OK;
 }
 
+void ServiceWorkerPrivate::SpawnWorkerForFetchEvent() {
+  MOZ_ASSERT(NS_IsMainThread());
+
+  // If the worker has no fetch event handler the interception is going to be
+  // reset without dispatching an event, so there is nothing to warm up.
+  if (!mInfo || !mInfo->HandlesFetch()) {
+    return;
+  }
+
+  Unused << NS_WARN_IF(NS_FAILED(SpawnWorkerIfNeeded(FetchEvent)));
+}
+
 nsresult ServiceWorkerPrivate::SpawnWorkerIfNeeded(WakeUpReason aWhy,
                                                    bool* aNewWorkerCreated,
                                                    nsILoadGroup* aLoadGroup) {
@@ -116,6 +116,13 @@ class ServiceWorkerPrivate final {
                           nsILoadGroup* aLoadGroup, const nsAString& aClientId,
                           const nsAString& aResultingClientId, bool aIsReload);
 
+  // Start the worker ahead of an expected fetch event so that spawning the
+  // worker thread and evaluating the script overlap with the remaining
+  // interception setup instead of adding to the first fetch event's latency.
+  // This is harmless if no fetch event ends up being dispatched; the worker
+  // simply times out and is terminated as after any other wake-up.
+  void SpawnWorkerForFetchEvent();
+
   bool MaybeStoreISupports(nsISupports* aSupports);
 
   void RemoveISupports(nsISupports* aSupports);
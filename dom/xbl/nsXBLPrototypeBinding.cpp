@@ -320,8 +320,9 @@ void nsXBLPrototypeBinding::AttributeChanged(
           nsAutoString value;
           aChangedElement->GetAttr(aNameSpaceID, aAttribute, value);
           if (!value.IsEmpty()) {
-            RefPtr<nsTextNode> textContent =
-                new nsTextNode(realElement->NodeInfo()->NodeInfoManager());
+            nsNodeInfoManager* nim =
+                realElement->NodeInfo()->NodeInfoManager();
+            RefPtr<nsTextNode> textContent = new (nim) nsTextNode(nim);
 
             textContent->SetText(value, true);
             realElement->AppendChildTo(textContent, true);
@@ -440,8 +441,9 @@ void nsXBLPrototypeBinding::SetInitialAttributes(
                   (realElement->NodeInfo()->Equals(nsGkAtoms::html,
                                                    kNameSpaceID_XUL) &&
                    dst == nsGkAtoms::value && !value.IsEmpty())) {
-                RefPtr<nsTextNode> textContent =
-                    new nsTextNode(realElement->NodeInfo()->NodeInfoManager());
+                nsNodeInfoManager* nim =
+                    realElement->NodeInfo()->NodeInfoManager();
+                RefPtr<nsTextNode> textContent = new (nim) nsTextNode(nim);
 
                 textContent->SetText(value, false);
                 realElement->AppendChildTo(textContent, false);
@@ -966,7 +968,7 @@ nsresult nsXBLPrototypeBinding::ReadContentNode(nsIObjectInputStream* aStream,
     RefPtr<CharacterData> content;
     switch (namespaceID) {
       case XBLBinding_Serialize_TextNode:
-        content = new nsTextNode(aNim);
+        content = new (aNim) nsTextNode(aNim);
         break;
       case XBLBinding_Serialize_CDATANode:
         content = new CDATASection(aNim);
@@ -60,7 +60,8 @@ nsresult txMozillaTextOutput::comment(const nsString& aData) { return NS_OK; }
 nsresult txMozillaTextOutput::endDocument(nsresult aResult) {
   NS_ENSURE_TRUE(mDocument && mTextParent, NS_ERROR_FAILURE);
 
-  RefPtr<nsTextNode> text = new nsTextNode(mDocument->NodeInfoManager());
+  nsNodeInfoManager* nim = mDocument->NodeInfoManager();
+  RefPtr<nsTextNode> text = new (nim) nsTextNode(nim);
 
   text->SetText(mText, false);
   nsresult rv = mTextParent->AppendChildTo(text, true);
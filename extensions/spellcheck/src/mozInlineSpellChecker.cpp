@@ -194,6 +194,50 @@ nsresult mozInlineSpellStatus::InitForEditorChange(
   return NS_OK;
 }
 
+// mozInlineSpellStatus::MergeEditorChange
+//
+//    When an editor-change check is already scheduled but hasn't run yet,
+//    a further change can be folded into it by growing the range to check
+//    so that it covers both changes and moving the anchor to the newer
+//    caret position. This keeps fast typing from queuing one resumption
+//    per keystroke.
+
+bool mozInlineSpellStatus::MergeEditorChange(
+    const mozInlineSpellStatus& aOther) {
+  if (mOp != eOpChange || aOther.mOp != eOpChange || !mRange ||
+      !aOther.mRange || !aOther.mAnchorRange) {
+    return false;
+  }
+
+  IgnoredErrorResult ignoredError;
+  int16_t cmpResult = mRange->ComparePoint(*aOther.mRange->GetStartContainer(),
+                                           aOther.mRange->StartOffset(),
+                                           ignoredError);
+  if (ignoredError.Failed()) {
+    // Not comparable (e.g. in another subtree); needs its own check.
+    return false;
+  }
+  if (cmpResult < 0 &&  // other range starts before
+      NS_FAILED(mRange->SetStart(aOther.mRange->GetStartContainer(),
+                                 aOther.mRange->StartOffset()))) {
+    return false;
+  }
+  cmpResult = mRange->ComparePoint(*aOther.mRange->GetEndContainer(),
+                                   aOther.mRange->EndOffset(), ignoredError);
+  if (ignoredError.Failed()) {
+    return false;
+  }
+  if (cmpResult > 0 &&  // other range ends after
+      NS_FAILED(mRange->SetEnd(aOther.mRange->GetEndContainer(),
+                               aOther.mRange->EndOffset()))) {
+    return false;
+  }
+
+  // The caret has moved on; the current word is the other event's one.
+  mAnchorRange = aOther.mAnchorRange;
+  return true;
+}
+
 // mozInlineSpellStatis::InitForNavigation
 //
 //    For navigation events, we just need to store the new and old positions.
@@ -453,6 +497,14 @@ class mozInlineSpellResume : public Runnable {
         mDisabledAsyncToken(aDisabledAsyncToken),
         mStatus(std::move(aStatus)) {}
 
+  ~mozInlineSpellResume() {
+    if (mStatus) {
+      // We never ran; don't let the spell checker merge further changes
+      // into a status that's going away.
+      mStatus->mSpellChecker->ForgetPendingEditorChange(mStatus.get());
+    }
+  }
+
   nsresult Post() {
     nsCOMPtr<nsIRunnable> runnable(this);
     return NS_DispatchToCurrentThreadQueue(runnable.forget(), 1000,
@@ -460,10 +512,14 @@ class mozInlineSpellResume : public Runnable {
   }
 
   NS_IMETHOD Run() override {
+    RefPtr<mozInlineSpellChecker> spellChecker = mStatus->mSpellChecker;
+    // Our status is about to run (or be discarded), so further editor
+    // changes need their own check.
+    spellChecker->ForgetPendingEditorChange(mStatus.get());
     // Discard the resumption if the spell checker was disabled after the
     // resumption was scheduled.
-    if (mDisabledAsyncToken == mStatus->mSpellChecker->mDisabledAsyncToken) {
-      mStatus->mSpellChecker->ResumeCheck(std::move(mStatus));
+    if (mDisabledAsyncToken == spellChecker->mDisabledAsyncToken) {
+      spellChecker->ResumeCheck(std::move(mStatus));
     }
     return NS_OK;
   }
@@ -518,6 +574,7 @@ mozInlineSpellChecker::mozInlineSpellChecker()
       mNumPendingSpellChecks(0),
       mNumPendingUpdateCurrentDictionary(0),
       mDisabledAsyncToken(0),
+      mPendingEditorChangeStatus(nullptr),
       mNeedsCheckAfterNavigation(false),
       mFullSpellCheckScheduled(false),
       mIsListeningToEditSubActions(false) {
@@ -593,6 +650,10 @@ nsresult mozInlineSpellChecker::Cleanup(bool aDestroyingFrames) {
   // scheduled spell checks are discarded when they finish.
   mDisabledAsyncToken++;
 
+  // The pending resume will be discarded, so don't merge anything into its
+  // status either.
+  mPendingEditorChangeStatus = nullptr;
+
   if (mNumPendingUpdateCurrentDictionary > 0) {
     // Account for pending UpdateCurrentDictionary calls.
     ChangeNumPendingSpellChecks(-mNumPendingUpdateCurrentDictionary,
@@ -1121,9 +1182,15 @@ nsresult mozInlineSpellChecker::ScheduleSpellCheck(
     // Just ignore this; we're going to spell-check everything anyway
     return NS_OK;
   }
-  // Cache the value because we are going to move aStatus's ownership to
+  if (mPendingEditorChangeStatus &&
+      mPendingEditorChangeStatus->MergeEditorChange(*aStatus)) {
+    // The already scheduled resume covers this change too.
+    return NS_OK;
+  }
+  // Cache the values because we are going to move aStatus's ownership to
   // the new created mozInlineSpellResume instance.
   bool isFullSpellCheck = aStatus->IsFullSpellCheck();
+  mozInlineSpellStatus* status = aStatus.get();
 
   RefPtr<mozInlineSpellResume> resume =
       new mozInlineSpellResume(std::move(aStatus), mDisabledAsyncToken);
@@ -1135,6 +1202,10 @@ nsresult mozInlineSpellChecker::ScheduleSpellCheck(
       // We're going to check everything.  Suppress further spell-check attempts
       // until that happens.
       mFullSpellCheckScheduled = true;
+    } else if (status->mOp == mozInlineSpellStatus::eOpChange) {
+      // Remember the scheduled editor-change check so that further changes
+      // can be merged into it while it's queued.
+      mPendingEditorChangeStatus = status;
     }
     ChangeNumPendingSpellChecks(1);
   }
@@ -47,6 +47,11 @@ class mozInlineSpellStatus {
 
   nsresult FinishInitOnEvent(mozInlineSpellWordUtil& aWordUtil);
 
+  // Try to fold another editor-change status into this one. Returns false
+  // when the statuses can't be combined and the other status needs a
+  // separately scheduled check.
+  bool MergeEditorChange(const mozInlineSpellStatus& aOther);
+
   // Return true if we plan to spell-check everything
   bool IsFullSpellCheck() const { return mOp == eOpChange && !mRange; }
 
@@ -162,6 +167,20 @@ class mozInlineSpellChecker final : public nsIInlineSpellChecker,
   // commment at the top of the .cpp file for more info.
   bool mNeedsCheckAfterNavigation;
 
+  // The status of a pending mozInlineSpellResume for an editor change, so
+  // that further editor changes arriving before it runs can be merged into
+  // it instead of scheduling one resumption per keystroke. The status is
+  // owned by the resume; the resume clears this pointer when it runs or
+  // goes away.
+  mozInlineSpellStatus* mPendingEditorChangeStatus;
+
+  // Forget the pending editor-change status if it's the given one.
+  void ForgetPendingEditorChange(mozInlineSpellStatus* aStatus) {
+    if (mPendingEditorChangeStatus == aStatus) {
+      mPendingEditorChangeStatus = nullptr;
+    }
+  }
+
   // Set when we have a pending mozInlineSpellResume which will check
   // the whole document.
   bool mFullSpellCheckScheduled;
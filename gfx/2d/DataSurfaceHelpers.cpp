@@ -11,6 +11,7 @@
 #include "Logging.h"
 #include "mozilla/MathAlgorithms.h"
 #include "mozilla/PodOperations.h"
+#include "StreamingCopy.h"
 #include "Swizzle.h"
 #include "Tools.h"
 
@@ -116,8 +117,10 @@ void CopySurfaceDataToPackedArray(uint8_t* aSrc, uint8_t* aDst,
   int packedStride = aSrcSize.width * aBytesPerPixel;
 
   if (aSrcStride == packedStride) {
-    // aSrc is already packed, so we can copy with a single memcpy.
-    memcpy(aDst, aSrc, packedStride * aSrcSize.height);
+    // aSrc is already packed, so we can copy with a single memcpy. Surfaces
+    // can run to many megabytes, so use the streaming copy to avoid flushing
+    // the cache when they do.
+    StreamingMemcpy(aDst, aSrc, size_t(packedStride) * aSrcSize.height);
   } else {
     // memcpy one row at a time.
     for (int row = 0; row < aSrcSize.height; ++row) {
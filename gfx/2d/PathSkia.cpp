@@ -6,6 +6,7 @@
 
 #include "PathSkia.h"
 #include <math.h>
+#include <string.h>
 #include "DrawTargetSkia.h"
 #include "Logging.h"
 #include "HelpersSkia.h"
@@ -127,6 +128,56 @@ bool PathSkia::ContainsPoint(const Point& aPoint,
   return SkPathContainsPoint(mPath, aPoint, aTransform);
 }
 
+PathSkia::CachedStroke::CachedStroke(const StrokeOptions& aStrokeOptions)
+    : mLineWidth(aStrokeOptions.mLineWidth),
+      mMiterLimit(aStrokeOptions.mMiterLimit),
+      mDashOffset(aStrokeOptions.mDashOffset),
+      mLineJoin(aStrokeOptions.mLineJoin),
+      mLineCap(aStrokeOptions.mLineCap) {
+  if (aStrokeOptions.mDashLength > 0) {
+    mDashPattern.assign(aStrokeOptions.mDashPattern,
+                        aStrokeOptions.mDashPattern +
+                            aStrokeOptions.mDashLength);
+  }
+}
+
+bool PathSkia::CachedStroke::Matches(
+    const StrokeOptions& aStrokeOptions) const {
+  return mLineWidth == aStrokeOptions.mLineWidth &&
+         mMiterLimit == aStrokeOptions.mMiterLimit &&
+         mDashOffset == aStrokeOptions.mDashOffset &&
+         mLineJoin == aStrokeOptions.mLineJoin &&
+         mLineCap == aStrokeOptions.mLineCap &&
+         mDashPattern.size() == aStrokeOptions.mDashLength &&
+         (aStrokeOptions.mDashLength == 0 ||
+          !memcmp(mDashPattern.data(), aStrokeOptions.mDashPattern,
+                  aStrokeOptions.mDashLength * sizeof(Float)));
+}
+
+bool PathSkia::GetFillPath(const StrokeOptions& aStrokeOptions,
+                           SkPath& aFillPath) const {
+  if (mCachedStroke && mCachedStroke->Matches(aStrokeOptions)) {
+    // SkPath copies just take a reference on the underlying SkPathRef.
+    aFillPath = mCachedStroke->mFillPath;
+    return true;
+  }
+
+  SkPaint paint;
+  if (!StrokeOptionsToPaint(paint, aStrokeOptions)) {
+    return false;
+  }
+
+  // Running the stroker is as expensive as rasterizing the path, and SVG
+  // bounds computation and hit testing tend to ask about the same stroke
+  // over and over for a given path, so remember the answer.
+  mCachedStroke.reset();
+  mCachedStroke.emplace(aStrokeOptions);
+  paint.getFillPath(mPath, &mCachedStroke->mFillPath);
+
+  aFillPath = mCachedStroke->mFillPath;
+  return true;
+}
+
 bool PathSkia::StrokeContainsPoint(const StrokeOptions& aStrokeOptions,
                                    const Point& aPoint,
                                    const Matrix& aTransform) const {
@@ -134,14 +185,11 @@ bool PathSkia::StrokeContainsPoint(const StrokeOptions& aStrokeOptions,
     return false;
   }
 
-  SkPaint paint;
-  if (!StrokeOptionsToPaint(paint, aStrokeOptions)) {
+  SkPath strokePath;
+  if (!GetFillPath(aStrokeOptions, strokePath)) {
     return false;
   }
 
-  SkPath strokePath;
-  paint.getFillPath(mPath, &strokePath);
-
   return SkPathContainsPoint(strokePath, aPoint, aTransform);
 }
 
@@ -160,14 +208,11 @@ Rect PathSkia::GetStrokedBounds(const StrokeOptions& aStrokeOptions,
     return Rect();
   }
 
-  SkPaint paint;
-  if (!StrokeOptionsToPaint(paint, aStrokeOptions)) {
+  SkPath result;
+  if (!GetFillPath(aStrokeOptions, result)) {
     return Rect();
   }
 
-  SkPath result;
-  paint.getFillPath(mPath, &result);
-
   Rect bounds = SkRectToRect(result.computeTightBounds());
   return aTransform.TransformBounds(bounds);
 }
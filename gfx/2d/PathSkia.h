@@ -8,6 +8,7 @@
 #define MOZILLA_GFX_PATH_SKIA_H_
 
 #include "2D.h"
+#include "mozilla/Maybe.h"
 #include "skia/include/core/SkPath.h"
 
 namespace mozilla {
@@ -88,10 +89,35 @@ class PathSkia : public Path {
  private:
   friend class DrawTargetSkia;
 
+  bool GetFillPath(const StrokeOptions& aStrokeOptions,
+                   SkPath& aFillPath) const;
+
   SkPath mPath;
   FillRule mFillRule;
   Point mCurrentPoint;
   Point mBeginPoint;
+
+  // The stroke outline that Skia's stroker produced for the most recently
+  // used stroke options, so that repeated hit tests and bounds queries with
+  // the same stroke don't re-run the stroker. The dash pattern is copied out
+  // of the StrokeOptions since the caller owns that buffer.
+  struct CachedStroke {
+    explicit CachedStroke(const StrokeOptions& aStrokeOptions);
+
+    bool Matches(const StrokeOptions& aStrokeOptions) const;
+
+    Float mLineWidth;
+    Float mMiterLimit;
+    std::vector<Float> mDashPattern;
+    Float mDashOffset;
+    JoinStyle mLineJoin;
+    CapStyle mLineCap;
+    SkPath mFillPath;
+  };
+
+  // No locking; like the rest of this class, a given path is only ever
+  // queried from one thread at a time.
+  mutable Maybe<CachedStroke> mCachedStroke;
 };
 
 }  // namespace gfx
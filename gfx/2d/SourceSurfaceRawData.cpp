@@ -8,6 +8,7 @@
 
 #include "DataSurfaceHelpers.h"
 #include "Logging.h"
+#include "StreamingCopy.h"
 #include "mozilla/Types.h"  // for decltype
 
 namespace mozilla {
@@ -38,7 +39,9 @@ void SourceSurfaceRawData::GuaranteePersistance() {
   uint8_t* oldData = mRawData;
   mRawData = new uint8_t[mStride * mSize.height];
 
-  memcpy(mRawData, oldData, mStride * mSize.height);
+  // The copy is made to keep, not to read back right away, so don't let a
+  // large surface push everything else out of the cache on its way through.
+  StreamingMemcpy(mRawData, oldData, size_t(mStride) * mSize.height);
   mOwnData = true;
 }
 
@@ -0,0 +1,38 @@
+/* -*- Mode: C++; tab-width: 8; indent-tabs-mode: nil; c-basic-offset: 2 -*- */
+/* vim: set ts=8 sts=2 et sw=2 tw=80: */
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "StreamingCopy.h"
+
+#include <cstring>
+
+#ifdef USE_SSE2
+#  include "mozilla/SSE.h"
+#endif
+
+namespace mozilla {
+namespace gfx {
+
+#ifdef USE_SSE2
+void StreamingMemcpy_SSE2(uint8_t* aDst, const uint8_t* aSrc, size_t aLength);
+#endif
+
+// Below this size the destination plausibly fits in L2, and keeping it cached
+// benefits whoever reads it next; bypassing the cache only pays off once the
+// copy is big enough to evict things other code still needs.
+static const size_t kStreamingCopyThreshold = 1024 * 1024;
+
+void StreamingMemcpy(uint8_t* aDst, const uint8_t* aSrc, size_t aLength) {
+#ifdef USE_SSE2
+  if (aLength >= kStreamingCopyThreshold && mozilla::supports_sse2()) {
+    StreamingMemcpy_SSE2(aDst, aSrc, aLength);
+    return;
+  }
+#endif
+  memcpy(aDst, aSrc, aLength);
+}
+
+}  // namespace gfx
+}  // namespace mozilla
@@ -0,0 +1,29 @@
+/* -*- Mode: C++; tab-width: 8; indent-tabs-mode: nil; c-basic-offset: 2 -*- */
+/* vim: set ts=8 sts=2 et sw=2 tw=80: */
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef MOZILLA_GFX_STREAMINGCOPY_H_
+#define MOZILLA_GFX_STREAMINGCOPY_H_
+
+#include "Types.h"
+
+namespace mozilla {
+namespace gfx {
+
+/**
+ * Copies aLength bytes from aSrc to aDst, like memcpy. For buffers too large
+ * to usefully stay resident in cache (think whole video frames or decoded
+ * image surfaces) this uses non-temporal stores where the CPU supports them,
+ * so that the copy doesn't evict the working set of whatever else is running.
+ * Small copies fall back to plain memcpy, which also keeps the destination
+ * warm for an immediate consumer. The buffers must not overlap.
+ */
+GFX2D_API void StreamingMemcpy(uint8_t* aDst, const uint8_t* aSrc,
+                               size_t aLength);
+
+}  // namespace gfx
+}  // namespace mozilla
+
+#endif /* MOZILLA_GFX_STREAMINGCOPY_H_ */
@@ -0,0 +1,53 @@
+/* -*- Mode: C++; tab-width: 8; indent-tabs-mode: nil; c-basic-offset: 2 -*- */
+/* vim: set ts=8 sts=2 et sw=2 tw=80: */
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <emmintrin.h>
+
+#include <cstring>
+
+#include "StreamingCopy.h"
+
+namespace mozilla {
+namespace gfx {
+
+void StreamingMemcpy_SSE2(uint8_t* aDst, const uint8_t* aSrc, size_t aLength) {
+  // Non-temporal stores require a 16-byte aligned destination; the head is at
+  // most 15 bytes, so a plain copy is fine. The source may stay unaligned
+  // since we use unaligned loads throughout.
+  size_t head = (16 - (uintptr_t(aDst) & 15)) & 15;
+  if (head) {
+    memcpy(aDst, aSrc, head);
+    aDst += head;
+    aSrc += head;
+    aLength -= head;
+  }
+
+  size_t blocks = aLength / 64;
+  for (size_t i = 0; i < blocks; i++) {
+    __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(aSrc));
+    __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(aSrc) + 1);
+    __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(aSrc) + 2);
+    __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(aSrc) + 3);
+    _mm_stream_si128(reinterpret_cast<__m128i*>(aDst), a);
+    _mm_stream_si128(reinterpret_cast<__m128i*>(aDst) + 1, b);
+    _mm_stream_si128(reinterpret_cast<__m128i*>(aDst) + 2, c);
+    _mm_stream_si128(reinterpret_cast<__m128i*>(aDst) + 3, d);
+    aSrc += 64;
+    aDst += 64;
+  }
+  aLength -= blocks * 64;
+
+  // Non-temporal stores are weakly ordered; fence before the ordinary stores
+  // of the tail, and before any other thread gets to observe the buffer.
+  _mm_sfence();
+
+  if (aLength) {
+    memcpy(aDst, aSrc, aLength);
+  }
+}
+
+}  // namespace gfx
+}  // namespace mozilla
@@ -129,6 +129,14 @@ void Swizzle_SSE2(const uint8_t*, int32_t, uint8_t*, int32_t, IntSize);
                 Swizzle_SSE2<ShouldSwapRB(aSrcFormat, aDstFormat), \
                              ShouldForceOpaque(aSrcFormat, aDstFormat)>)
 
+template <bool aSwapRB, uint32_t aSrcRGBIndex>
+void PackToRGB24_SSSE3(const uint8_t*, int32_t, uint8_t*, int32_t, IntSize);
+
+#  define PACK_RGB24_SSSE3(aSrcFormat, aDstFormat)                      \
+    FORMAT_CASE(aSrcFormat, aDstFormat,                                 \
+                PackToRGB24_SSSE3<ShouldSwapRB(aSrcFormat, aDstFormat), \
+                                  RGBByteIndex(aSrcFormat)>)
+
 #endif
 
 #ifdef USE_NEON
@@ -708,6 +716,21 @@ bool SwizzleData(const uint8_t* aSrc, int32_t aSrcStride,
       default:
         break;
     }
+
+  // Packing to 24-bit formats benefits from the byte shuffle that was only
+  // added in SSSE3, so it gets its own dispatch table.
+  if (mozilla::supports_ssse3()) switch (FORMAT_KEY(aSrcFormat, aDstFormat)) {
+      PACK_RGB24_SSSE3(SurfaceFormat::B8G8R8A8, SurfaceFormat::B8G8R8)
+      PACK_RGB24_SSSE3(SurfaceFormat::B8G8R8X8, SurfaceFormat::B8G8R8)
+      PACK_RGB24_SSSE3(SurfaceFormat::R8G8B8A8, SurfaceFormat::B8G8R8)
+      PACK_RGB24_SSSE3(SurfaceFormat::R8G8B8X8, SurfaceFormat::B8G8R8)
+      PACK_RGB24_SSSE3(SurfaceFormat::B8G8R8A8, SurfaceFormat::R8G8B8)
+      PACK_RGB24_SSSE3(SurfaceFormat::B8G8R8X8, SurfaceFormat::R8G8B8)
+      PACK_RGB24_SSSE3(SurfaceFormat::R8G8B8A8, SurfaceFormat::R8G8B8)
+      PACK_RGB24_SSSE3(SurfaceFormat::R8G8B8X8, SurfaceFormat::R8G8B8)
+      default:
+        break;
+    }
 #endif
 
 #ifdef USE_NEON
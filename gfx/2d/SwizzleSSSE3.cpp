@@ -0,0 +1,70 @@
+/* -*- Mode: C++; tab-width: 8; indent-tabs-mode: nil; c-basic-offset: 2 -*- */
+/* vim: set ts=8 sts=2 et sw=2 tw=80: */
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "Swizzle.h"
+
+#include <tmmintrin.h>
+
+namespace mozilla {
+namespace gfx {
+
+// Pack a vector of 4 32-bit pixels to 12 bytes of 24-bit RGB with a single
+// byte shuffle, dropping the alpha component and optionally swapping R and B.
+// The upper 4 bytes of the result are zeroed.
+template <bool aSwapRB, uint32_t aSrcRGBIndex>
+static MOZ_ALWAYS_INLINE __m128i PackVectorToRGB24_SSSE3(const __m128i& aSrc) {
+  const int r = aSrcRGBIndex + (aSwapRB ? 2 : 0);
+  const int g = aSrcRGBIndex + 1;
+  const int b = aSrcRGBIndex + (aSwapRB ? 0 : 2);
+  const __m128i mask =
+      _mm_set_epi8(-1, -1, -1, -1, 12 + b, 12 + g, 12 + r, 8 + b, 8 + g, 8 + r,
+                   4 + b, 4 + g, 4 + r, b, g, r);
+  return _mm_shuffle_epi8(aSrc, mask);
+}
+
+template <bool aSwapRB, uint32_t aSrcRGBIndex>
+void PackToRGB24_SSSE3(const uint8_t* aSrc, int32_t aSrcGap, uint8_t* aDst,
+                       int32_t aDstGap, IntSize aSize) {
+  int32_t alignedRow = 4 * (aSize.width & ~3);
+  int32_t remainder = aSize.width & 3;
+
+  for (int32_t height = aSize.height; height > 0; height--) {
+    // Process all 4-pixel chunks as one vector.
+    for (const uint8_t* end = aSrc + alignedRow; aSrc < end;) {
+      __m128i px = _mm_loadu_si128(reinterpret_cast<const __m128i*>(aSrc));
+      px = PackVectorToRGB24_SSSE3<aSwapRB, aSrcRGBIndex>(px);
+      // Store the packed 12 bytes as an 8 byte and a 4 byte store so that we
+      // never write past the end of the row.
+      _mm_storel_epi64(reinterpret_cast<__m128i*>(aDst), px);
+      *reinterpret_cast<uint32_t*>(aDst + 8) =
+          _mm_cvtsi128_si32(_mm_srli_si128(px, 8));
+      aSrc += 4 * 4;
+      aDst += 3 * 4;
+    }
+
+    // Handle any 1-3 remaining pixels.
+    for (int32_t width = remainder; width > 0; width--) {
+      aDst[0] = aSrc[aSrcRGBIndex + (aSwapRB ? 2 : 0)];
+      aDst[1] = aSrc[aSrcRGBIndex + 1];
+      aDst[2] = aSrc[aSrcRGBIndex + (aSwapRB ? 0 : 2)];
+      aSrc += 4;
+      aDst += 3;
+    }
+
+    aSrc += aSrcGap;
+    aDst += aDstGap;
+  }
+}
+
+// Force instantiation of pack variants here. The ARGB layouts only occur on
+// big-endian, so they are not needed for x86.
+template void PackToRGB24_SSSE3<false, 0>(const uint8_t*, int32_t, uint8_t*,
+                                          int32_t, IntSize);
+template void PackToRGB24_SSSE3<true, 0>(const uint8_t*, int32_t, uint8_t*,
+                                         int32_t, IntSize);
+
+}  // namespace gfx
+}  // namespace mozilla
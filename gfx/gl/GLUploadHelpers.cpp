@@ -211,7 +211,11 @@ static void TexSubImage2DHelper(GLContext* gl, GLenum target, GLint level,
       gl->fTexSubImage2D(target, level, xoffset, yoffset, width, height, format,
                          type, pixels);
       gl->fPixelStorei(LOCAL_GL_UNPACK_ALIGNMENT, 4);
-    } else if (gl->IsExtensionSupported(GLContext::EXT_unpack_subimage)) {
+    } else if (gl->Version() >= 300 ||
+               gl->IsExtensionSupported(GLContext::EXT_unpack_subimage)) {
+      // GL_UNPACK_ROW_LENGTH is core in ES 3.0; only older contexts need the
+      // extension. Without this we'd take the copy path below and memcpy the
+      // whole update into a tightly-packed scratch buffer first.
       TexSubImage2DWithUnpackSubimageGLES(gl, target, level, xoffset, yoffset,
                                           width, height, stride, pixelsize,
                                           format, type, pixels);
@@ -560,7 +560,11 @@ bool AnimationHelper::SampleAnimations(CompositorAnimationStorage* aStorage,
     return isAnimating;
   }
 
-  // Sample the animations in CompositorAnimationStorage
+  // Sample the animations in CompositorAnimationStorage. There are at most
+  // four animated values per node (the transform-like properties), so reuse
+  // one inline-storage array across the loop rather than heap-allocating one
+  // per animated node per frame.
+  AutoTArray<RefPtr<RawServoAnimationValue>, 4> animationValues;
   for (auto iter = aStorage->ConstAnimationsTableIter(); !iter.Done();
        iter.Next()) {
     auto& propertyAnimationGroups = *iter.UserData();
@@ -569,7 +573,7 @@ bool AnimationHelper::SampleAnimations(CompositorAnimationStorage* aStorage,
     }
 
     isAnimating = true;
-    nsTArray<RefPtr<RawServoAnimationValue>> animationValues;
+    animationValues.ClearAndRetainStorage();
     AnimatedValue* previousValue = aStorage->GetAnimatedValue(iter.Key());
     AnimationHelper::SampleResult sampleResult =
         AnimationHelper::SampleAnimationForEachNode(
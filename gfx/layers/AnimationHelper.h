@@ -328,6 +328,12 @@ class AnimationHelper {
    * again on the next tick.
    *
    * Note: This is called only by WebRender.
+   *
+   * If we ever grow scroll-driven animations (progress derived from an APZ
+   * scroll offset rather than from these frame times), this is where they
+   * would be sampled; the missing pieces are on the content side, which has
+   * no way yet to declare such an animation and associate it with a scroll
+   * frame over PLayerTransaction/PWebRenderBridge.
    */
   static bool SampleAnimations(CompositorAnimationStorage* aStorage,
                                TimeStamp aPreviousFrameTime,
@@ -158,6 +158,30 @@ Maybe<gfx::IntSize> CbCrSizeFromBufferDescriptor(
   }
 }
 
+Maybe<int32_t> YStrideFromBufferDescriptor(
+    const BufferDescriptor& aDescriptor) {
+  switch (aDescriptor.type()) {
+    case BufferDescriptor::TRGBDescriptor:
+      return Nothing();
+    case BufferDescriptor::TYCbCrDescriptor:
+      return Some(aDescriptor.get_YCbCrDescriptor().yStride());
+    default:
+      MOZ_CRASH("GFX:  YStrideFromBufferDescriptor");
+  }
+}
+
+Maybe<int32_t> CbCrStrideFromBufferDescriptor(
+    const BufferDescriptor& aDescriptor) {
+  switch (aDescriptor.type()) {
+    case BufferDescriptor::TRGBDescriptor:
+      return Nothing();
+    case BufferDescriptor::TYCbCrDescriptor:
+      return Some(aDescriptor.get_YCbCrDescriptor().cbCrStride());
+    default:
+      MOZ_CRASH("GFX:  CbCrStrideFromBufferDescriptor");
+  }
+}
+
 Maybe<gfx::YUVColorSpace> YUVColorSpaceFromBufferDescriptor(
     const BufferDescriptor& aDescriptor) {
   switch (aDescriptor.type()) {
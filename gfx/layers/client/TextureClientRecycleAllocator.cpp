@@ -81,8 +81,12 @@ bool YCbCrTextureClientAllocationHelper::IsCompatible(
   BufferTextureData* bufferData =
       aTextureClient->GetInternalData()->AsBufferTextureData();
   if (!bufferData || aTextureClient->GetSize() != mData.mYSize ||
+      bufferData->GetYStride().isNothing() ||
+      bufferData->GetYStride().ref() != mData.mYStride ||
       bufferData->GetCbCrSize().isNothing() ||
       bufferData->GetCbCrSize().ref() != mData.mCbCrSize ||
+      bufferData->GetCbCrStride().isNothing() ||
+      bufferData->GetCbCrStride().ref() != mData.mCbCrStride ||
       bufferData->GetYUVColorSpace().isNothing() ||
       bufferData->GetYUVColorSpace().ref() != mData.mYUVColorSpace ||
       bufferData->GetColorDepth().isNothing() ||
@@ -423,6 +423,19 @@ void AsyncCompositionManager::AlignFixedAndStickyLayers(
     const LayerToParentLayerMatrix4x4& aPreviousTransformForRoot,
     const LayerToParentLayerMatrix4x4& aCurrentTransformForRoot,
     const ScreenMargin& aFixedLayerMargins, ClipPartsCache& aClipPartsCache) {
+  // If the async transform on the subtree root hasn't actually changed, and
+  // there are no fixed-layer margins to apply, then any adjustment we'd
+  // compute for a fixed or sticky descendant is a zero translation, so don't
+  // bother walking the subtree looking for one. This is the common case for
+  // scroll frames that are at rest while the compositor is busy animating
+  // something else. Note that the zoom-container code path that wants a
+  // margins-only adjustment calls AdjustFixedOrStickyLayer directly and so
+  // doesn't take this early return.
+  if (aPreviousTransformForRoot == aCurrentTransformForRoot &&
+      aFixedLayerMargins == ScreenMargin()) {
+    return;
+  }
+
   Layer* layer = aStartTraversalAt;
   bool needsAsyncTransformUnapplied = false;
   if (Maybe<ScrollableLayerGuid::ViewID> fixedTo = IsFixedOrSticky(layer)) {
@@ -225,6 +225,18 @@ void CompositorVsyncScheduler::Composite(VsyncId aId,
   mLastVsyncId = aId;
 
   if (!mAsapScheduling) {
+    // This task was queued FIFO behind whatever else was already pending on
+    // the compositor thread, e.g. a texture destruction batch.  If it starts
+    // more than a vsync interval after the vsync that scheduled it, the frame
+    // has already missed its deadline because of that other work, so record
+    // how late we are to make such drops visible.
+    TimeDuration delay = TimeStamp::Now() - aVsyncTimestamp;
+    if (delay > mVsyncSchedulerOwner->GetVsyncInterval()) {
+      mozilla::Telemetry::Accumulate(
+          mozilla::Telemetry::COMPOSITE_MISSED_VSYNC_DEADLINE_MS,
+          delay.ToMilliseconds());
+    }
+
     // Some early exit conditions if we're not in ASAP mode
     if (aVsyncTimestamp < mLastCompose) {
       // We can sometimes get vsync timestamps that are in the past
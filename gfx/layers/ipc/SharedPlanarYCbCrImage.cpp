@@ -61,11 +61,8 @@ SharedPlanarYCbCrImage::GetAsSourceSurface() {
 }
 
 bool SharedPlanarYCbCrImage::CopyData(const PlanarYCbCrData& aData) {
-  // If mTextureClient has not already been allocated (through Allocate(aData))
-  // allocate it. This code path is slower than the one used when Allocate has
-  // been called since it will trigger a full copy.
-  PlanarYCbCrData data = aData;
-  if (!mTextureClient && !Allocate(data)) {
+  // If mTextureClient has not already been allocated, allocate it.
+  if (!mTextureClient && !Allocate(aData)) {
     return false;
   }
 
@@ -79,6 +76,21 @@ bool SharedPlanarYCbCrImage::CopyData(const PlanarYCbCrData& aData) {
     MOZ_ASSERT(false, "Failed to copy YCbCr data into the TextureClient");
     return false;
   }
+
+  // Record where the planes ended up while we still hold the lock. The
+  // SharedPlanarYCbCrImage just pulls pointers out of the TextureClient and
+  // keeps them around, which works only because the underlying
+  // BufferTextureData is always mapped in memory even outside of the
+  // lock/unlock interval. That's sad and new code should not follow this
+  // example.
+  MappedYCbCrTextureData mapped;
+  if (!mTextureClient->BorrowMappedYCbCrData(mapped)) {
+    MOZ_CRASH("GFX: Cannot borrow mapped YCbCr");
+  }
+  mData.mYChannel = mapped.y.data;
+  mData.mCbChannel = mapped.cb.data;
+  mData.mCrChannel = mapped.cr.data;
+
   mTextureClient->MarkImmutable();
   return true;
 }
@@ -92,7 +104,7 @@ bool SharedPlanarYCbCrImage::IsValid() const {
   return mTextureClient && mTextureClient->IsValid();
 }
 
-bool SharedPlanarYCbCrImage::Allocate(PlanarYCbCrData& aData) {
+bool SharedPlanarYCbCrImage::Allocate(const PlanarYCbCrData& aData) {
   MOZ_ASSERT(!mTextureClient, "This image already has allocated data");
   static const uint32_t MAX_POOLED_VIDEO_COUNT = 5;
 
@@ -114,25 +126,11 @@ bool SharedPlanarYCbCrImage::Allocate(PlanarYCbCrData& aData) {
     return false;
   }
 
-  MappedYCbCrTextureData mapped;
-  // The locking here is sort of a lie. The SharedPlanarYCbCrImage just pulls
-  // pointers out of the TextureClient and keeps them around, which works only
-  // because the underlyin BufferTextureData is always mapped in memory even
-  // outside of the lock/unlock interval. That's sad and new code should follow
-  // this example.
-  if (!mTextureClient->Lock(OpenMode::OPEN_READ) ||
-      !mTextureClient->BorrowMappedYCbCrData(mapped)) {
-    MOZ_CRASH("GFX: Cannot lock or borrow mapped YCbCr");
-  }
-
-  aData.mYChannel = mapped.y.data;
-  aData.mCbChannel = mapped.cb.data;
-  aData.mCrChannel = mapped.cr.data;
-
-  // copy some of aData's values in mData (most of them)
-  mData.mYChannel = aData.mYChannel;
-  mData.mCbChannel = aData.mCbChannel;
-  mData.mCrChannel = aData.mCrChannel;
+  // copy some of aData's values in mData (most of them). The channel pointers
+  // are recorded in CopyData once the texture has been mapped.
+  mData.mYChannel = nullptr;
+  mData.mCbChannel = nullptr;
+  mData.mCrChannel = nullptr;
   mData.mYSize = aData.mYSize;
   mData.mCbCrSize = aData.mCbCrSize;
   mData.mPicX = aData.mPicX;
@@ -157,8 +155,6 @@ bool SharedPlanarYCbCrImage::Allocate(PlanarYCbCrData& aData) {
   mSize = mData.mPicSize;
   mOrigin = gfx::IntPoint(aData.mPicX, aData.mPicY);
 
-  mTextureClient->Unlock();
-
   return mBufferSize > 0;
 }
 
@@ -36,7 +36,7 @@ class SharedPlanarYCbCrImage : public PlanarYCbCrImage {
   bool CopyData(const PlanarYCbCrData& aData) override;
   bool AdoptData(const Data& aData) override;
 
-  bool Allocate(PlanarYCbCrData& aData);
+  bool Allocate(const PlanarYCbCrData& aData);
 
   bool IsValid() const override;
 
@@ -1048,13 +1048,17 @@ mozilla::ipc::IPCResult WebRenderBridgeParent::RecvSetDisplayList(
 
   bool validTransaction = aIdNamespace == mIdNamespace;
 
-  wr::RenderRootArray<wr::TransactionBuilder> txns;
+  // Only create transactions for the render roots that actually have a
+  // display list in this message; a wr::TransactionBuilder owns a rust-side
+  // transaction object, so there is no point paying for the unused ones.
+  wr::RenderRootArray<Maybe<wr::TransactionBuilder>> txns;
   wr::RenderRootArray<Maybe<wr::AutoTransactionSender>> senders;
   for (auto& displayList : aDisplayLists) {
     MOZ_ASSERT(displayList.mRenderRoot == wr::RenderRoot::Default ||
                IsRootWebRenderBridgeParent());
     auto renderRoot = displayList.mRenderRoot;
-    auto& txn = txns[renderRoot];
+    txns[renderRoot].emplace();
+    auto& txn = txns[renderRoot].ref();
 
     txn.SetLowPriority(!IsRootWebRenderBridgeParent());
     if (validTransaction) {
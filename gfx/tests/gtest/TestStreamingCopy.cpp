@@ -0,0 +1,72 @@
+/* -*- Mode: C++; tab-width: 8; indent-tabs-mode: nil; c-basic-offset: 2 -*- */
+/* vim: set ts=8 sts=2 et sw=2 tw=80: */
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "gtest/gtest.h"
+#include "gtest/MozGTestBench.h"  // For MOZ_GTEST_BENCH
+#include "mozilla/UniquePtr.h"
+#include "mozilla/gfx/StreamingCopy.h"
+
+using namespace mozilla;
+using namespace mozilla::gfx;
+
+TEST(Moz2D, StreamingMemcpy)
+{
+  // Large enough to take the streaming path, with a slack region so we can
+  // exercise misaligned sources and destinations and check for overruns.
+  const size_t length = 2 * 1024 * 1024;
+  const size_t slack = 64;
+  UniquePtr<uint8_t[]> src = MakeUnique<uint8_t[]>(length + slack);
+  UniquePtr<uint8_t[]> dst = MakeUnique<uint8_t[]>(length + slack);
+
+  for (size_t srcOffset : {size_t(0), size_t(1), size_t(7)}) {
+    for (size_t dstOffset : {size_t(0), size_t(3), size_t(13)}) {
+      for (size_t i = 0; i < length + slack; i++) {
+        src[i] = uint8_t(i * 31 + srcOffset);
+        dst[i] = 0xAA;
+      }
+
+      StreamingMemcpy(dst.get() + dstOffset, src.get() + srcOffset, length);
+
+      EXPECT_EQ(0,
+                memcmp(dst.get() + dstOffset, src.get() + srcOffset, length));
+      // Nothing before or after the destination range may be touched.
+      for (size_t i = 0; i < dstOffset; i++) {
+        EXPECT_EQ(0xAA, dst[i]);
+      }
+      for (size_t i = dstOffset + length; i < length + slack; i++) {
+        EXPECT_EQ(0xAA, dst[i]);
+      }
+    }
+  }
+
+  // Sizes below the streaming threshold take the memcpy path; make sure the
+  // dispatch handles them too, including odd lengths.
+  for (size_t len : {size_t(0), size_t(1), size_t(63), size_t(4096)}) {
+    for (size_t i = 0; i < length + slack; i++) {
+      dst[i] = 0xAA;
+    }
+    StreamingMemcpy(dst.get(), src.get(), len);
+    EXPECT_EQ(0, memcmp(dst.get(), src.get(), len));
+    for (size_t i = len; i < length + slack; i++) {
+      EXPECT_EQ(0xAA, dst[i]);
+    }
+  }
+}
+
+// Copy a 4K BGRA frame's worth of data, the case the streaming path exists
+// for, to keep an eye on bulk copy throughput.
+MOZ_GTEST_BENCH(Moz2D, StreamingMemcpyBench, [] {
+  const size_t length = 3840 * 2160 * 4;
+  UniquePtr<uint8_t[]> src = MakeUnique<uint8_t[]>(length);
+  UniquePtr<uint8_t[]> dst = MakeUnique<uint8_t[]>(length);
+  for (size_t i = 0; i < length; i++) {
+    src[i] = uint8_t(i * 31);
+  }
+
+  for (int rep = 0; rep < 20; rep++) {
+    StreamingMemcpy(dst.get(), src.get(), length);
+  }
+});
@@ -176,7 +176,8 @@ void gfxFontCache::Shutdown() {
 }
 
 gfxFontCache::gfxFontCache(nsIEventTarget* aEventTarget)
-    : gfxFontCacheExpirationTracker(aEventTarget) {
+    : gfxFontCacheExpirationTracker(aEventTarget),
+      mWordCacheTimerRunning(false) {
   nsCOMPtr<nsIObserverService> obs = GetObserverService();
   if (obs) {
     obs->AddObserver(new Observer, "memory-pressure", false);
@@ -186,15 +187,12 @@ gfxFontCache::gfxFontCache(nsIEventTarget* aEventTarget)
   // Currently disabled for release builds, due to unexplained crashes
   // during expiration; see bug 717175 & 894798.
   // Bug 1548661: enabled for early beta, to see what crash-stats shows.
-  nsIEventTarget* target = nullptr;
   if (XRE_IsContentProcess() && NS_IsMainThread()) {
-    target = aEventTarget;
+    mWordCacheTimerTarget = aEventTarget;
   }
-  NS_NewTimerWithFuncCallback(getter_AddRefs(mWordCacheExpirationTimer),
-                              WordCacheExpirationTimerCallback, this,
-                              SHAPED_WORD_TIMEOUT_SECONDS * 1000,
-                              nsITimer::TYPE_REPEATING_SLACK,
-                              "gfxFontCache::gfxFontCache", target);
+  // The expiration timer itself is started lazily by
+  // RunWordCacheExpirationTimer() once a shaped word is actually cached,
+  // and stops again when all the word caches have drained.
 #endif
 }
 
@@ -295,8 +293,43 @@ void gfxFontCache::DestroyFont(gfxFont* aFont) {
 void gfxFontCache::WordCacheExpirationTimerCallback(nsITimer* aTimer,
                                                     void* aCache) {
   gfxFontCache* cache = static_cast<gfxFontCache*>(aCache);
+  bool allEmpty = true;
   for (auto it = cache->mFonts.Iter(); !it.Done(); it.Next()) {
-    it.Get()->mFont->AgeCachedWords();
+    allEmpty = it.Get()->mFont->AgeCachedWords() && allEmpty;
+  }
+  if (allEmpty) {
+    // No font has any cached words left; stop ticking until a new word is
+    // added to one of the caches.
+    cache->PauseWordCacheExpirationTimer();
+  }
+}
+
+void gfxFontCache::RunWordCacheExpirationTimer() {
+#ifdef EARLY_BETA_OR_EARLIER
+  if (mWordCacheTimerRunning) {
+    return;
+  }
+  if (mWordCacheExpirationTimer) {
+    mWordCacheExpirationTimer->InitWithNamedFuncCallback(
+        WordCacheExpirationTimerCallback, this,
+        SHAPED_WORD_TIMEOUT_SECONDS * 1000, nsITimer::TYPE_REPEATING_SLACK,
+        "gfxFontCache::WordCacheExpiration");
+  } else {
+    NS_NewTimerWithFuncCallback(getter_AddRefs(mWordCacheExpirationTimer),
+                                WordCacheExpirationTimerCallback, this,
+                                SHAPED_WORD_TIMEOUT_SECONDS * 1000,
+                                nsITimer::TYPE_REPEATING_SLACK,
+                                "gfxFontCache::WordCacheExpiration",
+                                mWordCacheTimerTarget);
+  }
+  mWordCacheTimerRunning = !!mWordCacheExpirationTimer;
+#endif
+}
+
+void gfxFontCache::PauseWordCacheExpirationTimer() {
+  if (mWordCacheTimerRunning && mWordCacheExpirationTimer) {
+    mWordCacheExpirationTimer->Cancel();
+    mWordCacheTimerRunning = false;
   }
 }
 
@@ -304,6 +337,7 @@ void gfxFontCache::FlushShapedWordCaches() {
   for (auto it = mFonts.Iter(); !it.Done(); it.Next()) {
     it.Get()->mFont->ClearCachedWords();
   }
+  PauseWordCacheExpirationTimer();
 }
 
 void gfxFontCache::NotifyGlyphsChanged() {
@@ -2582,18 +2616,20 @@ gfxFont::RunMetrics gfxFont::Measure(const gfxTextRun* aTextRun,
   return metrics;
 }
 
-void gfxFont::AgeCachedWords() {
-  if (mWordCache) {
-    for (auto it = mWordCache->Iter(); !it.Done(); it.Next()) {
-      CacheHashEntry* entry = it.Get();
-      if (!entry->mShapedWord) {
-        NS_ASSERTION(entry->mShapedWord, "cache entry has no gfxShapedWord!");
-        it.Remove();
-      } else if (entry->mShapedWord->IncrementAge() == kShapedWordCacheMaxAge) {
-        it.Remove();
-      }
+bool gfxFont::AgeCachedWords() {
+  if (!mWordCache) {
+    return true;
+  }
+  for (auto it = mWordCache->Iter(); !it.Done(); it.Next()) {
+    CacheHashEntry* entry = it.Get();
+    if (!entry->mShapedWord) {
+      NS_ASSERTION(entry->mShapedWord, "cache entry has no gfxShapedWord!");
+      it.Remove();
+    } else if (entry->mShapedWord->IncrementAge() == kShapedWordCacheMaxAge) {
+      it.Remove();
     }
   }
+  return mWordCache->Count() == 0;
 }
 
 void gfxFont::NotifyGlyphsChanged() {
@@ -2631,12 +2667,23 @@ gfxShapedWord* gfxFont::GetShapedWord(
     Script aRunScript, bool aVertical, int32_t aAppUnitsPerDevUnit,
     gfx::ShapedTextFlags aFlags, RoundingFlags aRounding,
     gfxTextPerfMetrics* aTextPerf GFX_MAYBE_UNUSED) {
-  // if the cache is getting too big, flush it and start over
+  // if the cache is getting too big, first evict the words that have not
+  // been looked up since the last aging pass, so that recently-used words
+  // (which we're likely to need again) survive; flush the whole cache only
+  // if that doesn't get us back under the limit
   uint32_t wordCacheMaxEntries =
       gfxPlatform::GetPlatform()->WordCacheMaxEntries();
   if (mWordCache->Count() > wordCacheMaxEntries) {
-    NS_WARNING("flushing shaped-word cache");
-    ClearCachedWords();
+    for (auto it = mWordCache->Iter(); !it.Done(); it.Next()) {
+      gfxShapedWord* word = it.Get()->mShapedWord.get();
+      if (!word || word->GetAge() != 0) {
+        it.Remove();
+      }
+    }
+    if (mWordCache->Count() > wordCacheMaxEntries) {
+      NS_WARNING("flushing shaped-word cache");
+      ClearCachedWords();
+    }
   }
 
   // if there's a cached entry for this word, just return it
@@ -2674,6 +2721,10 @@ gfxShapedWord* gfxFont::GetShapedWord(
     return nullptr;
   }
 
+  // there's a cached word to age out now, so make sure the expiration timer
+  // is ticking
+  gfxFontCache::GetCache()->RunWordCacheExpirationTimer();
+
   DebugOnly<bool> ok = ShapeText(aDrawTarget, aText, 0, aLength, aRunScript,
                                  aVertical, aRounding, sw);
 
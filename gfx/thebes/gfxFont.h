@@ -334,6 +334,13 @@ class gfxFontCache final : private gfxFontCacheExpirationTracker {
   void FlushShapedWordCaches();
   void NotifyGlyphsChanged();
 
+  // Start the word-cache expiration timer if it is not already running.
+  // Called whenever a shaped word is added to a font's cache, so that the
+  // timer only fires while there are cached words left to age; an idle
+  // process should not keep waking up to age empty caches.
+  void RunWordCacheExpirationTimer();
+  void PauseWordCacheExpirationTimer();
+
   void AddSizeOfExcludingThis(mozilla::MallocSizeOf aMallocSizeOf,
                               FontCacheSizes* aSizes) const;
   void AddSizeOfIncludingThis(mozilla::MallocSizeOf aMallocSizeOf,
@@ -418,6 +425,10 @@ class gfxFontCache final : private gfxFontCacheExpirationTracker {
 
   static void WordCacheExpirationTimerCallback(nsITimer* aTimer, void* aCache);
   nsCOMPtr<nsITimer> mWordCacheExpirationTimer;
+  // event target the expiration timer should fire on (the content process
+  // main thread); null means the default timer target is used
+  nsCOMPtr<nsIEventTarget> mWordCacheTimerTarget;
+  bool mWordCacheTimerRunning;
 };
 
 class gfxTextPerfMetrics {
@@ -1283,6 +1294,7 @@ class gfxShapedWord final : public gfxShapedText {
 
   void ResetAge() { mAgeCounter = 0; }
   uint32_t IncrementAge() { return ++mAgeCounter; }
+  uint32_t GetAge() const { return mAgeCounter; }
 
   // Helper used when hashing a word for the shaped-word caches
   static uint32_t HashMix(uint32_t aHash, char16_t aCh) {
@@ -1770,8 +1782,10 @@ class gfxFont {
   }
 
   // Called by the gfxFontCache timer to increment the age of all the words,
-  // so that they'll expire after a sufficient period of non-use
-  void AgeCachedWords();
+  // so that they'll expire after a sufficient period of non-use.
+  // Returns true if the cache is now empty, so the caller can stop the
+  // timer once no font has any words left to age.
+  bool AgeCachedWords();
 
   // Discard all cached word records; called on memory-pressure notification.
   void ClearCachedWords() {
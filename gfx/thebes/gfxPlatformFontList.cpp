@@ -415,6 +415,10 @@ nsresult gfxPlatformFontList::InitFontList() {
   mCodepointsWithNoFonts.SetRange(0, 0x1f);     // C0 controls
   mCodepointsWithNoFonts.SetRange(0x7f, 0x9f);  // C1 controls
 
+  // dump any cached fallback families, as they may point into the old list
+  mFallbackFamilyCache.Clear();
+  mReplacementCharFallbackFamily = FontFamily();
+
   sPlatformFontList = this;
 
   // Try to initialize the cross-process shared font list if enabled by prefs,
@@ -715,20 +719,7 @@ gfxFontEntry* gfxPlatformFontList::SystemFindFontForChar(
   // This helps speed up pages with lots of encoding errors, binary-as-text,
   // etc.
   if (aCh == 0xFFFD) {
-    if (mReplacementCharFallbackFamily.mIsShared &&
-        mReplacementCharFallbackFamily.mShared) {
-      fontlist::Face* face =
-          mReplacementCharFallbackFamily.mShared->FindFaceForStyle(
-              SharedFontList(), *aStyle);
-      if (face) {
-        fontEntry =
-            GetOrCreateFontEntry(face, mReplacementCharFallbackFamily.mShared);
-      }
-    } else if (!mReplacementCharFallbackFamily.mIsShared &&
-               mReplacementCharFallbackFamily.mUnshared) {
-      fontEntry =
-          mReplacementCharFallbackFamily.mUnshared->FindFontForStyle(*aStyle);
-    }
+    fontEntry = FindFontEntryForStyle(mReplacementCharFallbackFamily, *aStyle);
 
     // this should never fail, as we must have found U+FFFD in order to set
     // mReplacementCharFallbackFamily at all, but better play it safe
@@ -749,8 +740,26 @@ gfxFontEntry* gfxPlatformFontList::SystemFindFontForChar(
   uint32_t cmapCount = 0;
   if (!fontEntry) {
     common = false;
-    fontEntry =
-        GlobalFontFallback(aCh, aRunScript, aStyle, cmapCount, &fallbackFamily);
+
+    // before scanning the cmaps of every installed family, check whether a
+    // previous system-wide fallback for this codepoint already identified a
+    // family that covers it
+    FontFamily cachedFamily;
+    if (mFallbackFamilyCache.Get(aCh, &cachedFamily)) {
+      gfxFontEntry* fe = FindFontEntryForStyle(cachedFamily, *aStyle);
+      if (fe && fe->HasCharacter(aCh)) {
+        fontEntry = fe;
+        fallbackFamily = cachedFamily;
+      }
+    }
+
+    if (!fontEntry) {
+      fontEntry = GlobalFontFallback(aCh, aRunScript, aStyle, cmapCount,
+                                     &fallbackFamily);
+      if (fontEntry) {
+        mFallbackFamilyCache.Put(aCh, fallbackFamily);
+      }
+    }
   }
   TimeDuration elapsed = TimeStamp::Now() - start;
 
@@ -791,6 +800,19 @@ gfxFontEntry* gfxPlatformFontList::SystemFindFontForChar(
   return fontEntry;
 }
 
+gfxFontEntry* gfxPlatformFontList::FindFontEntryForStyle(
+    const FontFamily& aFamily, const gfxFontStyle& aStyle) {
+  if (aFamily.mIsShared && aFamily.mShared) {
+    fontlist::Face* face =
+        aFamily.mShared->FindFaceForStyle(SharedFontList(), aStyle);
+    return face ? GetOrCreateFontEntry(face, aFamily.mShared) : nullptr;
+  }
+  if (!aFamily.mIsShared && aFamily.mUnshared) {
+    return aFamily.mUnshared->FindFontForStyle(aStyle);
+  }
+  return nullptr;
+}
+
 #define NUM_FALLBACK_FONTS 8
 
 gfxFontEntry* gfxPlatformFontList::CommonFontFallback(
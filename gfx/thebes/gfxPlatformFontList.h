@@ -573,6 +573,11 @@ class gfxPlatformFontList : public gfxFontInfoLoader {
                                    uint32_t& aCmapCount,
                                    FontFamily* aMatchedFamily);
 
+  // Resolve the face in aFamily that best matches aStyle to a font entry;
+  // returns null if the family has no usable faces.
+  gfxFontEntry* FindFontEntryForStyle(const FontFamily& aFamily,
+                                      const gfxFontStyle& aStyle);
+
   // Platform-specific implementation of global font fallback, if any;
   // this may return nullptr in which case the default cmap-based fallback
   // will be performed.
@@ -751,6 +756,11 @@ class gfxPlatformFontList : public gfxFontInfoLoader {
   // on pages with lots of problems
   FontFamily mReplacementCharFallbackFamily;
 
+  // cache of system-wide fallback lookups, so that a page full of characters
+  // outside the common fallback fonts (e.g. CJK text on a western install)
+  // only pays for the full cmap search once per codepoint
+  nsDataHashtable<nsUint32HashKey, FontFamily> mFallbackFamilyCache;
+
   // Sorted array of lowercased family names; use ContainsSorted to test
   nsTArray<nsCString> mBadUnderlineFamilyNames;
 
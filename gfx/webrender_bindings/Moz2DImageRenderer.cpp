@@ -405,6 +405,13 @@ static bool Moz2DRenderCallback(const Range<const uint8_t> aBlob,
   bool ret = true;
   size_t offset = 0;
   auto absBounds = IntRectAbsolute::FromRect(bounds);
+
+  // Scaled fonts live in a process-global table guarded by a static mutex
+  // that all the blob rasterization workers contend on, and the same font
+  // instances tend to recur in item after item of a blob. Resolve each key
+  // through the global table only once per callback and reuse the result,
+  // so that parallel workers don't serialize on the table lock.
+  std::unordered_map<WrFontInstanceKey, RefPtr<ScaledFont>> scaledFonts;
   while (reader.pos < reader.len) {
     size_t end = reader.ReadSize();
     size_t extra_end = reader.ReadSize();
@@ -422,8 +429,10 @@ static bool Moz2DRenderCallback(const Range<const uint8_t> aBlob,
     size_t count = fontReader.ReadSize();
     for (size_t i = 0; i < count; i++) {
       layers::BlobFont blobFont = fontReader.ReadBlobFont();
-      RefPtr<ScaledFont> scaledFont =
-          GetScaledFont(&translator, blobFont.mFontInstanceKey);
+      RefPtr<ScaledFont>& scaledFont = scaledFonts[blobFont.mFontInstanceKey];
+      if (!scaledFont) {
+        scaledFont = GetScaledFont(&translator, blobFont.mFontInstanceKey);
+      }
       translator.AddScaledFont(blobFont.mScaledFontPtr, scaledFont);
     }
 
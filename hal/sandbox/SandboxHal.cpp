@@ -13,9 +13,12 @@
 #include "mozilla/dom/BrowserChild.h"
 #include "mozilla/fallback/FallbackScreenConfiguration.h"
 #include "mozilla/EnumeratedRange.h"
+#include "mozilla/Maybe.h"
 #include "mozilla/Observer.h"
+#include "mozilla/TimeStamp.h"
 #include "mozilla/Unused.h"
 #include "nsAutoPtr.h"
+#include "nsITimer.h"
 #include "WindowIdentifier.h"
 
 using namespace mozilla;
@@ -161,6 +164,10 @@ class HalParent : public PHalParent,
       hal::UnregisterSensorObserver(sensor, this);
     }
     hal::UnregisterWakeLockObserver(this);
+    if (mSensorFlushTimer) {
+      mSensorFlushTimer->Cancel();
+      mSensorFlushTimer = nullptr;
+    }
   }
 
   virtual mozilla::ipc::IPCResult RecvVibrate(
@@ -280,7 +287,29 @@ class HalParent : public PHalParent,
   }
 
   void Notify(const SensorData& aSensorData) override {
-    Unused << SendNotifySensorChange(aSensorData);
+    // High-rate sensors (gyroscope, accelerometer) can produce hundreds of
+    // samples per second, and every message here becomes a separate
+    // main-thread task in the content process. Forward a sample immediately
+    // when the coalescing window for its type has passed; otherwise keep only
+    // the newest sample and flush it when the window closes.
+    SensorType sensor = aSensorData.sensor();
+    TimeStamp now = TimeStamp::Now();
+    TimeStamp& last = mLastSensorNotify[sensor];
+    if (last.IsNull() ||
+        now - last >=
+            TimeDuration::FromMilliseconds(kSensorCoalesceWindowMs)) {
+      last = now;
+      mPendingSensorData[sensor].reset();
+      Unused << SendNotifySensorChange(aSensorData);
+      return;
+    }
+    mPendingSensorData[sensor] = Some(aSensorData);
+    if (!mSensorFlushTimer) {
+      NS_NewTimerWithFuncCallback(
+          getter_AddRefs(mSensorFlushTimer), FlushPendingSensorDataCallback,
+          this, kSensorCoalesceWindowMs, nsITimer::TYPE_ONE_SHOT,
+          "hal_sandbox::HalParent::FlushPendingSensorData");
+    }
   }
 
   virtual mozilla::ipc::IPCResult RecvModifyWakeLock(
@@ -314,6 +343,36 @@ class HalParent : public PHalParent,
   void Notify(const WakeLockInformation& aWakeLockInfo) override {
     Unused << SendNotifyWakeLockChange(aWakeLockInfo);
   }
+
+ private:
+  // Caps sensor notifications at 100Hz per type, which is still well above
+  // the rate at which DOM sensor events reach pages.
+  static const uint32_t kSensorCoalesceWindowMs = 10;
+
+  static void FlushPendingSensorDataCallback(nsITimer* aTimer,
+                                             void* aClosure) {
+    static_cast<HalParent*>(aClosure)->FlushPendingSensorData();
+  }
+
+  void FlushPendingSensorData() {
+    mSensorFlushTimer = nullptr;
+    TimeStamp now = TimeStamp::Now();
+    for (auto sensor : MakeEnumeratedRange(NUM_SENSOR_TYPE)) {
+      if (mPendingSensorData[sensor]) {
+        mLastSensorNotify[sensor] = now;
+        Unused << SendNotifySensorChange(mPendingSensorData[sensor].ref());
+        mPendingSensorData[sensor].reset();
+      }
+    }
+  }
+
+  // The newest sample of each type received inside its coalescing window,
+  // waiting for the flush timer. The timer is only armed while at least one
+  // sample is pending, and is cancelled in ActorDestroy() since the callback
+  // holds a raw pointer to us.
+  Maybe<SensorData> mPendingSensorData[NUM_SENSOR_TYPE];
+  TimeStamp mLastSensorNotify[NUM_SENSOR_TYPE];
+  nsCOMPtr<nsITimer> mSensorFlushTimer;
 };
 
 class HalChild : public PHalChild {
@@ -75,9 +75,11 @@ class AnimationSurfaceProvider final : public ISurfaceProvider,
   void Run() override;
   bool ShouldPreferSyncRun() const override;
 
-  // Full decodes are low priority compared to metadata decodes because they
-  // don't block layout or page load.
-  TaskPriority Priority() const override { return TaskPriority::eLow; }
+  // Full decodes are usually low priority compared to metadata decodes
+  // because they don't block layout or page load, but decodes that the caller
+  // marked as needed for something visible jump ahead of speculative decodes
+  // of offscreen images.
+  TaskPriority Priority() const override { return mTaskPriority; }
 
   //////////////////////////////////////////////////////////////////////////////
   // IDecoderFrameRecycler implementation.
@@ -114,6 +116,10 @@ class AnimationSurfaceProvider final : public ISurfaceProvider,
 
   /// The frames of this animation, in order.
   UniquePtr<AnimationFrameBuffer> mFrames;
+
+  /// Our scheduling priority, captured from the decoder's flags at
+  /// construction since mDecoder is dropped once decoding finishes.
+  TaskPriority mTaskPriority;
 };
 
 }  // namespace image
@@ -51,9 +51,11 @@ class DecodedSurfaceProvider final : public ISurfaceProvider,
   void Run() override;
   bool ShouldPreferSyncRun() const override;
 
-  // Full decodes are low priority compared to metadata decodes because they
-  // don't block layout or page load.
-  TaskPriority Priority() const override { return TaskPriority::eLow; }
+  // Full decodes are usually low priority compared to metadata decodes
+  // because they don't block layout or page load, but decodes that the caller
+  // marked as needed for something visible jump ahead of speculative decodes
+  // of offscreen images.
+  TaskPriority Priority() const override { return mTaskPriority; }
 
  private:
   virtual ~DecodedSurfaceProvider();
@@ -76,6 +78,10 @@ class DecodedSurfaceProvider final : public ISurfaceProvider,
 
   /// A drawable reference to our service; used for locking.
   DrawableFrameRef mLockRef;
+
+  /// Our scheduling priority, captured from the decoder's flags at
+  /// construction since mDecoder is dropped once decoding finishes.
+  TaskPriority mTaskPriority;
 };
 
 }  // namespace image
@@ -31,6 +31,13 @@ enum class DecoderFlags : uint8_t {
    * set.
    */
   CANNOT_SUBSTITUTE = 1 << 4,
+
+  /**
+   * The caller needs the surface for something currently visible, so the
+   * decode should be scheduled ahead of decodes for offscreen images. This
+   * determines which DecodePool queue the decoding task lands in.
+   */
+  HIGH_PRIORITY = 1 << 5,
 };
 MOZ_MAKE_ENUM_CLASS_BITWISE_OPERATORS(DecoderFlags)
 
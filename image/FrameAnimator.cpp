@@ -354,6 +354,19 @@ RefreshResult FrameAnimator::RequestRefresh(AnimationState& aState,
     return ret;
   }
 
+  // If nothing has accessed the composited frame since the last time we
+  // advanced, then there is no point in continuing to advance the animation.
+  // This has the effect of freezing the animation while not in view, and it
+  // also means we don't need to look up our surfaces; that matters when many
+  // animated images are offscreen, since the lookup takes the surface cache
+  // lock and bumps the surfaces in its cost tracking on every refresh tick.
+  // Our animation state is kept up to date by the decode and discard
+  // notifications, so skipping the lookup here doesn't let it go stale.
+  if (!aState.mCompositedFrameRequested &&
+      aState.MaybeAdvanceAnimationFrameTime(aTime)) {
+    return ret;
+  }
+
   // Get the animation frames once now, and pass them down to callees because
   // the surface could be discarded at anytime on a different thread. This is
   // must easier to reason about then trying to write code that is safe to
@@ -392,14 +405,6 @@ RefreshResult FrameAnimator::RequestRefresh(AnimationState& aState,
   TimeStamp currentFrameEndTime =
       GetCurrentImgFrameEndTime(aState, currentFrame->GetTimeout());
 
-  // If nothing has accessed the composited frame since the last time we
-  // advanced, then there is no point in continuing to advance the animation.
-  // This has the effect of freezing the animation while not in view.
-  if (!aState.mCompositedFrameRequested &&
-      aState.MaybeAdvanceAnimationFrameTime(aTime)) {
-    return ret;
-  }
-
   while (currentFrameEndTime <= aTime) {
     TimeStamp oldFrameEndTime = currentFrameEndTime;
 
@@ -1195,6 +1195,9 @@ bool RasterImage::Decode(const IntSize& aSize, uint32_t aFlags,
   if (mHasBeenDecoded) {
     decoderFlags |= DecoderFlags::IS_REDECODE;
   }
+  if (aFlags & FLAG_HIGH_PRIORITY) {
+    decoderFlags |= DecoderFlags::HIGH_PRIORITY;
+  }
   if ((aFlags & FLAG_SYNC_DECODE) || !(aFlags & FLAG_HIGH_QUALITY_SCALING)) {
     // Used SurfaceCache::Lookup instead of SurfaceCache::LookupBestMatch. That
     // means the caller can handle a differently sized surface to be returned
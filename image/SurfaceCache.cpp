@@ -5,6 +5,17 @@
 
 /**
  * SurfaceCache is a service for caching temporary surfaces in imagelib.
+ *
+ * Note that the cache is strictly process-local: every content process that
+ * loads a given image decodes and caches its own copy of the surfaces, even
+ * though decoded frames are already immutable once finalized (see
+ * SourceSurfaceSharedData) and are mapped read-only into the compositor.
+ * Deduplicating those surfaces across content processes would require a
+ * parent-brokered cache keyed by something equivalent to the image load --
+ * URI, decode size and surface flags -- together with a story for cache
+ * poisoning between origins and for invalidation, none of which exists
+ * today. Until then the per-process memory cost is bounded only by
+ * SurfaceCacheSize() below.
  */
 
 #include "SurfaceCache.h"
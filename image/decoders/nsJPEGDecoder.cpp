@@ -382,10 +382,12 @@ LexerTransition<nsJPEGDecoder::State> nsJPEGDecoder::ReadJPEGData(
                 " JPEG_START_DECOMPRESS case");
       // Step 4: set parameters for decompression
 
-      // FIXME -- Should reset dct_method and dither mode
-      // for final pass of progressive JPEG
-
-      mInfo.dct_method = JDCT_ISLOW;
+      // Intermediate passes of a progressive image are only displayed until
+      // the next scan arrives, so decode them with the fast (less accurate)
+      // IDCT and save the full-quality IDCT for the final pass. libjpeg
+      // re-reads dct_method at the start of each output pass, so we can
+      // switch back below once we know a pass is the last one.
+      mInfo.dct_method = mInfo.buffered_image ? JDCT_IFAST : JDCT_ISLOW;
       mInfo.dither_mode = JDITHER_FS;
       mInfo.do_fancy_upsampling = TRUE;
       mInfo.enable_2pass_quant = FALSE;
@@ -454,6 +456,14 @@ LexerTransition<nsJPEGDecoder::State> nsJPEGDecoder::ReadJPEGData(
                 (status != JPEG_REACHED_EOI))
               scan--;
 
+            // Once the input is complete the pass we're starting is the one
+            // that will be displayed until the image is thrown away, so
+            // render it with the full-quality IDCT rather than the fast one
+            // we use for intermediate passes.
+            if (jpeg_input_complete(&mInfo)) {
+              mInfo.dct_method = JDCT_ISLOW;
+            }
+
             if (!jpeg_start_output(&mInfo, scan)) {
               MOZ_LOG(sJPEGDecoderAccountingLog, LogLevel::Debug,
                       ("} (I/O suspension after jpeg_start_output() -"
@@ -493,7 +503,15 @@ LexerTransition<nsJPEGDecoder::State> nsJPEGDecoder::ReadJPEGData(
 
               if (jpeg_input_complete(&mInfo) &&
                   (mInfo.input_scan_number == mInfo.output_scan_number)) {
-                mState = JPEG_DONE;
+                if (mInfo.dct_method != JDCT_ISLOW) {
+                  // The input only became complete while this pass was in
+                  // flight, so it was decoded with the fast IDCT. Render the
+                  // final scan once more at full quality.
+                  mInfo.output_scanline = 0;
+                  mPipe.ResetToFirstRow();
+                } else {
+                  mState = JPEG_DONE;
+                }
               } else {
                 mInfo.output_scanline = 0;
                 mPipe.ResetToFirstRow();
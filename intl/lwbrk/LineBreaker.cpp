@@ -433,95 +433,103 @@ static int8_t GetClass(uint32_t u, LineBreaker::Strictness aLevel,
   static_assert(U_LB_COUNT == mozilla::ArrayLength(sUnicodeLineBreakToClass),
                 "Gecko vs ICU LineBreak class mismatch");
 
-  auto cls = GetLineBreakClass(u);
-  MOZ_ASSERT(cls < mozilla::ArrayLength(sUnicodeLineBreakToClass));
-
   // Overrides based on rules for the different line-break values given in
   // https://drafts.csswg.org/css-text-3/#line-break-property
-  switch (aLevel) {
-    case LineBreaker::Strictness::Auto:
-      // For now, just use legacy Gecko behavior.
-      // XXX Possible enhancement - vary strictness according to line width
-      // or other criteria.
-      break;
-    case LineBreaker::Strictness::Strict:
-      if (cls == U_LB_CONDITIONAL_JAPANESE_STARTER ||
-          (u == 0x3095 || u == 0x3096 || u == 0x30f5 || u == 0x30f6)) {
-        return CLASS_CLOSE;
-      }
-      if (cls == U_LB_INSEPARABLE) {
-        return CLASS_NON_BREAKABLE_BETWEEN_SAME_CLASS;
-      }
-      if (u == 0x3005 || u == 0x303B || u == 0x309D || u == 0x309E ||
-          u == 0x30FD || u == 0x30FE) {
-        return CLASS_CLOSE_LIKE_CHARACTER;
-      }
-      if (aIsChineseOrJapanese) {
-        if (cls == U_LB_POSTFIX_NUMERIC && IsEastAsianWidthAFW(u)) {
-          return CLASS_CLOSE_LIKE_CHARACTER;
+  //
+  // For Strictness::Auto (the common case) we just use legacy Gecko
+  // behavior, so the Unicode line-break class is only looked up — it's an
+  // ICU property query per character — when one of the explicit line-break
+  // values is in effect or when we fall off the end of the range tables
+  // below.
+  // XXX Possible enhancement - vary strictness according to line width
+  // or other criteria.
+  if (aLevel != LineBreaker::Strictness::Auto) {
+    auto cls = GetLineBreakClass(u);
+    MOZ_ASSERT(cls < mozilla::ArrayLength(sUnicodeLineBreakToClass));
+
+    switch (aLevel) {
+      case LineBreaker::Strictness::Auto:
+        MOZ_ASSERT_UNREACHABLE("handled above");
+        break;
+      case LineBreaker::Strictness::Strict:
+        if (cls == U_LB_CONDITIONAL_JAPANESE_STARTER ||
+            (u == 0x3095 || u == 0x3096 || u == 0x30f5 || u == 0x30f6)) {
+          return CLASS_CLOSE;
         }
-        if (cls == U_LB_PREFIX_NUMERIC && IsEastAsianWidthAFW(u)) {
-          return CLASS_OPEN_LIKE_CHARACTER;
+        if (cls == U_LB_INSEPARABLE) {
+          return CLASS_NON_BREAKABLE_BETWEEN_SAME_CLASS;
         }
-        if (u == 0x2010 || u == 0x2013 || u == 0x301C || u == 0x30A0) {
+        if (u == 0x3005 || u == 0x303B || u == 0x309D || u == 0x309E ||
+            u == 0x30FD || u == 0x30FE) {
           return CLASS_CLOSE_LIKE_CHARACTER;
         }
-      }
-      break;
-    case LineBreaker::Strictness::Normal:
-      if (cls == U_LB_CONDITIONAL_JAPANESE_STARTER) {
-        return CLASS_BREAKABLE;
-      }
-      if (cls == U_LB_INSEPARABLE) {
-        return CLASS_NON_BREAKABLE_BETWEEN_SAME_CLASS;
-      }
-      if (u == 0x3005 || u == 0x303B || u == 0x309D || u == 0x309E ||
-          u == 0x30FD || u == 0x30FE) {
-        return CLASS_CLOSE_LIKE_CHARACTER;
-      }
-      if (aIsChineseOrJapanese) {
-        if (cls == U_LB_POSTFIX_NUMERIC && IsEastAsianWidthAFW(u)) {
-          return CLASS_CLOSE_LIKE_CHARACTER;
-        }
-        if (cls == U_LB_PREFIX_NUMERIC && IsEastAsianWidthAFW(u)) {
-          return CLASS_OPEN_LIKE_CHARACTER;
+        if (aIsChineseOrJapanese) {
+          if (cls == U_LB_POSTFIX_NUMERIC && IsEastAsianWidthAFW(u)) {
+            return CLASS_CLOSE_LIKE_CHARACTER;
+          }
+          if (cls == U_LB_PREFIX_NUMERIC && IsEastAsianWidthAFW(u)) {
+            return CLASS_OPEN_LIKE_CHARACTER;
+          }
+          if (u == 0x2010 || u == 0x2013 || u == 0x301C || u == 0x30A0) {
+            return CLASS_CLOSE_LIKE_CHARACTER;
+          }
         }
-        if (u == 0x2010 || u == 0x2013 || u == 0x301C || u == 0x30A0) {
+        break;
+      case LineBreaker::Strictness::Normal:
+        if (cls == U_LB_CONDITIONAL_JAPANESE_STARTER) {
           return CLASS_BREAKABLE;
         }
-      }
-      break;
-    case LineBreaker::Strictness::Loose:
-      if (cls == U_LB_CONDITIONAL_JAPANESE_STARTER) {
-        return CLASS_BREAKABLE;
-      }
-      if (u == 0x3005 || u == 0x303B || u == 0x309D || u == 0x309E ||
-          u == 0x30FD || u == 0x30FE) {
-        return CLASS_BREAKABLE;
-      }
-      if (cls == U_LB_INSEPARABLE) {
-        return CLASS_BREAKABLE;
-      }
-      if (aIsChineseOrJapanese) {
-        if (u == 0x30FB || u == 0xFF1A || u == 0xFF1B || u == 0xFF65 ||
-            u == 0x203C || u == 0x2047 || u == 0x2048 || u == 0x2049 ||
-            u == 0xFF01 || u == 0xFF1F) {
-          return CLASS_BREAKABLE;
+        if (cls == U_LB_INSEPARABLE) {
+          return CLASS_NON_BREAKABLE_BETWEEN_SAME_CLASS;
         }
-        if (cls == U_LB_POSTFIX_NUMERIC && IsEastAsianWidthAFW(u)) {
+        if (u == 0x3005 || u == 0x303B || u == 0x309D || u == 0x309E ||
+            u == 0x30FD || u == 0x30FE) {
+          return CLASS_CLOSE_LIKE_CHARACTER;
+        }
+        if (aIsChineseOrJapanese) {
+          if (cls == U_LB_POSTFIX_NUMERIC && IsEastAsianWidthAFW(u)) {
+            return CLASS_CLOSE_LIKE_CHARACTER;
+          }
+          if (cls == U_LB_PREFIX_NUMERIC && IsEastAsianWidthAFW(u)) {
+            return CLASS_OPEN_LIKE_CHARACTER;
+          }
+          if (u == 0x2010 || u == 0x2013 || u == 0x301C || u == 0x30A0) {
+            return CLASS_BREAKABLE;
+          }
+        }
+        break;
+      case LineBreaker::Strictness::Loose:
+        if (cls == U_LB_CONDITIONAL_JAPANESE_STARTER) {
           return CLASS_BREAKABLE;
         }
-        if (cls == U_LB_PREFIX_NUMERIC && IsEastAsianWidthAFW(u)) {
+        if (u == 0x3005 || u == 0x303B || u == 0x309D || u == 0x309E ||
+            u == 0x30FD || u == 0x30FE) {
           return CLASS_BREAKABLE;
         }
-        if (u == 0x2010 || u == 0x2013 || u == 0x301C || u == 0x30A0) {
+        if (cls == U_LB_INSEPARABLE) {
           return CLASS_BREAKABLE;
         }
-      }
-      break;
-    case LineBreaker::Strictness::Anywhere:
-      MOZ_ASSERT_UNREACHABLE("should have been handled already");
-      break;
+        if (aIsChineseOrJapanese) {
+          if (u == 0x30FB || u == 0xFF1A || u == 0xFF1B || u == 0xFF65 ||
+              u == 0x203C || u == 0x2047 || u == 0x2048 || u == 0x2049 ||
+              u == 0xFF01 || u == 0xFF1F) {
+            return CLASS_BREAKABLE;
+          }
+          if (cls == U_LB_POSTFIX_NUMERIC && IsEastAsianWidthAFW(u)) {
+            return CLASS_BREAKABLE;
+          }
+          if (cls == U_LB_PREFIX_NUMERIC && IsEastAsianWidthAFW(u)) {
+            return CLASS_BREAKABLE;
+          }
+          if (u == 0x2010 || u == 0x2013 || u == 0x301C || u == 0x30A0) {
+            return CLASS_BREAKABLE;
+          }
+        }
+        break;
+      case LineBreaker::Strictness::Anywhere:
+        MOZ_ASSERT_UNREACHABLE("should have been handled already");
+        break;
+    }
   }
 
   if (u < 0x10000) {
@@ -621,6 +629,10 @@ static int8_t GetClass(uint32_t u, LineBreaker::Strictness aLevel,
     }
   }
 
+  // Not covered by the range tables above; fall back to mapping the
+  // Unicode line-break class.
+  auto cls = GetLineBreakClass(u);
+  MOZ_ASSERT(cls < mozilla::ArrayLength(sUnicodeLineBreakToClass));
   return sUnicodeLineBreakToClass[cls];
 }
 
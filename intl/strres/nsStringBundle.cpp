@@ -499,24 +499,14 @@ nsresult SharedStringBundle::LoadProperties() {
 
   SharedStringMapBuilder builder;
 
-  nsCOMPtr<nsISimpleEnumerator> iter;
-  MOZ_TRY(props->Enumerate(getter_AddRefs(iter)));
-  bool hasMore;
-  while (NS_SUCCEEDED(iter->HasMoreElements(&hasMore)) && hasMore) {
-    nsCOMPtr<nsISupports> next;
-    MOZ_TRY(iter->GetNext(getter_AddRefs(next)));
-
-    nsresult rv;
-    nsCOMPtr<nsIPropertyElement> elem = do_QueryInterface(next, &rv);
-    MOZ_TRY(rv);
-
-    nsCString key;
-    nsString value;
-    MOZ_TRY(elem->GetKey(key));
-    MOZ_TRY(elem->GetValue(value));
-
-    builder.Add(key, value);
-  }
+  // ParseProperties() always gives us an nsPersistentProperties (see
+  // nsStringBundleBase::ParseProperties), so step through its entries
+  // directly rather than paying for a property element allocation, a
+  // QueryInterface and two string copies per entry via the XPCOM enumerator.
+  static_cast<nsPersistentProperties*>(props.get())
+      ->EnumerateEntries([&](const nsCString& aKey, const nsString& aValue) {
+        builder.Add(aKey, aValue);
+      });
 
   mStringMap = new SharedStringMap(std::move(builder));
 
@@ -4,6 +4,7 @@
  * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
 
 #include "nsUnicharUtils.h"
+#include "nsReadableUtils.h"
 #include "nsUTF8Utils.h"
 #include "nsUnicodeProperties.h"
 #include "mozilla/Likely.h"
@@ -185,6 +186,13 @@ int32_t nsASCIICaseInsensitiveStringComparator::operator()(
 uint32_t ToLowerCase(uint32_t aChar) { return ToLowerCase_inline(aChar); }
 
 void ToLowerCase(const char16_t* aIn, char16_t* aOut, uint32_t aLen) {
+  // ASCII is the common case for many callers and needs neither the
+  // surrogate handling nor the case mapping tables below. IsASCII() is
+  // SIMD-accelerated and the plain ASCII loop is vectorizable.
+  if (IsASCII(mozilla::MakeSpan(aIn, aLen))) {
+    ToLowerCaseASCII(aIn, aOut, aLen);
+    return;
+  }
   for (uint32_t i = 0; i < aLen; i++) {
     uint32_t ch = aIn[i];
     if (NS_IS_HIGH_SURROGATE(ch) && i < aLen - 1 &&
@@ -218,6 +226,14 @@ uint32_t ToUpperCase(uint32_t aChar) {
 }
 
 void ToUpperCase(const char16_t* aIn, char16_t* aOut, uint32_t aLen) {
+  // See the equivalent fast path in ToLowerCase() above.
+  if (IsASCII(mozilla::MakeSpan(aIn, aLen))) {
+    for (uint32_t i = 0; i < aLen; i++) {
+      char16_t ch = aIn[i];
+      aOut[i] = IS_ASCII_LOWER(ch) ? (ch - 0x20) : ch;
+    }
+    return;
+  }
   for (uint32_t i = 0; i < aLen; i++) {
     uint32_t ch = aIn[i];
     if (NS_IS_HIGH_SURROGATE(ch) && i < aLen - 1 &&
@@ -48,6 +48,11 @@ static const size_t kMaxIOVecSize = 256;
 static const size_t kMaxIOVecSize = 16;
 #endif
 
+// Maximum size of a single read when a large message is in flight. Reading
+// the remainder of an oversized payload in chunks of this size instead of
+// kReadBufferSize keeps the syscall count proportionate to the payload.
+static const size_t kMaxLargeReadSize = 1024 * 1024;
+
 #ifdef MOZ_TASK_TRACER
 #  include "GeckoTaskTracerImpl.h"
 using namespace mozilla::tasktracer;
@@ -233,6 +238,7 @@ void Channel::ChannelImpl::Init(Mode mode, Listener* listener) {
 
   mode_ = mode;
   is_blocked_on_write_ = false;
+  flush_task_pending_ = false;
   partial_write_iter_.reset();
   input_buf_offset_ = 0;
   server_listen_pipe_ = -1;
@@ -343,8 +349,32 @@ bool Channel::ChannelImpl::ProcessIncomingMessages() {
 
     // In some cases the beginning of a message will be stored in input_buf_. We
     // don't want to overwrite that, so we store the new data after it.
-    iov.iov_base = input_buf_ + input_buf_offset_;
-    iov.iov_len = Channel::kReadBufferSize - input_buf_offset_;
+    char* read_buf = input_buf_ + input_buf_offset_;
+    size_t read_buf_len = Channel::kReadBufferSize - input_buf_offset_;
+
+    // If we're in the middle of receiving a message larger than the input
+    // buffer, read the remainder in large chunks through a scratch buffer
+    // instead of kReadBufferSize bytes at a time.
+    mozilla::UniquePtr<char[]> large_read_buf;
+    if (incoming_message_.isSome()) {
+      // Once part of a message is in incoming_message_, nothing is left
+      // behind in input_buf_.
+      MOZ_ASSERT(input_buf_offset_ == 0);
+      uint32_t remaining =
+          incoming_message_.ref().size() - incoming_message_.ref().CurrentSize();
+      if (remaining > read_buf_len) {
+        // One extra kReadBufferSize so that messages arriving right behind
+        // the large one can be picked up by the same read.
+        size_t len = std::min(size_t(remaining) + Channel::kReadBufferSize,
+                              kMaxLargeReadSize);
+        large_read_buf = mozilla::MakeUnique<char[]>(len);
+        read_buf = large_read_buf.get();
+        read_buf_len = len;
+      }
+    }
+
+    iov.iov_base = read_buf;
+    iov.iov_len = read_buf_len;
 
     // Read from pipe.
     // recvmsg() returns 0 if the connection has closed or EAGAIN if no data
@@ -414,9 +444,17 @@ bool Channel::ChannelImpl::ProcessIncomingMessages() {
       }
     }
 
-    // Process messages from input buffer.
-    const char* p = input_buf_;
-    const char* end = input_buf_ + input_buf_offset_ + bytes_read;
+    // Process messages from input buffer (or the scratch buffer, which never
+    // has a retained prefix from an earlier read).
+    const char* p;
+    const char* end;
+    if (large_read_buf) {
+      p = large_read_buf.get();
+      end = p + bytes_read;
+    } else {
+      p = input_buf_;
+      end = input_buf_ + input_buf_offset_ + bytes_read;
+    }
 
     // A pointer to an array of |num_fds| file descriptors which includes any
     // fds that have spilled over from a previous read.
@@ -657,6 +695,13 @@ bool Channel::ChannelImpl::ProcessOutgoingMessages() {
     size_t iov_count = 0;
     size_t amt_to_write = 0;
 
+    // Bytes expected to be written for each message of this batch, in queue
+    // order. Every batched message occupies at least one iovec slot, so the
+    // batch can never hold more than kMaxIOVecSize messages.
+    size_t batch_bytes[kMaxIOVecSize];
+    size_t batch_count = 0;
+    bool iov_full = false;
+
     // How much of this message have we written so far?
     Pickle::BufferList::IterImpl iter = partial_write_iter_.value();
 
@@ -678,10 +723,58 @@ bool Channel::ChannelImpl::ProcessOutgoingMessages() {
         iov[iov_count].iov_base = data;
         iov[iov_count].iov_len = size;
         iov_count++;
+      } else {
+        // The overflow bytes are counted in amt_to_write but not placed in
+        // the iovec; the resulting short write makes us resume from the
+        // partial-write iterator on the next call.
+        iov_full = true;
       }
       amt_to_write += size;
       iter.Advance(msg->Buffers(), size);
     }
+    batch_bytes[batch_count++] = amt_to_write;
+
+    // Coalesce as many of the following queued messages as fit entirely into
+    // the remaining iovec slots, so that a burst of small messages costs a
+    // single sendmsg() instead of one each. Only the first message of a
+    // write may carry file descriptors, since the attached control data
+    // describes the write as a whole, so don't batch onto an fd-carrying
+    // message nor past one.
+    if (!iov_full && msg->file_descriptor_set()->empty()) {
+      for (size_t i = 1;
+           i < output_queue_.size() && iov_count < kMaxIOVecSize; i++) {
+        Message* next = output_queue_[i];
+        if (!next->file_descriptor_set()->empty()) {
+          break;
+        }
+
+        size_t first_iov = iov_count;
+        size_t next_bytes = 0;
+        bool fits = true;
+        Pickle::BufferList::IterImpl next_iter(next->Buffers());
+        while (!next_iter.Done()) {
+          if (iov_count == kMaxIOVecSize) {
+            fits = false;
+            break;
+          }
+          char* data = next_iter.Data();
+          size_t size = next_iter.RemainingInSegment();
+          iov[iov_count].iov_base = data;
+          iov[iov_count].iov_len = size;
+          iov_count++;
+          next_bytes += size;
+          next_iter.Advance(next->Buffers(), size);
+        }
+        if (!fits) {
+          // Roll back this message's slots; a partially-included message
+          // would complicate the write accounting below for no benefit.
+          iov_count = first_iov;
+          break;
+        }
+        amt_to_write += next_bytes;
+        batch_bytes[batch_count++] = next_bytes;
+      }
+    }
 
     msgh.msg_iov = iov;
     msgh.msg_iovlen = iov_count;
@@ -730,36 +823,56 @@ bool Channel::ChannelImpl::ProcessOutgoingMessages() {
       }
     }
 
-    if (static_cast<size_t>(bytes_written) != amt_to_write) {
-      // If write() fails with EAGAIN then bytes_written will be -1.
-      if (bytes_written > 0) {
-        partial_write_iter_.ref().AdvanceAcrossSegments(msg->Buffers(),
-                                                        bytes_written);
-      }
-
-      // Tell libevent to call us back once things are unblocked.
-      is_blocked_on_write_ = true;
-      MessageLoopForIO::current()->WatchFileDescriptor(
-          pipe_,
-          false,  // One shot
-          MessageLoopForIO::WATCH_WRITE, &write_watcher_, this);
-      return true;
-    } else {
+    // Pop and delete the messages of the batch that were written out in
+    // their entirety, in queue order.
+    size_t bytes_remaining =
+        bytes_written > 0 ? static_cast<size_t>(bytes_written) : 0;
+    size_t written_count = 0;
+    while (written_count < batch_count &&
+           bytes_remaining >= batch_bytes[written_count]) {
+      bytes_remaining -= batch_bytes[written_count];
+      written_count++;
+
+      Message* written = output_queue_.front();
       partial_write_iter_.reset();
 
 #if defined(OS_MACOSX)
-      if (!msg->file_descriptor_set()->empty())
-        pending_fds_.push_back(
-            PendingDescriptors(msg->fd_cookie(), msg->file_descriptor_set()));
+      if (!written->file_descriptor_set()->empty())
+        pending_fds_.push_back(PendingDescriptors(
+            written->fd_cookie(), written->file_descriptor_set()));
 #endif
 
         // Message sent OK!
 #ifdef IPC_MESSAGE_DEBUG_EXTRA
-      DLOG(INFO) << "sent message @" << msg << " on channel @" << this
-                 << " with type " << msg->type();
+      DLOG(INFO) << "sent message @" << written << " on channel @" << this
+                 << " with type " << written->type();
 #endif
       OutputQueuePop();
-      delete msg;
+      delete written;
+    }
+
+    if (written_count < batch_count) {
+      // The write blocked part way through the batch. If write() failed with
+      // EAGAIN then bytes_written is -1 and there's nothing to advance past.
+      if (written_count > 0 && bytes_remaining > 0) {
+        // We crossed at least one message boundary, so the front message
+        // needs a fresh partial-write iterator.
+        Pickle::BufferList::IterImpl front_iter(
+            output_queue_.front()->Buffers());
+        partial_write_iter_.emplace(front_iter);
+      }
+      if (bytes_remaining > 0) {
+        partial_write_iter_.ref().AdvanceAcrossSegments(
+            output_queue_.front()->Buffers(), bytes_remaining);
+      }
+
+      // Tell libevent to call us back once things are unblocked.
+      is_blocked_on_write_ = true;
+      MessageLoopForIO::current()->WatchFileDescriptor(
+          pipe_,
+          false,  // One shot
+          MessageLoopForIO::WATCH_WRITE, &write_watcher_, this);
+      return true;
     }
   }
   return true;
@@ -793,14 +906,34 @@ bool Channel::ChannelImpl::Send(Message* message) {
 
   OutputQueuePush(message);
   if (!waiting_connect_) {
-    if (!is_blocked_on_write_) {
-      if (!ProcessOutgoingMessages()) return false;
+    if (!is_blocked_on_write_ && !flush_task_pending_) {
+      // Defer the transport write to a task at the end of the current IO
+      // loop run rather than writing synchronously. Sends arrive here one
+      // task at a time, so when a burst of messages is posted every one of
+      // them is already queued by the time the flush task runs and
+      // ProcessOutgoingMessages() coalesces them into far fewer writes.
+      // A failed write surfaces the same way it does today, through the
+      // write watcher or the read side noticing the broken pipe.
+      flush_task_pending_ = true;
+      MessageLoopForIO::current()->PostTask(
+          factory_.NewRunnableMethod(&ChannelImpl::FlushOutputQueue));
     }
   }
 
   return true;
 }
 
+void Channel::ChannelImpl::FlushOutputQueue() {
+  flush_task_pending_ = false;
+  if (waiting_connect_ || is_blocked_on_write_ || pipe_ == -1) {
+    // Either the connection isn't up yet, in which case the queue is
+    // flushed once it is, or the write watcher is already scheduled to
+    // drain the queue when the pipe becomes writable again.
+    return;
+  }
+  ProcessOutgoingMessages();
+}
+
 void Channel::ChannelImpl::GetClientFileDescriptorMapping(int* src_fd,
                                                           int* dest_fd) const {
   DCHECK(mode_ == MODE_SERVER);
@@ -844,12 +977,12 @@ void Channel::ChannelImpl::CloseDescriptors(uint32_t pending_fd_id) {
 #endif
 
 void Channel::ChannelImpl::OutputQueuePush(Message* msg) {
-  output_queue_.push(msg);
+  output_queue_.push_back(msg);
   output_queue_length_++;
 }
 
 void Channel::ChannelImpl::OutputQueuePop() {
-  output_queue_.pop();
+  output_queue_.pop_front();
   output_queue_length_--;
 }
 
@@ -11,7 +11,7 @@
 
 #include <sys/socket.h>  // for CMSG macros
 
-#include <queue>
+#include <deque>
 #include <string>
 #include <vector>
 #include <list>
@@ -62,6 +62,10 @@ class Channel::ChannelImpl : public MessageLoopForIO::Watcher {
   bool ProcessIncomingMessages();
   bool ProcessOutgoingMessages();
 
+  // Runs as a task posted by Send() to write out the queued messages once
+  // the current IO loop run has finished queueing them.
+  void FlushOutputQueue();
+
   // MessageLoopForIO::Watcher implementation.
   virtual void OnFileCanReadWithoutBlocking(int fd) override;
   virtual void OnFileCanWriteWithoutBlocking(int fd) override;
@@ -84,6 +88,10 @@ class Channel::ChannelImpl : public MessageLoopForIO::Watcher {
   // Indicates whether we're currently blocked waiting for a write to complete.
   bool is_blocked_on_write_;
 
+  // Indicates that a FlushOutputQueue() task has been posted and not yet run,
+  // so newly queued messages will be picked up by it.
+  bool flush_task_pending_;
+
   // If sending a message blocks then we use this iterator to keep track of
   // where in the message we are. It gets reset when the message is finished
   // sending.
@@ -99,8 +107,10 @@ class Channel::ChannelImpl : public MessageLoopForIO::Watcher {
 
   Listener* listener_;
 
-  // Messages to be sent are queued here.
-  std::queue<Message*> output_queue_;
+  // Messages to be sent are queued here. This is a deque so that
+  // ProcessOutgoingMessages() can look past the front message when it
+  // coalesces several queued messages into a single transport write.
+  std::deque<Message*> output_queue_;
 
   // We read from the pipe into this buffer
   char input_buf_[Channel::kReadBufferSize];
@@ -345,6 +345,21 @@ typedef enum JSGCParamKey {
    */
   JSGC_ZONE_ALLOC_DELAY_KB = 33,
 
+  /*
+   * Multiple of a zone's trigger threshold, as a percentage, beyond which
+   * collection of that zone stops being incremental.
+   *
+   * A zone that crosses its trigger threshold is still collected in budgeted
+   * incremental slices until its usage exceeds the threshold multiplied by
+   * this factor. This bounds how long a heavily allocating zone (say, a
+   * background tab) can force unlimited slices that pause every other zone
+   * in the runtime.
+   *
+   * Default: NonIncrementalFactor
+   * Pref: None
+   */
+  JSGC_NON_INCREMENTAL_FACTOR = 34,
+
 } JSGCParamKey;
 
 /*
@@ -517,6 +517,13 @@ static MOZ_ALWAYS_INLINE Zone* GetStringZone(JSString* str) {
   return GetNurseryStringZone(str);
 }
 
+static MOZ_ALWAYS_INLINE Zone* GetBigIntZone(JS::BigInt* bi) {
+  // Note: this assumes that BigInts are not nursery allocated.
+  MOZ_ASSERT(
+      !js::gc::IsInsideNursery(reinterpret_cast<const js::gc::Cell*>(bi)));
+  return js::gc::detail::GetGCThingZone(reinterpret_cast<uintptr_t>(bi));
+}
+
 extern JS_PUBLIC_API Zone* GetObjectZone(JSObject* obj);
 
 static MOZ_ALWAYS_INLINE bool GCThingIsMarkedGray(GCCellPtr thing) {
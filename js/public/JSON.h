@@ -71,6 +71,16 @@ extern JS_PUBLIC_API bool JS_ParseJSON(JSContext* cx, const char16_t* chars,
                                        uint32_t len,
                                        JS::MutableHandle<JS::Value> vp);
 
+/**
+ * Performs the JSON.parse operation as specified by ECMAScript, on text
+ * consisting of Latin-1 characters, i.e. each char is a Unicode code point
+ * in [U+0000, U+00FF].  (Thus ASCII text can be parsed directly.)
+ */
+extern JS_PUBLIC_API bool JS_ParseJSON(JSContext* cx,
+                                       const JS::Latin1Char* chars,
+                                       uint32_t len,
+                                       JS::MutableHandle<JS::Value> vp);
+
 /**
  * Performs the JSON.parse operation as specified by ECMAScript.
  */
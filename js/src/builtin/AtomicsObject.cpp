@@ -517,7 +517,14 @@ static FutexThread::WaitResult AtomicsWait(
   // and it provides the necessary memory fence.
   AutoLockFutexAPI lock;
 
+  // Bump the waiter count before checking the value: a notifier using the
+  // lock-free fast path in atomics_notify_impl() must either observe a
+  // nonzero count, or its preceding writes must be visible to the value
+  // check below, so this thread cannot go to sleep having missed a wakeup.
+  sarb->incWaiterCount();
+
   if (jit::AtomicOperations::loadSafeWhenRacy(addr) != value) {
+    sarb->decWaiterCount();
     return FutexThread::WaitResult::NotEqual;
   }
 
@@ -543,6 +550,7 @@ static FutexThread::WaitResult AtomicsWait(
       sarb->setWaiters(w.lower_pri);
     }
   }
+  sarb->decWaiterCount();
 
   return retval;
 }
@@ -648,6 +656,17 @@ int64_t js::atomics_notify_impl(SharedArrayRawBuffer* sarb, uint32_t byteOffset,
   // Validation should ensure this does not happen.
   MOZ_ASSERT(sarb, "notify is only applicable to shared memory");
 
+  // Fast path: if nothing is waiting on this buffer there is nothing to do,
+  // and we can avoid taking the process-wide futex lock. This matters for
+  // producer-consumer code that notifies on every store while the consumer
+  // rarely actually sleeps. hasWaiters() is a full fence, so a waiter that
+  // is concurrently adding itself either makes the count visible here or
+  // re-reads the waited-on location after this caller's preceding writes
+  // and refuses to sleep.
+  if (!sarb->hasWaiters()) {
+    return 0;
+  }
+
   AutoLockFutexAPI lock;
 
   int64_t woken = 0;
@@ -517,6 +517,7 @@ static bool MinorGC(JSContext* cx, unsigned argc, Value* vp) {
   _("allocationThresholdFactor", JSGC_ALLOCATION_THRESHOLD_FACTOR, true)     \
   _("allocationThresholdFactorAvoidInterrupt",                               \
     JSGC_ALLOCATION_THRESHOLD_FACTOR_AVOID_INTERRUPT, true)                  \
+  _("nonIncrementalFactor", JSGC_NON_INCREMENTAL_FACTOR, true)               \
   _("minEmptyChunkCount", JSGC_MIN_EMPTY_CHUNK_COUNT, true)                  \
   _("maxEmptyChunkCount", JSGC_MAX_EMPTY_CHUNK_COUNT, true)                  \
   _("compactingEnabled", JSGC_COMPACTING_ENABLED, true)                      \
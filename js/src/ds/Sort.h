@@ -84,6 +84,54 @@ MOZ_MUST_USE bool MergeSort(T* array, size_t nelems, T* scratch, Comparator c) {
     return true;
   }
 
+  /*
+   * Check for presorted input with a single pass before doing any real work:
+   * arrays that are already sorted, or sorted in strictly descending order,
+   * are common in practice and can skip the merge passes entirely.  For
+   * unsorted input the scan bails out at the first out-of-order pair, so the
+   * extra comparisons are bounded by the length of the initial run.  The
+   * strictness requirement in the descending case keeps the sort stable.
+   */
+  {
+    bool lessOrEqual;
+    if (!c(array[0], array[1], &lessOrEqual)) {
+      return false;
+    }
+    size_t i = 1;
+    if (lessOrEqual) {
+      /* Possibly an ascending run covering the whole array. */
+      for (; i < nelems - 1; i++) {
+        if (!c(array[i], array[i + 1], &lessOrEqual)) {
+          return false;
+        }
+        if (!lessOrEqual) {
+          break;
+        }
+      }
+      if (i == nelems - 1) {
+        return true;
+      }
+    } else {
+      /* Possibly a strictly descending run covering the whole array. */
+      for (; i < nelems - 1; i++) {
+        if (!c(array[i], array[i + 1], &lessOrEqual)) {
+          return false;
+        }
+        if (lessOrEqual) {
+          break;
+        }
+      }
+      if (i == nelems - 1) {
+        for (T *lo = array, *hi = array + nelems - 1; lo < hi; lo++, hi--) {
+          T tmp = *lo;
+          *lo = *hi;
+          *hi = tmp;
+        }
+        return true;
+      }
+    }
+  }
+
   /*
    * Apply insertion sort to small chunks to reduce the number of merge
    * passes needed.
@@ -943,7 +943,8 @@ static bool CompileLazyFunctionImpl(JSContext* cx, Handle<LazyScript*> lazy,
   // lazified. Note that we are interested in the delta between end of
   // syntax parsing and start of full parsing, so we do this now rather than
   // after parsing below.
-  if (!lazy->scriptSource()->parseEnded().IsNull()) {
+  if (!lazy->scriptSource()->parseEnded().IsNull() &&
+      cx->runtime()->hasTelemetryCallback()) {
     const mozilla::TimeDuration delta =
         ReallyNow() - lazy->scriptSource()->parseEnded();
 
@@ -190,6 +190,7 @@
 #include "gc/GC-inl.h"
 
 #include "mozilla/ArrayUtils.h"
+#include "mozilla/Atomics.h"
 #include "mozilla/DebugOnly.h"
 #include "mozilla/MacroForEach.h"
 #include "mozilla/MemoryReporting.h"
@@ -301,6 +302,9 @@ static const float AllocThresholdFactor = 0.9f;
 /* JSGC_ALLOCATION_THRESHOLD_FACTOR_AVOID_INTERRUPT */
 static const float AllocThresholdFactorAvoidInterrupt = 0.9f;
 
+/* JSGC_NON_INCREMENTAL_FACTOR */
+static const float NonIncrementalFactor = 1.12f;
+
 /* no parameter */
 static const float MallocThresholdGrowFactor = 1.5f;
 
@@ -1565,6 +1569,14 @@ bool GCSchedulingTunables::setParameter(JSGCParamKey key, uint32_t value,
       allocThresholdFactorAvoidInterrupt_ = newFactor;
       break;
     }
+    case JSGC_NON_INCREMENTAL_FACTOR: {
+      float newFactor = value / 100.0f;
+      if (newFactor < 1.0f) {
+        return false;
+      }
+      nonIncrementalFactor_ = newFactor;
+      break;
+    }
     case JSGC_MIN_EMPTY_CHUNK_COUNT:
       setMinEmptyChunkCount(value);
       break;
@@ -1678,6 +1690,7 @@ GCSchedulingTunables::GCSchedulingTunables()
       allocThresholdFactor_(TuningDefaults::AllocThresholdFactor),
       allocThresholdFactorAvoidInterrupt_(
           TuningDefaults::AllocThresholdFactorAvoidInterrupt),
+      nonIncrementalFactor_(TuningDefaults::NonIncrementalFactor),
       zoneAllocDelayBytes_(TuningDefaults::ZoneAllocDelayBytes),
       dynamicHeapGrowthEnabled_(TuningDefaults::DynamicHeapGrowthEnabled),
       highFrequencyThreshold_(
@@ -1771,6 +1784,9 @@ void GCSchedulingTunables::resetParameter(JSGCParamKey key,
       allocThresholdFactorAvoidInterrupt_ =
           TuningDefaults::AllocThresholdFactorAvoidInterrupt;
       break;
+    case JSGC_NON_INCREMENTAL_FACTOR:
+      nonIncrementalFactor_ = TuningDefaults::NonIncrementalFactor;
+      break;
     case JSGC_MIN_EMPTY_CHUNK_COUNT:
       setMinEmptyChunkCount(TuningDefaults::MinEmptyChunkCount);
       break;
@@ -1858,6 +1874,8 @@ uint32_t GCRuntime::getParameter(JSGCParamKey key, const AutoLockGC& lock) {
       return uint32_t(tunables.allocThresholdFactor() * 100);
     case JSGC_ALLOCATION_THRESHOLD_FACTOR_AVOID_INTERRUPT:
       return uint32_t(tunables.allocThresholdFactorAvoidInterrupt() * 100);
+    case JSGC_NON_INCREMENTAL_FACTOR:
+      return uint32_t(tunables.nonIncrementalFactor() * 100);
     case JSGC_MIN_EMPTY_CHUNK_COUNT:
       return tunables.minEmptyChunkCount(lock);
     case JSGC_MAX_EMPTY_CHUNK_COUNT:
@@ -3449,8 +3467,9 @@ void GCRuntime::maybeAllocTriggerZoneGC(Zone* zone, size_t nbytes) {
       zone->zoneSize.gcBytes();  // This already includes |nbytes|.
   size_t thresholdBytes = zone->threshold.gcTriggerBytes();
   if (usedBytes >= thresholdBytes) {
-    // The threshold has been surpassed, immediately trigger a GC, which
-    // will be done non-incrementally.
+    // The threshold has been surpassed, immediately trigger a GC. This is
+    // still incremental unless usage grows past the non-incremental factor;
+    // see budgetIncrementalGC().
     triggerZoneGC(zone, JS::GCReason::ALLOC_TRIGGER, usedBytes, thresholdBytes);
     return;
   }
@@ -3504,8 +3523,9 @@ void GCRuntime::maybeMallocTriggerZoneGC(Zone* zone) {
   size_t usedBytes = zone->gcMallocBytes.gcBytes();
   size_t thresholdBytes = zone->gcMallocThreshold.gcTriggerBytes();
   if (usedBytes >= thresholdBytes) {
-    // The threshold has been surpassed, immediately trigger a GC, which
-    // will be done non-incrementally.
+    // The threshold has been surpassed, immediately trigger a GC. This is
+    // still incremental unless usage grows past the non-incremental factor;
+    // see budgetIncrementalGC().
     triggerZoneGC(zone, JS::GCReason::TOO_MUCH_MALLOC, usedBytes,
                   thresholdBytes);
     return;
@@ -4458,6 +4478,75 @@ static void UnmarkCollectedZones(GCParallelTask* task) {
   }
 }
 
+static const size_t MaxParallelZoneTasks = 8;
+
+/*
+ * Shares a list of zones between parallel tasks. Tasks claim zones with an
+ * atomic index so the work is distributed dynamically, whichever task
+ * finishes a zone first takes the next one.
+ */
+class ZonesToProcess {
+  ZoneVector zones;
+  mozilla::Atomic<size_t, mozilla::SeqCst> next;
+
+ public:
+  ZonesToProcess() : next(0) {}
+
+  MOZ_MUST_USE bool init(JSRuntime* rt) {
+    for (GCZonesIter zone(rt); !zone.done(); zone.next()) {
+      if (!zones.append(zone)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  size_t count() const { return zones.length(); }
+
+  Zone* getZone() {
+    size_t i = next++;
+    return i < zones.length() ? zones[i] : nullptr;
+  }
+};
+
+/*
+ * Unmarks arenas and weak maps for zones claimed from a shared ZonesToUnmark.
+ * The task is started on construction and joined on destruction, like
+ * AutoRunParallelTask.
+ */
+class MOZ_RAII UnmarkZonesTask : public GCParallelTaskHelper<UnmarkZonesTask> {
+  ZonesToProcess& source_;
+  AutoLockHelperThreadState& lock_;
+
+ public:
+  UnmarkZonesTask(JSRuntime* rt, ZonesToProcess& source,
+                  AutoLockHelperThreadState& lock)
+      : GCParallelTaskHelper(rt), source_(source), lock_(lock) {
+    runtime()->gc.startTask(*this, gcstats::PhaseKind::UNMARK, lock_);
+  }
+
+  ~UnmarkZonesTask() {
+    runtime()->gc.joinTask(*this, gcstats::PhaseKind::UNMARK, lock_);
+  }
+
+  void run() {
+    while (Zone* zone = source_.getZone()) {
+      zone->arenas.unmarkAll();
+      WeakMapBase::unmarkZone(zone);
+    }
+  }
+};
+
+static size_t ParallelZoneTaskCount(size_t zoneCount) {
+  if (!CanUseExtraThreads()) {
+    return 0;
+  }
+
+  size_t targetTaskCount = HelperThreadState().cpuCount / 2;
+  return Min(Min(Max(targetTaskCount, size_t(1)), MaxParallelZoneTasks),
+             zoneCount);
+}
+
 static void BufferGrayRoots(GCParallelTask* task) {
   task->runtime()->gc.bufferGrayRoots();
 }
@@ -4498,10 +4587,25 @@ bool GCRuntime::beginMarkPhase(JS::GCReason reason, AutoGCSession& session) {
     /*
      * Clear all mark state for the zones we are collecting. This is linear
      * in the size of the heap we are collecting and so can be slow. Do this
-     * in parallel with the rest of this block.
+     * in parallel with the rest of this block, sharding the zones across
+     * several helper threads when more than one zone is being collected.
      */
-    AutoRunParallelTask unmarkCollectedZones(
-        rt, UnmarkCollectedZones, gcstats::PhaseKind::UNMARK, helperLock);
+    ZonesToProcess zonesToUnmark;
+    size_t unmarkTaskCount = 0;
+    if (zonesToUnmark.init(rt)) {
+      unmarkTaskCount = ParallelZoneTaskCount(zonesToUnmark.count());
+    }
+
+    Maybe<UnmarkZonesTask> unmarkTasks[MaxParallelZoneTasks];
+    Maybe<AutoRunParallelTask> unmarkCollectedZones;
+    if (unmarkTaskCount > 0) {
+      for (size_t i = 0; i < unmarkTaskCount; i++) {
+        unmarkTasks[i].emplace(rt, zonesToUnmark, helperLock);
+      }
+    } else {
+      unmarkCollectedZones.emplace(rt, UnmarkCollectedZones,
+                                   gcstats::PhaseKind::UNMARK, helperLock);
+    }
 
     /*
      * Buffer gray roots for incremental collections. This is linear in the
@@ -5584,11 +5688,61 @@ class ImmediateSweepWeakCacheTask
   void run() { cache.sweep(); }
 };
 
+// Refines the atom bitmaps of zones claimed from a shared ZonesToProcess.
+// Refinement only reads the shared dense bitmap and writes the zone's own
+// bitmap, so zones can be processed in parallel.
+class MOZ_RAII RefineAtomsBitmapTask
+    : public GCParallelTaskHelper<RefineAtomsBitmapTask> {
+  ZonesToProcess& source_;
+  const DenseBitmap& bitmap_;
+  AutoLockHelperThreadState& lock_;
+
+ public:
+  RefineAtomsBitmapTask(JSRuntime* rt, ZonesToProcess& source,
+                        const DenseBitmap& bitmap,
+                        AutoLockHelperThreadState& lock)
+      : GCParallelTaskHelper(rt),
+        source_(source),
+        bitmap_(bitmap),
+        lock_(lock) {
+    runtime()->gc.startTask(*this, gcstats::PhaseKind::UPDATE_ATOMS_BITMAP,
+                            lock_);
+  }
+
+  ~RefineAtomsBitmapTask() {
+    runtime()->gc.joinTask(*this, gcstats::PhaseKind::UPDATE_ATOMS_BITMAP,
+                           lock_);
+  }
+
+  void run() {
+    while (Zone* zone = source_.getZone()) {
+      runtime()->gc.atomMarking.refineZoneBitmapForCollectedZone(zone, bitmap_);
+    }
+  }
+};
+
 static void UpdateAtomsBitmap(JSRuntime* runtime) {
   DenseBitmap marked;
   if (runtime->gc.atomMarking.computeBitmapFromChunkMarkBits(runtime, marked)) {
-    for (GCZonesIter zone(runtime); !zone.done(); zone.next()) {
-      runtime->gc.atomMarking.refineZoneBitmapForCollectedZone(zone, marked);
+    // Refining the zone bitmaps is linear in the number of zones times the
+    // size of the atoms heap, so shard the zones across helper threads where
+    // possible.
+    ZonesToProcess zonesToRefine;
+    size_t taskCount = 0;
+    if (zonesToRefine.init(runtime)) {
+      taskCount = ParallelZoneTaskCount(zonesToRefine.count());
+    }
+
+    if (taskCount > 1) {
+      AutoLockHelperThreadState lock;
+      Maybe<RefineAtomsBitmapTask> tasks[MaxParallelZoneTasks];
+      for (size_t i = 0; i < taskCount; i++) {
+        tasks[i].emplace(runtime, zonesToRefine, marked, lock);
+      }
+    } else {
+      for (GCZonesIter zone(runtime); !zone.done(); zone.next()) {
+        runtime->gc.atomMarking.refineZoneBitmapForCollectedZone(zone, marked);
+      }
     }
   } else {
     // Ignore OOM in computeBitmapFromChunkMarkBits. The
@@ -7495,7 +7649,14 @@ GCRuntime::IncrementalResult GCRuntime::budgetIncrementalGC(
       continue;
     }
 
-    if (zone->zoneSize.gcBytes() >= zone->threshold.gcTriggerBytes()) {
+    // Crossing the trigger threshold doesn't immediately make the collection
+    // non-incremental: the zone keeps being collected in budgeted slices
+    // until its usage exceeds the threshold by the non-incremental factor.
+    // This stops one heavily allocating zone from inflicting unlimited
+    // slices, and hence arbitrary pauses, on every other zone in the
+    // runtime as soon as it reaches its trigger.
+    if (zone->zoneSize.gcBytes() >=
+        zone->threshold.nonIncrementalTriggerBytes(tunables)) {
       CheckZoneIsScheduled(zone, reason, "GC bytes");
       budget.makeUnlimited();
       stats().nonincremental(AbortReason::GCBytesTrigger);
@@ -7505,7 +7666,7 @@ GCRuntime::IncrementalResult GCRuntime::budgetIncrementalGC(
     }
 
     if (zone->gcMallocBytes.gcBytes() >=
-        zone->gcMallocThreshold.gcTriggerBytes()) {
+        zone->gcMallocThreshold.nonIncrementalTriggerBytes(tunables)) {
       CheckZoneIsScheduled(zone, reason, "malloc bytes");
       budget.makeUnlimited();
       stats().nonincremental(AbortReason::MallocBytesTrigger);
@@ -390,26 +390,10 @@ void* js::Nursery::allocate(size_t size) {
   }
 #endif
 
-  if (currentEnd() < position() + size) {
-    unsigned chunkno = currentChunk_ + 1;
-    MOZ_ASSERT(chunkno <= chunkCountLimit());
-    MOZ_ASSERT(chunkno <= maxChunkCount());
-    MOZ_ASSERT(chunkno <= allocatedChunkCount());
-    if (chunkno == maxChunkCount()) {
+  if (MOZ_UNLIKELY(currentEnd() < position() + size)) {
+    if (!moveToNextChunk()) {
       return nullptr;
     }
-    if (MOZ_UNLIKELY(chunkno == allocatedChunkCount())) {
-      mozilla::TimeStamp start = ReallyNow();
-      {
-        AutoLockGCBgAlloc lock(runtime());
-        if (!allocateNextChunk(chunkno, lock)) {
-          return nullptr;
-        }
-      }
-      timeInChunkAlloc_ += ReallyNow() - start;
-      MOZ_ASSERT(chunkno < allocatedChunkCount());
-    }
-    setCurrentChunk(chunkno);
   }
 
   void* thing = (void*)position();
@@ -438,6 +422,29 @@ void* js::Nursery::allocate(size_t size) {
   return thing;
 }
 
+bool js::Nursery::moveToNextChunk() {
+  unsigned chunkno = currentChunk_ + 1;
+  MOZ_ASSERT(chunkno <= chunkCountLimit());
+  MOZ_ASSERT(chunkno <= maxChunkCount());
+  MOZ_ASSERT(chunkno <= allocatedChunkCount());
+  if (chunkno == maxChunkCount()) {
+    return false;
+  }
+  if (MOZ_UNLIKELY(chunkno == allocatedChunkCount())) {
+    mozilla::TimeStamp start = ReallyNow();
+    {
+      AutoLockGCBgAlloc lock(runtime());
+      if (!allocateNextChunk(chunkno, lock)) {
+        return false;
+      }
+    }
+    timeInChunkAlloc_ += ReallyNow() - start;
+    MOZ_ASSERT(chunkno < allocatedChunkCount());
+  }
+  setCurrentChunk(chunkno);
+  return true;
+}
+
 void* js::Nursery::allocateBuffer(Zone* zone, size_t nbytes) {
   MOZ_ASSERT(nbytes > 0);
 
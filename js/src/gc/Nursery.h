@@ -606,6 +606,13 @@ class Nursery {
   /* Common internal allocator function. */
   void* allocate(size_t size);
 
+  /*
+   * Move the allocation point to the next chunk, allocating it first if
+   * necessary. Out of line so that the bump-allocation fast path in
+   * allocate() stays small.
+   */
+  MOZ_MUST_USE MOZ_NEVER_INLINE bool moveToNextChunk();
+
   void doCollection(JS::GCReason reason, gc::TenureCountCache& tenureCounts);
 
   float doPretenuring(JSRuntime* rt, JS::GCReason reason,
@@ -376,6 +376,14 @@ class GCSchedulingTunables {
    */
   UnprotectedData<float> allocThresholdFactorAvoidInterrupt_;
 
+  /*
+   * JSGC_NON_INCREMENTAL_FACTOR
+   *
+   * Multiple of threshold.gcBytes() beyond which we stop collecting a zone
+   * incrementally.
+   */
+  UnprotectedData<float> nonIncrementalFactor_;
+
   /*
    * Number of bytes to allocate between incremental slices in GCs triggered
    * by the zone allocation threshold.
@@ -487,6 +495,7 @@ class GCSchedulingTunables {
   double allocThresholdFactorAvoidInterrupt() const {
     return allocThresholdFactorAvoidInterrupt_;
   }
+  double nonIncrementalFactor() const { return nonIncrementalFactor_; }
   size_t zoneAllocDelayBytes() const { return zoneAllocDelayBytes_; }
   bool isDynamicHeapGrowthEnabled() const { return dynamicHeapGrowthEnabled_; }
   const mozilla::TimeDuration& highFrequencyThreshold() const {
@@ -681,6 +690,10 @@ class ZoneThreshold {
 
  public:
   size_t gcTriggerBytes() const { return gcTriggerBytes_; }
+  size_t nonIncrementalTriggerBytes(
+      const GCSchedulingTunables& tunables) const {
+    return gcTriggerBytes_ * tunables.nonIncrementalFactor();
+  }
   float eagerAllocTrigger(bool highFrequencyGC) const;
 };
 
@@ -103,6 +103,16 @@ void WeakMap<K, V>::trace(JSTracer* trc) {
       return;
     }
 
+    // If the map has already been traced at this color then scanning the
+    // entries again cannot mark anything new: entries which were live have
+    // been marked and entries with unmarked keys are picked up by the weak
+    // keys table (in weak marking mode) or by the iterative fixpoint in
+    // markWeakReferences. This avoids rescanning large ephemeron-heavy maps
+    // every time a barrier re-traces the map object.
+    if (marked && markColor == marker->markColor()) {
+      return;
+    }
+
     marked = true;
     markColor = marker->markColor();
     (void)markEntries(marker);
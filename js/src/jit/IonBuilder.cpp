@@ -4449,6 +4449,23 @@ IonBuilder::InliningDecision IonBuilder::makeInliningDecision(
   return InliningDecision_Inline;
 }
 
+void IonBuilder::insertColdCalleeRecompileCheck(JSFunction* target) {
+  // |target| would have been inlined were it not still too cold to have
+  // stable type information.  That veto is temporary, so insert a check
+  // forcing this script to be recompiled, and the inlining decision to be
+  // revisited, once the target has warmed up.
+  if (!isHighestOptimizationLevel()) {
+    // A recompile at the highest optimization level is already scheduled;
+    // see insertRecompileCheck().
+    return;
+  }
+  MRecompileCheck* check =
+      MRecompileCheck::New(alloc(), target->nonLazyScript(),
+                           optimizationInfo().inliningRecompileThreshold(),
+                           MRecompileCheck::RecompileCheckType::Inlining);
+  current->add(check);
+}
+
 AbortReasonOr<Ok> IonBuilder::selectInliningTargets(
     const InliningTargets& targets, CallInfo& callInfo, BoolVector& choiceSet,
     uint32_t* numInlineable) {
@@ -4479,8 +4496,13 @@ AbortReasonOr<Ok> IonBuilder::selectInliningTargets(
       case InliningDecision_Error:
         return abort(AbortReason::Error);
       case InliningDecision_DontInline:
+        inlineable = false;
+        break;
       case InliningDecision_WarmUpCountTooLow:
         inlineable = false;
+        // A WarmUpCountTooLow target is guaranteed to be a scripted
+        // function; see makeInliningDecision.
+        insertColdCalleeRecompileCheck(&target->as<JSFunction>());
         break;
       case InliningDecision_Inline:
         inlineable = true;
@@ -5552,7 +5574,9 @@ AbortReasonOr<Ok> IonBuilder::jsop_funcall(uint32_t argc) {
       case InliningDecision_Error:
         return abort(AbortReason::Error);
       case InliningDecision_DontInline:
+        break;
       case InliningDecision_WarmUpCountTooLow:
+        insertColdCalleeRecompileCheck(target);
         break;
       case InliningDecision_Inline: {
         InliningStatus status;
@@ -5928,7 +5952,9 @@ AbortReasonOr<Ok> IonBuilder::jsop_funapplyarguments(uint32_t argc) {
     case InliningDecision_Error:
       return abort(AbortReason::Error);
     case InliningDecision_DontInline:
+      break;
     case InliningDecision_WarmUpCountTooLow:
+      insertColdCalleeRecompileCheck(target);
       break;
     case InliningDecision_Inline: {
       InliningStatus status;
@@ -6000,13 +6026,8 @@ AbortReasonOr<Ok> IonBuilder::jsop_call(uint32_t argc, bool constructing,
   }
 
   if (status == InliningStatus_WarmUpCountTooLow && callTargets &&
-      callTargets->length() == 1 && isHighestOptimizationLevel()) {
-    JSFunction* target = callTargets.ref()[0];
-    MRecompileCheck* check =
-        MRecompileCheck::New(alloc(), target->nonLazyScript(),
-                             optimizationInfo().inliningRecompileThreshold(),
-                             MRecompileCheck::RecompileCheckType::Inlining);
-    current->add(check);
+      callTargets->length() == 1) {
+    insertColdCalleeRecompileCheck(callTargets.ref()[0]);
   }
 
   return makeCall(callTargets, callInfo);
@@ -11666,7 +11687,9 @@ AbortReasonOr<Ok> IonBuilder::getPropTryCommonGetter(bool* emitted,
       case InliningDecision_Error:
         return abort(AbortReason::Error);
       case InliningDecision_DontInline:
+        break;
       case InliningDecision_WarmUpCountTooLow:
+        insertColdCalleeRecompileCheck(commonGetter);
         break;
       case InliningDecision_Inline: {
         InliningStatus status;
@@ -12227,7 +12250,9 @@ AbortReasonOr<Ok> IonBuilder::setPropTryCommonSetter(bool* emitted,
       case InliningDecision_Error:
         return abort(AbortReason::Error);
       case InliningDecision_DontInline:
+        break;
       case InliningDecision_WarmUpCountTooLow:
+        insertColdCalleeRecompileCheck(commonSetter);
         break;
       case InliningDecision_Inline: {
         InliningStatus status;
@@ -697,6 +697,7 @@ class IonBuilder : public MIRGenerator,
   // Oracles.
   InliningDecision canInlineTarget(JSFunction* target, CallInfo& callInfo);
   InliningDecision makeInliningDecision(JSObject* target, CallInfo& callInfo);
+  void insertColdCalleeRecompileCheck(JSFunction* target);
   AbortReasonOr<Ok> selectInliningTargets(const InliningTargets& targets,
                                           CallInfo& callInfo,
                                           BoolVector& choiceSet,
@@ -123,8 +123,9 @@ bool MIRGraph::removeSuccessorBlocks(MBasicBlock* start) {
 
   start->mark();
 
-  // Mark all successors.
-  Vector<MBasicBlock*, 4, SystemAllocPolicy> blocks;
+  // Mark all successors. Use the compilation's temp allocator like other MIR
+  // worklists rather than going to the system allocator on this path.
+  Vector<MBasicBlock*, 4, JitAllocPolicy> blocks(alloc());
   for (size_t i = 0; i < start->numSuccessors(); i++) {
     if (start->getSuccessor(i)->isMarked()) {
       continue;
@@ -0,0 +1,112 @@
+/* -*- Mode: C++; tab-width: 8; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+ * vim: set ts=8 sts=2 et sw=2 tw=80:
+ */
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "jit/BaselineJIT.h"
+#include "jit/Ion.h"
+#include "jit/JitOptions.h"
+
+#include "js/CompilationAndEvaluation.h"
+#include "js/SourceText.h"
+#include "jsapi-tests/tests.h"
+#include "vm/JSFunction.h"
+#include "vm/JSScript.h"
+
+using namespace js;
+
+// Saves and restores the warm-up related JitOptions so the test can lower the
+// thresholds without affecting later tests in the same process.
+class MOZ_RAII AutoRestoreWarmUpOptions {
+  uint32_t baselineThreshold_;
+  uint32_t ionThreshold_;
+  bool offthread_;
+
+ public:
+  AutoRestoreWarmUpOptions()
+      : baselineThreshold_(jit::JitOptions.baselineWarmUpThreshold),
+        ionThreshold_(jit::JitOptions.normalIonWarmUpThreshold),
+        offthread_(jit::JitOptions.offthreadCompilation) {}
+
+  ~AutoRestoreWarmUpOptions() {
+    jit::JitOptions.baselineWarmUpThreshold = baselineThreshold_;
+    jit::JitOptions.setNormalIonWarmUpThreshold(ionThreshold_);
+    jit::JitOptions.offthreadCompilation = offthread_;
+  }
+};
+
+// Check that a hot function tiers up through Baseline to Ion within a bounded
+// number of calls of the configured thresholds. This pins down the
+// interaction between the JitOptions warm-up thresholds and tiering, so that
+// threshold tuning mistakes fail in CI instead of only showing up in
+// profiles.
+BEGIN_TEST(testJitWarmUp_TiersUpAtThreshold) {
+  if (!jit::IsBaselineEnabled(cx) || !jit::IsIonEnabled(cx)) {
+    return true;
+  }
+
+  AutoRestoreWarmUpOptions restoreOptions;
+  jit::JitOptions.baselineWarmUpThreshold = 10;
+  jit::JitOptions.setNormalIonWarmUpThreshold(40);
+  // Compile synchronously so the tier transitions happen at deterministic
+  // call counts.
+  jit::JitOptions.offthreadCompilation = false;
+
+  static const char source[] =
+      "function warmUpTarget(n) {"
+      "  var total = 0;"
+      "  for (var i = 0; i < n; i++) {"
+      "    total += i;"
+      "  }"
+      "  return total;"
+      "}";
+
+  JS::CompileOptions options(cx);
+  options.setFileAndLine(__FILE__, __LINE__);
+
+  JS::SourceText<mozilla::Utf8Unit> srcBuf;
+  CHECK(srcBuf.init(cx, source, sizeof(source) - 1,
+                    JS::SourceOwnership::Borrowed));
+
+  JS::RootedValue v(cx);
+  CHECK(JS::EvaluateDontInflate(cx, options, srcBuf, &v));
+
+  JS::RootedValue fval(cx);
+  CHECK(JS_GetProperty(cx, global, "warmUpTarget", &fval));
+  CHECK(fval.isObject());
+  JS::RootedFunction fun(cx, &fval.toObject().as<JSFunction>());
+  JS::RootedScript script(cx, JS_GetFunctionScript(cx, fun));
+  CHECK(script);
+
+  bool sawBaseline = false;
+  bool sawIon = false;
+
+  // The thresholds above plus compilation latency should be hit well within
+  // this bound; the bound only exists so a tiering bug fails rather than
+  // hanging.
+  static const uint32_t MaxCalls = 5000;
+
+  JS::RootedValue rval(cx);
+  for (uint32_t i = 0; i < MaxCalls; i++) {
+    JS::AutoValueArray<1> args(cx);
+    args[0].setInt32(100);
+    CHECK(JS_CallFunctionName(cx, global, "warmUpTarget", args, &rval));
+
+    if (!sawBaseline && script->hasBaselineScript()) {
+      sawBaseline = true;
+      // Baseline compilation must not wait for the Ion threshold.
+      CHECK(i < jit::JitOptions.normalIonWarmUpThreshold + 100);
+    }
+    if (script->hasIonScript()) {
+      sawIon = true;
+      break;
+    }
+  }
+
+  CHECK(sawBaseline);
+  CHECK(sawIon);
+  return true;
+}
+END_TEST(testJitWarmUp_TiersUpAtThreshold)
@@ -99,9 +99,9 @@ void js::ShutDownMallocAllocator() {
 
 #ifdef MOZ_DEBUG
 extern void js::AssertJSStringBufferInCorrectArena(const void* ptr) {
-//  `jemalloc_ptr_info()` only exists if MOZ_MEMORY is defined, and it only
-//  returns an arenaId if MOZ_DEBUG is defined. Otherwise, this function is
-//  a no-op.
+//  `jemalloc_ptr_info()` only exists if MOZ_MEMORY is defined. It fills in
+//  the arenaId in all build types, but the assertions are only worth the
+//  lookup cost in debug builds, so this function is a no-op elsewhere.
 #  if defined(MOZ_MEMORY) && defined(MOZ_DEBUG)
   if (ptr) {
     jemalloc_ptr_info_t ptrInfo{};
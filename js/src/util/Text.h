@@ -16,6 +16,7 @@
 #include <stddef.h>
 #include <stdint.h>
 #include <stdio.h>
+#include <string.h>
 #include <string>
 #include <type_traits>
 
@@ -76,6 +77,20 @@ inline int32_t CompareChars(const Char1* s1, size_t len1, const Char2* s2,
   return int32_t(len1 - len2);
 }
 
+// For Latin1 strings the lexicographic order matches the byte order, so the
+// common case can use memcmp, which the C library vectorizes for the current
+// CPU. (This does not hold for char16_t on little-endian machines, so the
+// two-byte cases keep the generic loop above.)
+inline int32_t CompareChars(const Latin1Char* s1, size_t len1,
+                            const Latin1Char* s2, size_t len2) {
+  size_t n = Min(len1, len2);
+  if (int32_t cmp = memcmp(s1, s2, n)) {
+    return cmp;
+  }
+
+  return int32_t(len1 - len2);
+}
+
 // Return s advanced past any Unicode white space characters.
 template <typename CharT>
 static inline const CharT* SkipSpace(const CharT* s, const CharT* end) {
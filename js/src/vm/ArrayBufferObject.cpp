@@ -454,9 +454,22 @@ static uint8_t* AllocateArrayBufferContents(JSContext* cx, uint32_t nbytes) {
   return p;
 }
 
+static uint8_t* AllocateUninitializedArrayBufferContents(JSContext* cx,
+                                                         uint32_t nbytes) {
+  // Use malloc rather than calloc: the caller is about to overwrite every
+  // byte, so zeroing the allocation first would just add a pointless pass
+  // over the buffer (and dirty all of its pages twice for large buffers).
+  auto* p = cx->pod_mallocCanGC<uint8_t>(nbytes, js::ArrayBufferContentsArena);
+  if (!p) {
+    ReportOutOfMemory(cx);
+  }
+  return p;
+}
+
 static uint8_t* NewCopiedBufferContents(JSContext* cx,
                                         Handle<ArrayBufferObject*> buffer) {
-  uint8_t* dataCopy = AllocateArrayBufferContents(cx, buffer->byteLength());
+  uint8_t* dataCopy =
+      AllocateUninitializedArrayBufferContents(cx, buffer->byteLength());
   if (dataCopy) {
     if (auto count = buffer->byteLength()) {
       memcpy(dataCopy, buffer->dataPointer(), count);
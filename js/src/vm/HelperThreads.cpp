@@ -1517,6 +1517,15 @@ static bool IonBuilderHasHigherPriority(jit::IonBuilder* first,
            second->optimizationInfo().level();
   }
 
+  // An OSR compilation indicates the main thread is stuck in a hot loop in
+  // Baseline code right now, waiting for this compilation; prefer it over
+  // whole-script compilations requested at function entry.
+  bool firstIsOsr = first->info().osrPc() != nullptr;
+  bool secondIsOsr = second->info().osrPc() != nullptr;
+  if (firstIsOsr != secondIsOsr) {
+    return firstIsOsr;
+  }
+
   // A script without an IonScript has precedence on one with.
   if (first->scriptHasIonScript() != second->scriptHasIonScript()) {
     return !first->scriptHasIonScript();
@@ -222,6 +222,30 @@ struct JSContext : public JS::RootingContext,
   /* Clear the pending exception (if any) due to OOM. */
   void recoverFromOutOfMemory();
 
+  /*
+   * This variation of malloc will call the large-allocation-failure callback
+   * on OOM and retry the allocation.
+   */
+  template <typename T>
+  T* pod_mallocCanGC(size_t numElems, arena_id_t arena = js::MallocArena) {
+    T* p = maybe_pod_malloc<T>(numElems, arena);
+    if (MOZ_LIKELY(!!p)) {
+      return p;
+    }
+    size_t bytes;
+    if (MOZ_UNLIKELY(!js::CalculateAllocSize<T>(numElems, &bytes))) {
+      reportAllocationOverflow();
+      return nullptr;
+    }
+    p = static_cast<T*>(
+        runtime()->onOutOfMemoryCanGC(js::AllocFunction::Malloc, arena, bytes));
+    if (!p) {
+      return nullptr;
+    }
+    updateMallocCounter(bytes);
+    return p;
+  }
+
   /*
    * This variation of calloc will call the large-allocation-failure callback
    * on OOM and retry the allocation.
@@ -1996,13 +1996,31 @@ const Unit* ScriptSource::units(JSContext* cx,
   }
 
   for (size_t i = firstChunk + 1; i < lastChunk; i++) {
+    // Interior chunks are copied wholesale into the result, so on a cache
+    // miss decompress straight into the destination rather than through
+    // |chunkUnits|. This avoids a second copy and doesn't churn the chunk
+    // cache with entries only needed for this one assembly.
+    constexpr size_t interiorChunkLength = Compressor::CHUNK_SIZE / sizeof(Unit);
+
     UncompressedSourceCache::AutoHoldEntry chunkHolder;
-    const Unit* units = chunkUnits<Unit>(cx, chunkHolder, i);
-    if (!units) {
+    ScriptSourceChunk ssc(this, i);
+    if (const Unit* units =
+            cx->caches().uncompressedSourceCache.lookup<Unit>(ssc,
+                                                              chunkHolder)) {
+      cursor = std::copy_n(units, interiorChunkLength, cursor);
+      continue;
+    }
+
+    const CompressedData<Unit>& c = *compressedData<Unit>();
+    if (!DecompressStringChunk(
+            reinterpret_cast<const unsigned char*>(c.raw.chars()), i,
+            reinterpret_cast<unsigned char*>(cursor),
+            Compressor::CHUNK_SIZE)) {
+      JS_ReportOutOfMemory(cx);
       return nullptr;
     }
 
-    cursor = std::copy_n(units, Compressor::CHUNK_SIZE / sizeof(Unit), cursor);
+    cursor += interiorChunkLength;
   }
 
   {
@@ -1029,6 +1029,23 @@ RegExpRunStatus RegExpShared::execute(JSContext* cx,
 
   CompilationMode mode = matches ? Normal : MatchOnly;
 
+  /*
+   * A Normal-mode compilation can service match-only execution; it just
+   * additionally fills in a match pairs vector. If one already exists for
+   * this input width, reuse it instead of compiling the pattern a second
+   * time in MatchOnly mode, which doubles compile time and code memory for
+   * patterns used both exec()-style and test()-style.
+   */
+  VectorMatchPairs scratchMatches;
+  size_t* reusedEndIndex = nullptr;
+  if (mode == MatchOnly && !re->canStringMatch &&
+      re->isCompiled(Normal, input->hasLatin1Chars())) {
+    mode = Normal;
+    reusedEndIndex = endIndex;
+    endIndex = nullptr;
+    matches = &scratchMatches;
+  }
+
   /* Compile the code at point-of-use. */
   if (!compileIfNecessary(cx, re, input, mode, DontForceByteCode)) {
     return RegExpRunStatus_Error;
@@ -1130,6 +1147,9 @@ RegExpRunStatus RegExpShared::execute(JSContext* cx,
     if (matches) {
       matches->checkAgainst(length);
     }
+    if (reusedEndIndex) {
+      *reusedEndIndex = (*matches)[0].limit;
+    }
     return RegExpRunStatus_Success;
   } while (false);
 
@@ -1159,6 +1179,9 @@ RegExpRunStatus RegExpShared::execute(JSContext* cx,
 
   if (result == RegExpRunStatus_Success && matches) {
     matches->checkAgainst(length);
+    if (reusedEndIndex) {
+      *reusedEndIndex = (*matches)[0].limit;
+    }
   }
   return result;
 }
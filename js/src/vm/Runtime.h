@@ -317,6 +317,10 @@ struct JSRuntime : public js::MallocProvider<JSRuntime> {
   // |sample| is the data to add to the histogram.
   void addTelemetry(int id, uint32_t sample, const char* key = nullptr);
 
+  // Whether a telemetry callback has been registered. Lets hot paths skip
+  // computing samples (e.g. timestamps) that nothing will consume.
+  bool hasTelemetryCallback() const { return !!telemetryCallback.ref(); }
+
   void setTelemetryCallback(JSRuntime* rt,
                             JSAccumulateTelemetryDataCallback callback);
 
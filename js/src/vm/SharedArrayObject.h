@@ -59,6 +59,12 @@ class SharedArrayRawBuffer {
   // location within this buffer.
   FutexWaiter* waiters_;
 
+  // The number of tasks on the waiters_ list, plus any tasks that are in
+  // the process of adding themselves. Modified only while the futex API
+  // lock is held, but read without that lock by the Atomics.notify fast
+  // path; see hasWaiters().
+  mozilla::Atomic<uint32_t> waiterCount_;
+
   uint8_t* basePointer() {
     SharedMem<uint8_t*> p = dataPointerShared() - gc::SystemPageSize();
     MOZ_ASSERT(p.asValue() % gc::SystemPageSize() == 0);
@@ -74,7 +80,8 @@ class SharedArrayRawBuffer {
         maxSize_(maxSize),
         mappedSize_(mappedSize),
         preparedForWasm_(preparedForWasm),
-        waiters_(nullptr) {
+        waiters_(nullptr),
+        waiterCount_(0) {
     MOZ_ASSERT(buffer == dataPointerShared());
   }
 
@@ -102,6 +109,19 @@ class SharedArrayRawBuffer {
   // care of mutual exclusion.
   void setWaiters(FutexWaiter* waiters) { waiters_ = waiters; }
 
+  // These may only be called while the futex API lock is held.
+  void incWaiterCount() { waiterCount_++; }
+  void decWaiterCount() {
+    MOZ_ASSERT(waiterCount_ > 0);
+    waiterCount_--;
+  }
+
+  // This may be called without the futex API lock held.  The read-modify-
+  // write operation is a full memory fence, so writes performed by the
+  // caller before the check are visible to any task that subsequently
+  // re-reads the waited-on location; see atomics_notify_impl().
+  bool hasWaiters() { return (waiterCount_ += 0) != 0; }
+
   SharedMem<uint8_t*> dataPointerShared() const {
     uint8_t* ptr =
         reinterpret_cast<uint8_t*>(const_cast<SharedArrayRawBuffer*>(this));
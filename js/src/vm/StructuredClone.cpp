@@ -837,12 +837,21 @@ bool SCOutput::writeArray(const T* p, size_t nelems) {
     return true;
   }
 
+#if MOZ_LITTLE_ENDIAN
+  // The endian swap is a no-op, so the whole array can be appended in one
+  // copy instead of sizeof(T) bytes at a time. This matters for string chars
+  // and typed array contents, which dominate large postMessage payloads.
+  if (!buf.AppendBytes(reinterpret_cast<const char*>(p), nelems * sizeof(T))) {
+    return false;
+  }
+#else
   for (size_t i = 0; i < nelems; i++) {
     T value = NativeEndian::swapToLittleEndian(p[i]);
     if (!buf.AppendBytes(reinterpret_cast<char*>(&value), sizeof(value))) {
       return false;
     }
   }
+#endif
 
   // Zero-pad to 8 bytes boundary.
   size_t padbytes = ComputePadding(nelems, sizeof(T));
@@ -3306,6 +3306,16 @@ static inline bool NeedToRecordAttrChange(
   return aStyleSet.MightHaveAttributeDependency(aElement, aAttribute);
 }
 
+// Note for people looking to add a batching API for bulk attribute updates
+// (e.g. data grids setting tens of thousands of attributes per refresh):
+// the expensive-looking parts here are already amortized. The restyle hints
+// and change hints we note below are only processed at the next style flush,
+// the element snapshot is captured once per element per flush no matter how
+// many of its attributes change (see ServoElementSnapshot::AddAttrs), and
+// NeedToRecordAttrChange skips the snapshot entirely for attributes no
+// selector can depend on. What remains per call is the mutation observer
+// notification walk, which the MutationObserver spec requires per mutation,
+// so an explicit batching scope would have little left to coalesce.
 void RestyleManager::AttributeWillChange(Element* aElement,
                                          int32_t aNameSpaceID,
                                          nsAtom* aAttribute, int32_t aModType) {
@@ -1552,7 +1552,8 @@ struct nsGenConInitializer {
 already_AddRefed<nsIContent> nsCSSFrameConstructor::CreateGenConTextNode(
     nsFrameConstructorState& aState, const nsString& aString,
     UniquePtr<nsGenConInitializer> aInitializer) {
-  RefPtr<nsTextNode> content = new nsTextNode(mDocument->NodeInfoManager());
+  nsNodeInfoManager* nim = mDocument->NodeInfoManager();
+  RefPtr<nsTextNode> content = new (nim) nsTextNode(nim);
   content->SetText(aString, false);
   if (aInitializer) {
     aInitializer->mNode->mText = content;
@@ -5104,13 +5105,15 @@ bool nsCSSFrameConstructor::ShouldCreateItemsForChild(
     return false;
   }
 
-  // don't create a whitespace frame if aParent doesn't want it
-  if (!NeedFrameFor(aState, aParentFrame, aContent)) {
+  // never create frames for comments or PIs; check this before the
+  // whitespace machinery below since it's a plain node-type test while
+  // NeedFrameFor() may set state flags and look at the parent frame type.
+  if (aContent->IsComment() || aContent->IsProcessingInstruction()) {
     return false;
   }
 
-  // never create frames for comments or PIs
-  if (aContent->IsComment() || aContent->IsProcessingInstruction()) {
+  // don't create a whitespace frame if aParent doesn't want it
+  if (!NeedFrameFor(aState, aParentFrame, aContent)) {
     return false;
   }
 
@@ -97,6 +97,12 @@ nsLayoutHistoryState::AddNewPresState(const nsACString& aKey, float aScrollX,
 
 void nsLayoutHistoryState::AddState(const nsCString& aStateKey,
                                     UniquePtr<PresState> aState) {
+  if (mScrollPositionOnly) {
+    // Don't retain state that will never be restored; see
+    // SetScrollPositionOnly().
+    aState->contentData() = void_t();
+    aState->disabledSet() = false;
+  }
   mStates.Put(aStateKey, std::move(aState));
 }
 
@@ -123,6 +129,19 @@ void nsLayoutHistoryState::RemoveState(const nsCString& aKey) {
 bool nsLayoutHistoryState::HasStates() { return mStates.Count() != 0; }
 
 void nsLayoutHistoryState::SetScrollPositionOnly(const bool aFlag) {
+  if (aFlag && !mScrollPositionOnly) {
+    // Drop the state that GetState() would strip anyway, right away. Form
+    // content data can be large (e.g. textarea contents) and this object
+    // lives in session history for as long as its entry does, so there's no
+    // point in keeping data around that will never be restored.
+    for (auto iter = mStates.Iter(); !iter.Done(); iter.Next()) {
+      PresState* state = iter.Data().get();
+      if (state) {
+        state->contentData() = void_t();
+        state->disabledSet() = false;
+      }
+    }
+  }
   mScrollPositionOnly = aFlag;
 }
 
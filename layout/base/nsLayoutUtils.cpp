@@ -4190,9 +4190,11 @@ nsresult nsLayoutUtils::PaintFrame(gfxContext* aRenderingContext,
     } else {
       printf(
           "DL partial build success!"
-          " new: %d, reused: %d, rebuilt: %d, removed: %d, total: %d\n",
-          metrics->mNewItems, metrics->mReusedItems, metrics->mRebuiltItems,
-          metrics->mRemovedItems, metrics->mTotalItems);
+          " modified frames: %d, new: %d, reused: %d, rebuilt: %d, removed: %d,"
+          " total: %d\n",
+          metrics->mModifiedFramesCount, metrics->mNewItems,
+          metrics->mReusedItems, metrics->mRebuiltItems, metrics->mRemovedItems,
+          metrics->mTotalItems);
     }
   }
 #endif
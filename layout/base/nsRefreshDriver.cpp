@@ -32,7 +32,6 @@
 #include "mozilla/Assertions.h"
 #include "mozilla/AutoRestore.h"
 #include "mozilla/DebugOnly.h"
-#include "mozilla/IntegerRange.h"
 #include "mozilla/PresShell.h"
 #include "mozilla/dom/FontTableURIProtocolHandler.h"
 #include "nsITimer.h"
@@ -40,8 +39,10 @@
 #include "nsPresContext.h"
 #include "nsComponentManagerUtils.h"
 #include "mozilla/Logging.h"
+#include "mozilla/dom/DocGroup.h"
 #include "mozilla/dom/Document.h"
 #include "mozilla/dom/DocumentInlines.h"
+#include "mozilla/PerformanceCounter.h"
 #include "nsIXULRuntime.h"
 #include "jsapi.h"
 #include "nsContentUtils.h"
@@ -1073,7 +1074,7 @@ nsRefreshDriver::GetMinRecomputeVisibilityInterval() {
 }
 
 RefreshDriverTimer* nsRefreshDriver::ChooseTimer() const {
-  if (mThrottled) {
+  if (mThrottled || mWidgetFullyOccluded) {
     if (!sThrottledRateTimer)
       sThrottledRateTimer = new InactiveRefreshDriverTimer(
           GetThrottledTimerInterval(),
@@ -1106,6 +1107,7 @@ nsRefreshDriver::nsRefreshDriver(nsPresContext* aPresContext)
           TimeDuration::FromMilliseconds(GetThrottledTimerInterval())),
       mMinRecomputeVisibilityInterval(GetMinRecomputeVisibilityInterval()),
       mThrottled(false),
+      mWidgetFullyOccluded(false),
       mNeedToRecomputeVisibility(false),
       mTestControllingRefreshes(false),
       mViewManagerFlushIsPending(false),
@@ -1679,6 +1681,8 @@ void nsRefreshDriver::RunFrameRequestCallbacks(TimeStamp aNowTime) {
     AUTO_PROFILER_TRACING_DOCSHELL("Paint", "Scripts", GRAPHICS,
                                    GetDocShell(mPresContext));
     for (const DocumentFrameCallbacks& docCallbacks : frameRequestCallbacks) {
+      TimeStamp startTime = TimeStamp::Now();
+
       // XXXbz Bug 863140: GetInnerWindow can return the outer
       // window in some cases.
       nsPIDOMWindowInner* innerWindow =
@@ -1707,6 +1711,19 @@ void nsRefreshDriver::RunFrameRequestCallbacks(TimeStamp aNowTime) {
         // mutated by the call.
         MOZ_KnownLive(callback.mCallback)->Call(timeStamp);
       }
+
+      // Attribute the time we spent in this document's callbacks to its
+      // DocGroup, the same way TimeoutManager accounts for timer callbacks,
+      // so that a busy requestAnimationFrame loop in a background iframe
+      // shows up against that iframe rather than the top-level page.
+      if (dom::DocGroup* docGroup = docCallbacks.mDocument->GetDocGroup()) {
+        if (PerformanceCounter* counter = docGroup->GetPerformanceCounter()) {
+          counter->IncrementDispatchCounter(
+              DispatchCategory(TaskCategory::RefreshDriver));
+          counter->IncrementExecutionDuration(
+              (TimeStamp::Now() - startTime).ToMicroseconds());
+        }
+      }
     }
   }
 }
@@ -2349,6 +2366,16 @@ void nsRefreshDriver::SetThrottled(bool aThrottled) {
   }
 }
 
+void nsRefreshDriver::SetWidgetFullyOccluded(bool aOccluded) {
+  if (aOccluded != mWidgetFullyOccluded) {
+    mWidgetFullyOccluded = aOccluded;
+    if (mActiveTimer) {
+      // As in SetThrottled(), swap to the timer ChooseTimer() now selects.
+      EnsureTimerStarted(eForceAdjustTimer);
+    }
+  }
+}
+
 /*static*/
 void nsRefreshDriver::PVsyncActorCreated(VsyncChild* aVsyncChild) {
   MOZ_ASSERT(NS_IsMainThread());
@@ -2418,11 +2445,10 @@ void nsRefreshDriver::ScheduleFullscreenEvent(
 }
 
 void nsRefreshDriver::CancelPendingFullscreenEvents(Document* aDocument) {
-  for (auto i : Reversed(IntegerRange(mPendingFullscreenEvents.Length()))) {
-    if (mPendingFullscreenEvents[i]->Document() == aDocument) {
-      mPendingFullscreenEvents.RemoveElementAt(i);
-    }
-  }
+  mPendingFullscreenEvents.RemoveElementsBy(
+      [aDocument](const UniquePtr<PendingFullscreenEvent>& aEvent) {
+        return aEvent->Document() == aDocument;
+      });
 }
 
 void nsRefreshDriver::CancelPendingAnimationEvents(
@@ -329,6 +329,15 @@ class nsRefreshDriver final : public mozilla::layers::TransactionIdAllocator,
    */
   void SetThrottled(bool aThrottled);
 
+  /**
+   * Mark the refresh driver as belonging to a widget that is (or no longer
+   * is) fully occluded by other windows, as reported by the widget layer.
+   * Nothing an occluded window paints can be seen, so it is ticked on the
+   * throttled timer; this is kept separate from SetThrottled(), which is
+   * driven by presshell activity.
+   */
+  void SetWidgetFullyOccluded(bool aOccluded);
+
   /**
    * Return the prescontext we were initialized with
    */
@@ -510,6 +519,7 @@ class nsRefreshDriver final : public mozilla::layers::TransactionIdAllocator,
   const mozilla::TimeDuration mMinRecomputeVisibilityInterval;
 
   bool mThrottled;
+  bool mWidgetFullyOccluded;
   bool mNeedToRecomputeVisibility;
   bool mTestControllingRefreshes;
   bool mViewManagerFlushIsPending;
@@ -338,8 +338,8 @@ static already_AddRefed<Element> CreateEmptyDivWithTextNode(
   RefPtr<Element> element = CreateEmptyDiv(aOwnerFrame);
 
   // Create the text node for DIV
-  RefPtr<nsTextNode> textNode =
-      new nsTextNode(element->OwnerDoc()->NodeInfoManager());
+  nsNodeInfoManager* nim = element->OwnerDoc()->NodeInfoManager();
+  RefPtr<nsTextNode> textNode = new (nim) nsTextNode(nim);
   textNode->MarkAsMaybeModifiedFrequently();
 
   element->AppendChildTo(textNode, false);
@@ -1185,8 +1185,8 @@ nsresult nsTextControlFrame::UpdateValueDisplay(bool aNotify,
   Text* textContent;
   if (!childContent) {
     // Set up a textnode with our value
-    RefPtr<nsTextNode> textNode =
-        new nsTextNode(mContent->NodeInfo()->NodeInfoManager());
+    nsNodeInfoManager* nim = mContent->NodeInfo()->NodeInfoManager();
+    RefPtr<nsTextNode> textNode = new (nim) nsTextNode(nim);
     textNode->MarkAsMaybeModifiedFrequently();
 
     mRootNode->AppendChildTo(textNode, aNotify);
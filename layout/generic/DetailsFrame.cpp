@@ -100,7 +100,8 @@ nsresult DetailsFrame::CreateAnonymousContent(
   nsAutoString defaultSummaryText;
   nsContentUtils::GetLocalizedString(nsContentUtils::eFORMS_PROPERTIES,
                                      "DefaultSummary", defaultSummaryText);
-  RefPtr<nsTextNode> description = new nsTextNode(nodeInfoManager);
+  RefPtr<nsTextNode> description =
+      new (nodeInfoManager) nsTextNode(nodeInfoManager);
   description->SetText(defaultSummaryText, false);
   mDefaultSummary->AppendChildTo(description, false);
 
@@ -1996,6 +1996,7 @@ ScrollFrameHelper::ScrollFrameHelper(nsContainerFrame* aOuter, bool aIsRoot)
       mLastUpdateFramesPos(-1, -1),
       mDisplayPortAtLastFrameUpdate(),
       mScrollParentID(mozilla::layers::ScrollableLayerGuid::NULL_SCROLL_ID),
+      mDisplayPortExpiryFlipFlops(0),
       mAnchor(this),
       mAllowScrollOriginDowngrade(false),
       mHadDisplayPortAtLastFrameUpdate(false),
@@ -2389,6 +2390,12 @@ bool ScrollFrameHelper::IsAlwaysActive() const {
           styles.mVertical != StyleOverflow::Hidden);
 }
 
+// A displayport expiration counts as a "flip-flop" if scrolling resumes
+// within this many multiples of the expiry timeout afterwards.
+static const uint32_t kDisplayPortExpiryFlipFlopWindow = 10;
+// Cap on the expiry backoff: at most 2^5 = 32x the base timeout.
+static const uint32_t kDisplayPortExpiryMaxBackoff = 5;
+
 static void RemoveDisplayPortCallback(nsITimer* aTimer, void* aClosure) {
   ScrollFrameHelper* helper = static_cast<ScrollFrameHelper*>(aClosure);
 
@@ -2421,6 +2428,10 @@ static void RemoveDisplayPortCallback(nsITimer* aTimer, void* aClosure) {
   // recently and so the reset should be correct.
   nsLayoutUtils::RemoveDisplayPort(helper->mOuter->GetContent());
   nsLayoutUtils::ExpireDisplayPortOnAsyncScrollableAncestor(helper->mOuter);
+  // Remember when we dropped the displayport, so that if scrolling resumes
+  // soon afterwards we can recognize the flip-flop and keep the next
+  // displayport around longer.
+  helper->mLastDisplayPortExpiry = TimeStamp::Now();
   helper->mOuter->SchedulePaint();
   // Be conservative and unflag this this scrollframe as being scrollable by
   // APZ. If it is still scrollable this will get flipped back soon enough.
@@ -2448,6 +2459,28 @@ void ScrollFrameHelper::MarkRecentlyScrolled() {
     return;
   }
 
+  // If scrolling resumed not long after our displayport expired, the
+  // expiration was a bad call: removing the displayport forced a repaint,
+  // and regaining it now forces another. Count the flip-flop so the next
+  // expiration waits longer, which keeps intermittently-used scrollers
+  // (e.g. nested scrollers on dashboard-style pages) layerized instead of
+  // thrashing between painted and layerized states.
+  if (!mLastDisplayPortExpiry.IsNull()) {
+    uint32_t expiryTime = StaticPrefs::APZDisplayPortExpiryTime();
+    TimeDuration sinceExpiry = TimeStamp::Now() - mLastDisplayPortExpiry;
+    if (expiryTime &&
+        sinceExpiry.ToMilliseconds() <
+            double(expiryTime) * kDisplayPortExpiryFlipFlopWindow) {
+      mDisplayPortExpiryFlipFlops = std::min(mDisplayPortExpiryFlipFlops + 1,
+                                             kDisplayPortExpiryMaxBackoff);
+    } else {
+      // The displayport stayed expired through a long idle period, so the
+      // expiration was worthwhile; start trusting the base timeout again.
+      mDisplayPortExpiryFlipFlops = 0;
+    }
+    mLastDisplayPortExpiry = TimeStamp();
+  }
+
   if (mActivityExpirationState.IsTracked()) {
     gScrollFrameActivityTracker->MarkUsed(this);
   } else {
@@ -2465,9 +2498,12 @@ void ScrollFrameHelper::MarkRecentlyScrolled() {
 
 void ScrollFrameHelper::ResetDisplayPortExpiryTimer() {
   if (mDisplayPortExpiryTimer) {
+    // Each recent flip-flop doubles the timeout, so a scroller that keeps
+    // getting its displayport revived becomes progressively stickier.
+    uint32_t timeout = StaticPrefs::APZDisplayPortExpiryTime()
+                       << mDisplayPortExpiryFlipFlops;
     mDisplayPortExpiryTimer->InitWithNamedFuncCallback(
-        RemoveDisplayPortCallback, this,
-        StaticPrefs::APZDisplayPortExpiryTime(), nsITimer::TYPE_ONE_SHOT,
+        RemoveDisplayPortCallback, this, timeout, nsITimer::TYPE_ONE_SHOT,
         "ScrollFrameHelper::ResetDisplayPortExpiryTimer");
   }
 }
@@ -652,6 +652,17 @@ class ScrollFrameHelper : public nsIReflowCallback {
   // Timer to remove the displayport some time after scrolling has stopped
   nsCOMPtr<nsITimer> mDisplayPortExpiryTimer;
 
+  // When our displayport last expired; null if scrolling has resumed (or
+  // never happened) since then.  Used to detect layerization flip-flops,
+  // where an intermittently-used scroller keeps losing its displayport and
+  // then repainting to regain it.
+  mozilla::TimeStamp mLastDisplayPortExpiry;
+
+  // Number of consecutive flip-flops detected; each one doubles the expiry
+  // timeout (up to a cap) so the layerization decision becomes stickier for
+  // scrollers that are scrolled intermittently.
+  uint32_t mDisplayPortExpiryFlipFlops;
+
   ScrollAnchorContainer mAnchor;
 
   bool mAllowScrollOriginDowngrade : 1;
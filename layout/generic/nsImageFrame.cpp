@@ -1752,7 +1752,10 @@ void nsDisplayImage::Paint(nsDisplayListBuilder* aBuilder, gfxContext* aCtx) {
     flags |= imgIContainer::FLAG_SYNC_DECODE;
   }
   if (aBuilder->IsPaintingToWindow()) {
-    flags |= imgIContainer::FLAG_HIGH_QUALITY_SCALING;
+    // We're drawing this image on screen right now, so any decode it kicks
+    // off should run ahead of speculative decodes of offscreen images.
+    flags |= imgIContainer::FLAG_HIGH_QUALITY_SCALING |
+             imgIContainer::FLAG_HIGH_PRIORITY;
   }
 
   ImgDrawResult result = static_cast<nsImageFrame*>(mFrame)->PaintImage(
@@ -1915,7 +1918,10 @@ bool nsDisplayImage::CreateWebRenderCommands(
 
   uint32_t flags = imgIContainer::FLAG_ASYNC_NOTIFY;
   if (aDisplayListBuilder->IsPaintingToWindow()) {
-    flags |= imgIContainer::FLAG_HIGH_QUALITY_SCALING;
+    // We're drawing this image on screen right now, so any decode it kicks
+    // off should run ahead of speculative decodes of offscreen images.
+    flags |= imgIContainer::FLAG_HIGH_QUALITY_SCALING |
+             imgIContainer::FLAG_HIGH_PRIORITY;
   }
   if (aDisplayListBuilder->ShouldSyncDecodeImages()) {
     flags |= imgIContainer::FLAG_SYNC_DECODE;
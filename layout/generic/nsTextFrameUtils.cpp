@@ -6,6 +6,7 @@
 
 #include "nsTextFrameUtils.h"
 
+#include "mozilla/SSE.h"
 #include "nsBidiUtils.h"
 #include "nsCharTraits.h"
 #include "nsIContent.h"
@@ -45,6 +46,37 @@ static bool IsDiscardable(uint8_t ch, nsTextFrameUtils::Flags* aFlags) {
   return false;
 }
 
+#ifdef MOZILLA_MAY_SUPPORT_SSE2
+namespace mozilla {
+namespace SSE2 {
+uint32_t PlainAsciiRunLength(const uint8_t* aText, uint32_t aLength);
+uint32_t PlainAsciiRunLength(const char16_t* aText, uint32_t aLength);
+}  // namespace SSE2
+}  // namespace mozilla
+#endif
+
+/**
+ * Returns the length of the longest prefix of [aText, aText + aLength)
+ * consisting only of printable ASCII characters (U+0021..U+007F). Such
+ * characters pass through TransformText unchanged, so both of its loops can
+ * copy a whole run at once instead of classifying one character at a time.
+ */
+template <class CharT>
+static inline uint32_t PlainAsciiRunLength(const CharT* aText,
+                                           uint32_t aLength) {
+#ifdef MOZILLA_MAY_SUPPORT_SSE2
+  if (mozilla::supports_sse2()) {
+    return mozilla::SSE2::PlainAsciiRunLength(aText, aLength);
+  }
+#endif
+
+  uint32_t i = 0;
+  while (i < aLength && aText[i] > 0x20 && aText[i] < 0x80) {
+    i++;
+  }
+  return i;
+}
+
 static bool IsSegmentBreak(char16_t aCh) { return aCh == '\n' || aCh == '\r'; }
 
 static bool IsSpaceOrTab(char16_t aCh) { return aCh == ' ' || aCh == '\t'; }
@@ -202,6 +234,19 @@ CharT* nsTextFrameUtils::TransformText(const CharT* aText, uint32_t aLength,
     // Skip discardables.
     uint32_t i;
     for (i = 0; i < aLength; ++i) {
+      // Fast path: a run of printable ASCII characters is kept unchanged, and
+      // since such characters are not Arabic, it also resets lastCharArabic.
+      uint32_t runLength = PlainAsciiRunLength(aText + i, aLength - i);
+      if (runLength > 0) {
+        memcpy(aOutput, aText + i, runLength * sizeof(CharT));
+        aOutput += runLength;
+        aSkipChars->KeepChars(runLength);
+        lastCharArabic = false;
+        i += runLength;
+        if (i >= aLength) {
+          break;
+        }
+      }
       CharT ch = aText[i];
       if (IsDiscardable(ch, &flags)) {
         aSkipChars->SkipChar();
@@ -232,6 +277,20 @@ CharT* nsTextFrameUtils::TransformText(const CharT* aText, uint32_t aLength,
     bool inWhitespace = (*aIncomingFlags & INCOMING_WHITESPACE) != 0;
     uint32_t i;
     for (i = 0; i < aLength; ++i) {
+      // Fast path: printable ASCII characters need no white space processing
+      // and are kept unchanged, so copy whole runs of them at once.
+      uint32_t runLength = PlainAsciiRunLength(aText + i, aLength - i);
+      if (runLength > 0) {
+        memcpy(aOutput, aText + i, runLength * sizeof(CharT));
+        aOutput += runLength;
+        aSkipChars->KeepChars(runLength);
+        lastCharArabic = false;
+        inWhitespace = false;
+        i += runLength;
+        if (i >= aLength) {
+          break;
+        }
+      }
       CharT ch = aText[i];
       // CSS Text 3 - 4.1. The White Space Processing Rules
       // White space processing in CSS affects only the document white space
@@ -0,0 +1,60 @@
+/* -*- Mode: C++; tab-width: 8; indent-tabs-mode: nil; c-basic-offset: 2 -*- */
+/* vim: set ts=8 sts=2 et sw=2 tw=80: */
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+// This file should only be compiled if you're on x86 or x86_64.  Additionally,
+// you'll need to compile this file with -msse2 if you're using gcc.
+
+#include <emmintrin.h>
+#include "nscore.h"
+#include "mozilla/MathAlgorithms.h"
+
+namespace mozilla {
+namespace SSE2 {
+
+uint32_t PlainAsciiRunLength(const uint8_t* aText, uint32_t aLength) {
+  uint32_t i = 0;
+  const __m128i limit = _mm_set1_epi8(0x20);
+  while (i + 16 <= aLength) {
+    const __m128i vect =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(aText + i));
+    // Characters in 0x21..0x7F are exactly the ones that compare greater
+    // than 0x20 in a signed byte comparison; 0x80 and above are negative.
+    const int mask = _mm_movemask_epi8(_mm_cmpgt_epi8(vect, limit));
+    if (mask != 0xffff) {
+      return i + CountTrailingZeroes32(~mask & 0xffff);
+    }
+    i += 16;
+  }
+  while (i < aLength && aText[i] > 0x20 && aText[i] < 0x80) {
+    i++;
+  }
+  return i;
+}
+
+uint32_t PlainAsciiRunLength(const char16_t* aText, uint32_t aLength) {
+  uint32_t i = 0;
+  const __m128i lower = _mm_set1_epi16(0x20);
+  const __m128i upper = _mm_set1_epi16(0x80);
+  while (i + 8 <= aLength) {
+    const __m128i vect =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(aText + i));
+    const __m128i plain = _mm_and_si128(_mm_cmpgt_epi16(vect, lower),
+                                        _mm_cmplt_epi16(vect, upper));
+    // Each plain character contributes two set bits to the mask.
+    const int mask = _mm_movemask_epi8(plain);
+    if (mask != 0xffff) {
+      return i + CountTrailingZeroes32(~mask & 0xffff) / 2;
+    }
+    i += 8;
+  }
+  while (i < aLength && aText[i] > 0x20 && aText[i] < 0x80) {
+    i++;
+  }
+  return i;
+}
+
+}  // namespace SSE2
+}  // namespace mozilla
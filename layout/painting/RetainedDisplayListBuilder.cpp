@@ -1440,6 +1440,8 @@ PartialUpdateResult RetainedDisplayListBuilder::AttemptPartialUpdate(
   GetModifiedAndFramesWithProps(&mBuilder, &modifiedFrames.Frames(),
                                 &framesWithProps.Frames());
 
+  Metrics()->mModifiedFramesCount = modifiedFrames.Frames().Length();
+
   // Do not allow partial builds if the |ShouldBuildPartial()| heuristic fails.
   bool shouldBuildPartial = ShouldBuildPartial(modifiedFrames.Frames());
 
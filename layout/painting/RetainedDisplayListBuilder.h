@@ -114,6 +114,7 @@ struct RetainedDisplayListMetrics {
     mRemovedItems = 0;
     mReusedItems = 0;
     mTotalItems = 0;
+    mModifiedFramesCount = 0;
     mPartialBuildDuration = 0;
     mFullBuildDuration = 0;
     mPartialUpdateFailReason = PartialUpdateFailReason::NA;
@@ -160,6 +161,10 @@ struct RetainedDisplayListMetrics {
   unsigned int mReusedItems;
   unsigned int mTotalItems;
 
+  // The number of modified frames that drove this update; the scope of the
+  // rebuild, as opposed to the duration metrics below.
+  unsigned int mModifiedFramesCount;
+
   mozilla::TimeStamp mStartTime;
   double mPartialBuildDuration;
   double mFullBuildDuration;
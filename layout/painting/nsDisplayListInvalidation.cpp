@@ -5,9 +5,68 @@
  * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
 
 #include "nsDisplayListInvalidation.h"
+#include "mozilla/ArenaAllocator.h"
+#include "mozilla/MathAlgorithms.h"
+#include "mozilla/mozalloc.h"
 #include "nsDisplayList.h"
 #include "nsIFrame.h"
 #include "nsTableFrame.h"
+#include "nsThreadUtils.h"
+
+// Geometry objects are retained across paints by DisplayItemData, so unlike
+// the display items themselves they are not tied to the lifetime of any one
+// nsDisplayListBuilder and can't live in the builder's arena. Instead they
+// are pooled here, using the same power-of-two size classes that
+// nsDisplayListBuilder::Allocate uses for display items. The pool is a
+// main-thread-only process singleton that is deliberately never freed;
+// geometries are destroyed at arbitrary points of shutdown, so there is no
+// moment at which it could safely go away.
+static const size_t kGeometryPoolMaxSize = 1024;
+
+struct DisplayItemGeometryPool {
+  mozilla::ArenaAllocator<8192, 8> mArena;
+  // Indexed by FloorLog2Size of the rounded-up allocation size.
+  nsTArray<void*> mFreeLists[11];
+};
+
+static DisplayItemGeometryPool* gGeometryPool = nullptr;
+
+void* nsDisplayItemGeometry::operator new(size_t aSize) {
+  MOZ_ASSERT(NS_IsMainThread());
+  size_t roundedUpSize = mozilla::RoundUpPow2(aSize);
+  if (MOZ_UNLIKELY(roundedUpSize > kGeometryPoolMaxSize)) {
+    return moz_xmalloc(aSize);
+  }
+  if (!gGeometryPool) {
+    gGeometryPool = new DisplayItemGeometryPool();
+  }
+  nsTArray<void*>& freeList =
+      gGeometryPool->mFreeLists[mozilla::FloorLog2Size(roundedUpSize)];
+  size_t len = freeList.Length();
+  if (len > 0) {
+    // Remove from the end of the array to avoid memmoving entries, and
+    // retain the storage so that recycling an entry never needs to malloc.
+    void* result = freeList.ElementAt(len - 1);
+    freeList.SetLengthAndRetainStorage(len - 1);
+    return result;
+  }
+  return gGeometryPool->mArena.Allocate(roundedUpSize);
+}
+
+void nsDisplayItemGeometry::operator delete(void* aPtr, size_t aSize) {
+  MOZ_ASSERT(NS_IsMainThread());
+  // This is the sized variant of operator delete, so deleting through the
+  // virtual destructor hands us the dynamic type's size and we end up in the
+  // same size class that operator new picked.
+  size_t roundedUpSize = mozilla::RoundUpPow2(aSize);
+  if (MOZ_UNLIKELY(roundedUpSize > kGeometryPoolMaxSize)) {
+    free(aPtr);
+    return;
+  }
+  MOZ_ASSERT(gGeometryPool, "Freeing a geometry that was never allocated?");
+  gGeometryPool->mFreeLists[mozilla::FloorLog2Size(roundedUpSize)]
+      .AppendElement(aPtr);
+}
 
 nsDisplayItemGeometry::nsDisplayItemGeometry(nsDisplayItem* aItem,
                                              nsDisplayListBuilder* aBuilder) {
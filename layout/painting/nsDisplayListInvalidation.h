@@ -43,6 +43,15 @@ class nsDisplayItemGeometry {
   nsDisplayItemGeometry(nsDisplayItem* aItem, nsDisplayListBuilder* aBuilder);
   virtual ~nsDisplayItemGeometry();
 
+  /**
+   * A geometry object is allocated (and the previous one thrown away) for
+   * every display item that changed on every paint, so they are recycled
+   * through size-segregated freelists rather than handed back to malloc.
+   * Only usable on the main thread, like everything else about invalidation.
+   */
+  void* operator new(size_t aSize);
+  void operator delete(void* aPtr, size_t aSize);
+
   /**
    * Compute the area required to be invalidated if this
    * display item is removed.
@@ -6,6 +6,7 @@
 
 #include "nsPagePrintTimer.h"
 
+#include "mozilla/TimeStamp.h"
 #include "mozilla/Unused.h"
 #include "nsIContentViewer.h"
 #include "nsIServiceManager.h"
@@ -54,6 +55,11 @@ void nsPagePrintTimer::StopWatchDogTimer() {
   }
 }
 
+// How long one runnable may keep printing pages before yielding back to the
+// event loop. Yielding between batches is what keeps cancellation (and the
+// progress dialog) responsive, so this should stay small.
+static const uint32_t kPageBatchBudgetMs = 50;
+
 // nsRunnable
 NS_IMETHODIMP
 nsPagePrintTimer::Run() {
@@ -63,9 +69,20 @@ nsPagePrintTimer::Run() {
   bool inRange;
   bool donePrinting;
 
+  // Each page pays an event-loop round trip plus the inter-page delay, which
+  // dominates jobs with many cheap pages. Print pages until the time budget
+  // runs out, as long as the next page isn't waiting on the parent process
+  // (mWaitingForRemotePrint) or on canvas mozPrintCallbacks (PrePrintPage()).
+  //
   // donePrinting will be true if it completed successfully or
   // if the printing was cancelled
-  donePrinting = !mPrintJob || mPrintJob->PrintPage(mPrintObj, inRange);
+  TimeStamp deadline =
+      TimeStamp::Now() + TimeDuration::FromMilliseconds(kPageBatchBudgetMs);
+  do {
+    donePrinting = !mPrintJob || mPrintJob->PrintPage(mPrintObj, inRange);
+  } while (!donePrinting && !mWaitingForRemotePrint &&
+           TimeStamp::Now() < deadline && mPrintJob &&
+           mPrintJob->PrePrintPage());
   if (donePrinting) {
     if (mWaitingForRemotePrint ||
         // If we are not waiting for the remote printing, it is the time to
@@ -636,13 +636,23 @@ nsresult FontFaceSet::StartLoad(gfxUserFontEntry* aUserFontEntry,
       NS_ENSURE_SUCCESS(rv, rv);
     }
   }
+  // Only fonts that are in their block period actually keep text invisible
+  // while they load; a font whose font-display shows fallback text right
+  // away can queue behind them.  The boost is undone if the block period
+  // ends before the load does; see nsFontFaceLoader::LoadTimerCallback.
+  StyleFontDisplay fontDisplay = StaticPrefs::layout_css_font_display_enabled()
+                                     ? aUserFontEntry->GetFontDisplay()
+                                     : StyleFontDisplay::Auto;
+  bool blocksTextPaint = fontDisplay == StyleFontDisplay::Auto ||
+                         fontDisplay == StyleFontDisplay::Block;
+
   nsCOMPtr<nsISupportsPriority> priorityChannel(do_QueryInterface(channel));
-  if (priorityChannel) {
+  if (priorityChannel && blocksTextPaint) {
     priorityChannel->AdjustPriority(nsISupportsPriority::PRIORITY_HIGH);
   }
 
   nsCOMPtr<nsIClassOfService> cos(do_QueryInterface(channel));
-  if (cos) {
+  if (cos && blocksTextPaint) {
     cos->AddClassFlags(nsIClassOfService::TailForbidden);
   }
 
@@ -77,6 +77,16 @@ MOZ_MAKE_ENUM_CLASS_BITWISE_OPERATORS(OriginFlags)
 /**
  * The set of style sheets that apply to a document, backed by a Servo
  * Stylist.  A ServoStyleSet contains StyleSheets.
+ *
+ * Note on style sharing: all sharing of computed styles between elements
+ * happens in Servo's style sharing cache, which validates candidates by
+ * revalidation selectors and state/attribute comparison during a traversal.
+ * There is deliberately no C++ API here for handing one element another
+ * element's ComputedStyle (e.g. to speed up re-binding recycled DOM in
+ * virtualized lists): the C++ side can't run selector matching or see the
+ * rule node, so it has no way to prove such a reuse is sound. Restyling the
+ * recycled rows in a single flush already lets the sharing cache unify them;
+ * anything beyond that needs to be implemented in the Rust style system.
  */
 class ServoStyleSet {
   friend class RestyleManager;
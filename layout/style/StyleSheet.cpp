@@ -942,8 +942,19 @@ static bool AllowParallelParse(css::Loader* aLoader, nsIURI* aSheetURI) {
   // the relevant booleans as thread-safe var caches if we needed to, but
   // parsing chrome stylesheets in parallel is unlikely to be a win anyway.
   //
+  // (Don't be tempted to relax this just because pref lookups are allowed off
+  // the main thread during a Servo traversal: that is only safe because the
+  // main thread is blocked for the duration of the traversal, which is not
+  // the case while an async parse is running.)
+  //
   // Note that UA stylesheets can also use -moz-bool-pref, but those are always
   // parsed sync.
+  //
+  // Large chrome sheets (e.g. themes) where most rules sit behind inactive
+  // @media blocks would benefit more from the parser skipping over
+  // non-matching grouped rules until they become applicable, but that would
+  // have to be implemented in the Servo parser itself; by the time we get a
+  // RawServoStyleSheetContents back, everything has been parsed.
   if (dom::IsChromeURI(aSheetURI)) {
     return false;
   }
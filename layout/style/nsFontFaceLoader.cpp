@@ -21,8 +21,10 @@
 #include "nsPresContext.h"
 #include "nsIPrincipal.h"
 #include "nsIScriptSecurityManager.h"
+#include "nsIClassOfService.h"
 #include "nsIHttpChannel.h"
 #include "nsIContentPolicy.h"
+#include "nsISupportsPriority.h"
 #include "nsIThreadRetargetableRequest.h"
 #include "nsContentPolicyUtils.h"
 #include "nsNetCID.h"
@@ -192,6 +194,22 @@ void nsFontFaceLoader::LoadTimerCallback(nsITimer* aTimer, void* aClosure) {
              loader, ctx, static_cast<int>(fontDisplay)));
       }
     }
+
+    // The fallback font is shown from now on, so the download no longer
+    // holds up text paint.  Return the channel to normal priority so that
+    // fonts still in their block period, and other critical loads, win the
+    // bandwidth.
+    if (loader->mChannel) {
+      nsCOMPtr<nsISupportsPriority> priorityChannel(
+          do_QueryInterface(loader->mChannel));
+      if (priorityChannel) {
+        priorityChannel->SetPriority(nsISupportsPriority::PRIORITY_NORMAL);
+      }
+      nsCOMPtr<nsIClassOfService> cos(do_QueryInterface(loader->mChannel));
+      if (cos) {
+        cos->ClearClassFlags(nsIClassOfService::TailForbidden);
+      }
+    }
   }
 }
 
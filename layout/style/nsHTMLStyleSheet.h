@@ -57,6 +57,10 @@ class nsHTMLStyleSheet final {
   already_AddRefed<nsMappedAttributes> UniqueMappedAttributes(
       nsMappedAttributes* aMapped);
   void DropMappedAttributes(nsMappedAttributes* aMapped);
+  // Mark the table dirty so that the next call to
+  // CalculateMappedServoDeclarations() rescans it; needed when a cached
+  // declaration is dropped from a set that's already in the table.
+  void SetMappedAttrsDirty() { mMappedAttrsDirty = true; }
   // For each mapped presentation attribute in the cache, resolve
   // the attached DeclarationBlock by running the mapping
   // and converting the ruledata to Servo specified values.
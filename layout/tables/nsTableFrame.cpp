@@ -2941,10 +2941,21 @@ void nsTableFrame::ReflowChildren(TableReflowInput& aReflowInput,
                                          rowGroupFrame->GetRowCount());
     // Get the frame state bits
     // See if we should only reflow the dirty child frames
-    if (reflowAllKids || NS_SUBTREE_DIRTY(kidFrame) ||
+    bool reflowKid =
+        reflowAllKids || NS_SUBTREE_DIRTY(kidFrame) ||
         (aReflowInput.reflowInput.mFlags.mSpecialBSizeReflow &&
          (isPaginated ||
-          kidFrame->HasAnyStateBits(NS_FRAME_CONTAINS_RELATIVE_BSIZE)))) {
+          kidFrame->HasAnyStateBits(NS_FRAME_CONTAINS_RELATIVE_BSIZE)));
+    if (reflowKid && presContext->HasPendingInterrupt()) {
+      // An interrupt fired while reflowing an earlier row group. Mark this one
+      // dirty so that the resumed reflow picks it up, and treat it like a
+      // clean child below so that for now it just slides to its new position.
+      // Interrupts are never enabled in paginated contexts, so the
+      // fragmentation code below never has to deal with a half-reflowed table.
+      kidFrame->AddStateBits(NS_FRAME_IS_DIRTY);
+      reflowKid = false;
+    }
+    if (reflowKid) {
       if (pageBreak) {
         if (allowRepeatedFooter) {
           PlaceRepeatedFooter(aReflowInput, tfoot, footerHeight);
@@ -3103,6 +3114,11 @@ void nsTableFrame::ReflowChildren(TableReflowInput& aReflowInput,
       // Remember where we just were in case we end up pushing children
       prevKidFrame = kidFrame;
 
+      // Now do an interrupt check. We only do this when we actually reflowed
+      // the row group, so that if we get back in here the resumed reflow
+      // makes progress before interrupting again.
+      presContext->CheckForInterrupt(this);
+
       MOZ_ASSERT(!aStatus.IsIncomplete() || isPaginated,
                  "Table contents should only fragment in paginated contexts");
 
@@ -985,23 +985,24 @@ nsresult MediaPipelineTransmit::SetTrack(MediaStreamTrack* aDomTrack) {
 
 nsresult MediaPipeline::PipelineTransport::SendRtpPacket(const uint8_t* aData,
                                                          size_t aLen) {
-  nsAutoPtr<MediaPacket> packet(new MediaPacket);
-  packet->Copy(aData, aLen, aLen + SRTP_MAX_EXPANSION);
-  packet->SetType(MediaPacket::RTP);
-
-  RUN_ON_THREAD(
-      mStsThread,
-      WrapRunnable(RefPtr<MediaPipeline::PipelineTransport>(this),
-                   &MediaPipeline::PipelineTransport::SendRtpRtcpPacket_s,
-                   packet),
-      NS_DISPATCH_NORMAL);
+  MediaPacket packet;
+  packet.Copy(aData, aLen, aLen + SRTP_MAX_EXPANSION);
+  packet.SetType(MediaPacket::RTP);
+  return SendPacket(std::move(packet));
+}
 
-  return NS_OK;
+nsresult MediaPipeline::PipelineTransport::SendPacket(MediaPacket&& aPacket) {
+  // The packet buffer is moved, not copied, from here to the STS thread; this
+  // path runs once per RTP packet, so per-packet allocations add up.
+  return mStsThread->Dispatch(NewRunnableMethod<MediaPacket&&>(
+      "MediaPipeline::PipelineTransport::SendRtpRtcpPacket_s", this,
+      &MediaPipeline::PipelineTransport::SendRtpRtcpPacket_s,
+      std::move(aPacket)));
 }
 
 void MediaPipeline::PipelineTransport::SendRtpRtcpPacket_s(
-    nsAutoPtr<MediaPacket> aPacket) {
-  bool isRtp = aPacket->type() == MediaPacket::RTP;
+    MediaPacket&& aPacket) {
+  bool isRtp = aPacket.type() == MediaPacket::RTP;
 
   ASSERT_ON_THREAD(mStsThread);
   if (!mPipeline) {
@@ -1016,7 +1017,7 @@ void MediaPipeline::PipelineTransport::SendRtpRtcpPacket_s(
     return;
   }
 
-  MediaPacket packet(std::move(*aPacket));
+  MediaPacket packet(std::move(aPacket));
   packet.sdp_level() = Some(mPipeline->Level());
 
   if (RtpLogger::IsPacketLoggingOn()) {
@@ -1044,18 +1045,10 @@ void MediaPipeline::PipelineTransport::SendRtpRtcpPacket_s(
 
 nsresult MediaPipeline::PipelineTransport::SendRtcpPacket(const uint8_t* aData,
                                                           size_t aLen) {
-  nsAutoPtr<MediaPacket> packet(new MediaPacket);
-  packet->Copy(aData, aLen, aLen + SRTP_MAX_EXPANSION);
-  packet->SetType(MediaPacket::RTCP);
-
-  RUN_ON_THREAD(
-      mStsThread,
-      WrapRunnable(RefPtr<MediaPipeline::PipelineTransport>(this),
-                   &MediaPipeline::PipelineTransport::SendRtpRtcpPacket_s,
-                   packet),
-      NS_DISPATCH_NORMAL);
-
-  return NS_OK;
+  MediaPacket packet;
+  packet.Copy(aData, aLen, aLen + SRTP_MAX_EXPANSION);
+  packet.SetType(MediaPacket::RTCP);
+  return SendPacket(std::move(packet));
 }
 
 // Called if we're attached with AddDirectListener()
@@ -177,7 +177,8 @@ class MediaPipeline : public sigslot::has_slots<> {
     virtual nsresult SendRtcpPacket(const uint8_t* aData, size_t aLen) override;
 
    private:
-    void SendRtpRtcpPacket_s(nsAutoPtr<MediaPacket> aPacket);
+    nsresult SendPacket(MediaPacket&& aPacket);
+    void SendRtpRtcpPacket_s(MediaPacket&& aPacket);
 
     // Creates a cycle, which we break with Detach
     RefPtr<MediaPipeline> mPipeline;
@@ -2010,13 +2010,14 @@ static inline arena_t* choose_arena(size_t size) {
   // library version, libc's malloc is used by TLS allocation, which
   // introduces a bootstrapping issue.
 
-  if (size > kMaxQuantumClass) {
-    // Force the default arena for larger allocations.
-    ret = gArenas.GetDefault();
-  } else {
-    // Check TLS to see if our thread has requested a pinned arena.
-    ret = thread_arena.get();
-    if (!ret) {
+  // Check TLS to see if our thread has requested a pinned arena.
+  ret = thread_arena.get();
+  if (!ret) {
+    if (size > kMaxQuantumClass) {
+      // Don't bother pinning the thread for larger allocations; use the
+      // default arena directly.
+      ret = gArenas.GetDefault();
+    } else {
       // Nothing in TLS. Pin this thread to the default arena.
       ret = thread_local_arena(false);
     }
@@ -4089,6 +4090,7 @@ inline void MozJemalloc::jemalloc_stats(jemalloc_stats_t* aStats) {
   aStats->narenas = 0;
   aStats->mapped = 0;
   aStats->allocated = 0;
+  aStats->allocated_secondary = 0;
   aStats->waste = 0;
   aStats->page_cache = 0;
   aStats->bookkeeping = 0;
@@ -4161,6 +4163,9 @@ inline void MozJemalloc::jemalloc_stats(jemalloc_stats_t* aStats) {
     // allocated.
     aStats->mapped += arena_mapped;
     aStats->allocated += arena_allocated;
+    if (arena != gArenas.GetDefault()) {
+      aStats->allocated_secondary += arena_allocated;
+    }
     aStats->page_cache += arena_dirty;
     aStats->waste += arena_committed - arena_allocated - arena_dirty -
                      arena_unused - arena_headers;
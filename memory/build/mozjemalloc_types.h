@@ -82,6 +82,9 @@ typedef struct {
   // Current memory usage statistics.
   size_t mapped;       // Bytes mapped (not necessarily committed).
   size_t allocated;    // Bytes allocated (committed, in use by application).
+  size_t allocated_secondary;  // The subset of `allocated` that lives in
+                               // arenas other than the default one, i.e.
+                               // thread-local arenas and moz_arena arenas.
   size_t waste;        // Bytes committed, not in use by the
                        // application, and not intentionally left
                        // unused (i.e., not dirty).
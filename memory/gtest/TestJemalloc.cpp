@@ -106,6 +106,25 @@ bool InfoEqFreedPage(jemalloc_ptr_info_t& aInfo, void* aAddr, size_t aPageSize,
       ;
 }
 
+TEST(Jemalloc, StatsSecondaryArenas)
+{
+  arena_id_t arenaId = moz_create_arena();
+  ASSERT_TRUE(arenaId != 0);
+
+  jemalloc_stats_t stats;
+  jemalloc_stats(&stats);
+  size_t before = stats.allocated_secondary;
+
+  void* p = moz_arena_malloc(arenaId, 4096);
+  ASSERT_TRUE(p);
+
+  jemalloc_stats(&stats);
+  ASSERT_LE(stats.allocated_secondary, stats.allocated);
+  ASSERT_GE(stats.allocated_secondary, before + 4096);
+
+  moz_arena_free(arenaId, p);
+}
+
 TEST(Jemalloc, PtrInfo)
 {
   arena_id_t arenaId = moz_create_arena();
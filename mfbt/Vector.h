@@ -30,11 +30,36 @@
 #  pragma warning(disable : 4345)
 #endif
 
+template <class T>
+class RefPtr;
+
 namespace mozilla {
 
 template <typename T, size_t N, class AllocPolicy>
 class Vector;
 
+/*
+ * Specialize this trait to declare that instances of T may be relocated to a
+ * new address as raw bytes, without invoking the move constructor and the
+ * destructor of the source.  Vector uses this to grow the heap buffers of
+ * such types with pod_realloc() -- which the underlying allocator can often
+ * service by extending the allocation in place -- rather than by an
+ * allocate/move-construct/destroy/free cycle.
+ *
+ * This is only sound for types whose move constructor is equivalent to a
+ * bitwise copy of the source, with the moved-from object requiring no
+ * destructor action -- and only if nothing keeps a pointer to an element
+ * across the reallocation, which Vector already forbids.  Smart pointers like
+ * RefPtr qualify; types that register their own address somewhere, or contain
+ * interior pointers, do not.  PODs are trivially relocatable, but they don't
+ * take this path: they're handled by a wholly separate implementation below.
+ */
+template <typename T>
+struct ElementsAreRelocatable : IsPod<T> {};
+
+template <typename T>
+struct ElementsAreRelocatable<RefPtr<T>> : TrueType {};
+
 namespace detail {
 
 /*
@@ -124,6 +149,22 @@ struct VectorImpl {
   static inline MOZ_MUST_USE bool growTo(Vector<T, N, AP>& aV, size_t aNewCap) {
     MOZ_ASSERT(!aV.usingInlineStorage());
     MOZ_ASSERT(!CapacityHasExcessSpace<T>(aNewCap));
+    if (ElementsAreRelocatable<T>::value) {
+      /* The element type opted into relocation by memcpy, so grow with
+       * realloc like the POD implementation does and skip the per-element
+       * move-construct/destroy pass entirely.  Reallocation often extends
+       * the buffer in place, in which case the elements aren't even
+       * copied. */
+      T* newbuf =
+          aV.template pod_realloc<T>(aV.mBegin, aV.mTail.mCapacity, aNewCap);
+      if (MOZ_UNLIKELY(!newbuf)) {
+        return false;
+      }
+      aV.mBegin = newbuf;
+      /* aV.mLength is unchanged. */
+      aV.mTail.mCapacity = aNewCap;
+      return true;
+    }
     T* newbuf = aV.template pod_malloc<T>(aNewCap);
     if (MOZ_UNLIKELY(!newbuf)) {
       return false;
@@ -5,6 +5,7 @@
  * You can obtain one at http://mozilla.org/MPL/2.0/. */
 
 #include "mozilla/Move.h"
+#include "mozilla/RefPtr.h"
 #include "mozilla/UniquePtr.h"
 #include "mozilla/Vector.h"
 
@@ -24,6 +25,7 @@ struct mozilla::detail::VectorTesting {
   static void testInsert();
   static void testErase();
   static void testPodResizeToFit();
+  static void testRelocatableGrowth();
 };
 
 void mozilla::detail::VectorTesting::testReserved() {
@@ -557,6 +559,68 @@ void mozilla::detail::VectorTesting::testPodResizeToFit() {
   MOZ_ASSERT(v2.capacity() == 2);
 }
 
+namespace {
+
+// A minimal refcounted type for testRelocatableGrowth.  The liveCount/refCnt
+// bookkeeping would be corrupted if growing the vector ran any extra
+// AddRef/Release pairs or leaked an element.
+class Counted {
+ public:
+  Counted() : mRefCnt(0) { ++sLiveCount; }
+
+  void AddRef() { ++mRefCnt; }
+
+  void Release() {
+    MOZ_RELEASE_ASSERT(mRefCnt > 0);
+    if (--mRefCnt == 0) {
+      delete this;
+    }
+  }
+
+  static size_t sLiveCount;
+
+ private:
+  ~Counted() { --sLiveCount; }
+
+  size_t mRefCnt;
+};
+
+/* static */ size_t Counted::sLiveCount = 0;
+
+}  // namespace
+
+void mozilla::detail::VectorTesting::testRelocatableGrowth() {
+  static_assert(mozilla::ElementsAreRelocatable<RefPtr<Counted>>::value,
+                "RefPtr is declared relocatable in Vector.h");
+  static_assert(!mozilla::ElementsAreRelocatable<S>::value,
+                "types must opt into relocatability");
+
+  {
+    // Start in inline storage and grow well past it, so that both
+    // convertToHeapStorage and the realloc-based growTo path run.
+    Vector<RefPtr<Counted>, 2> vec;
+    for (size_t i = 0; i < 64; i++) {
+      MOZ_RELEASE_ASSERT(vec.append(RefPtr<Counted>(new Counted())));
+    }
+    MOZ_RELEASE_ASSERT(vec.length() == 64);
+    MOZ_RELEASE_ASSERT(Counted::sLiveCount == 64);
+    for (const RefPtr<Counted>& p : vec) {
+      MOZ_RELEASE_ASSERT(p);
+    }
+
+    // Growing must not disturb the refcount of a shared element either.
+    RefPtr<Counted> shared = vec[0];
+    while (vec.length() < 256) {
+      MOZ_RELEASE_ASSERT(vec.append(shared));
+    }
+    MOZ_RELEASE_ASSERT(Counted::sLiveCount == 64);
+
+    vec.clearAndFree();
+    MOZ_RELEASE_ASSERT(Counted::sLiveCount == 1);
+  }
+  MOZ_RELEASE_ASSERT(Counted::sLiveCount == 0);
+}
+
 // Declare but leave (permanently) incomplete.
 struct Incomplete;
 
@@ -672,5 +736,6 @@ int main() {
   VectorTesting::testInsert();
   VectorTesting::testErase();
   VectorTesting::testPodResizeToFit();
+  VectorTesting::testRelocatableGrowth();
   TestVectorBeginNonNull();
 }
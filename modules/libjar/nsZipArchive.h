@@ -8,7 +8,10 @@
 
 #include "mozilla/Attributes.h"
 
-#define ZIP_TABSIZE 256
+/* The omni.ja archives hold several thousand entries, so a 256-bucket table
+ * left GetItem() walking long collision chains on every chrome lookup.  2048
+ * buckets keeps the chains short for 16KB of pointers per archive. */
+#define ZIP_TABSIZE 2048
 #define ZIP_BUFLEN \
   (4 * 1024) /* Used as output buffer when deflating items to a file */
 
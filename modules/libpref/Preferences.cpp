@@ -2639,27 +2639,17 @@ nsPrefBranch::GetChildList(const char* aStartingAt,
 
   MOZ_ASSERT(NS_IsMainThread());
 
-  // This will contain a list of all the pref name strings. Allocated on the
-  // stack for speed.
-  AutoTArray<nsCString, 32> prefArray;
-
   const PrefName& parent = GetPrefName(aStartingAt);
   size_t parentLen = parent.Length();
   for (auto& pref : PrefsIter(gHashTable, gSharedMap)) {
     if (strncmp(pref->Name(), parent.get(), parentLen) == 0) {
-      prefArray.AppendElement(pref->NameString());
+      // we need to lop off mPrefRoot in case the user is planning to pass this
+      // back to us because if they do we are going to add mPrefRoot again.
+      aChildArray.AppendElement(
+          Substring(pref->NameString(), mPrefRoot.Length()));
     }
   }
 
-  // Now that we've built up the list, run the callback on all the matching
-  // elements.
-  aChildArray.SetCapacity(prefArray.Length());
-  for (auto& element : prefArray) {
-    // we need to lop off mPrefRoot in case the user is planning to pass this
-    // back to us because if they do we are going to add mPrefRoot again.
-    aChildArray.AppendElement(Substring(element, mPrefRoot.Length()));
-  }
-
   return NS_OK;
 }
 
@@ -775,7 +775,11 @@ Predictor::PredictNative(nsIURI* targetURI, nsIURI* sourceURI,
   originKey->GetAsciiSpec(originKeyStr);
   PREDICTOR_LOG(("    Predict origin=%s reason=%d action=%p",
                  originKeyStr.get(), reason, originAction.get()));
+  // The origin-only entry feeds the preconnect/preresolve decisions for the
+  // pageload that is starting right now, so read its metadata with priority
+  // just like the full uri entry above.
   openFlags = nsICacheStorage::OPEN_READONLY | nsICacheStorage::OPEN_SECRETLY |
+              nsICacheStorage::OPEN_PRIORITY |
               nsICacheStorage::CHECK_MULTITHREADED;
   cacheDiskStorage->AsyncOpenURI(originKey,
                                  NS_LITERAL_CSTRING(PREDICTOR_ORIGIN_EXTENSION),
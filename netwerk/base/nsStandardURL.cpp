@@ -654,6 +654,27 @@ uint32_t nsStandardURL::AppendToBuf(char* buf, uint32_t i, const char* str,
   return i + len;
 }
 
+// Returns true if the hostname is already in its canonical form: plain
+// lowercase ASCII letters, digits, '.' and '-', with no percent-escapes and
+// no ACE ("xn--") labels.  Such hosts come out of NS_UnescapeURL and the IDN
+// service byte-for-byte unchanged, so the caller may skip both.
+static bool IsNormalizedAsciiHost(const char* host, int32_t length) {
+  for (int32_t i = 0; i < length; ++i) {
+    char c = host[i];
+    if (!(IsAsciiLowercaseAlpha(c) || IsAsciiDigit(c) || c == '.' ||
+          c == '-')) {
+      return false;
+    }
+    // "xn--" at the start of a label marks an ACE label, which the IDN
+    // service may rewrite to its Unicode display form.
+    if (c == '-' && i >= 3 && host[i - 1] == '-' && host[i - 2] == 'n' &&
+        host[i - 3] == 'x' && (i == 3 || host[i - 4] == '.')) {
+      return false;
+    }
+  }
+  return true;
+}
+
 // basic algorithm:
 //  1- escape url segments (for improved GetSpec efficiency)
 //  2- allocate spec buffer
@@ -738,7 +759,28 @@ nsresult nsStandardURL::BuildNormalizedSpec(const char* spec,
   // already point to a [ ] delimited IPv6 address literal.
   // However, perform Unicode normalization on it, as IDN does.
   // Note that we don't disallow URLs without a host - file:, etc
-  if (mHost.mLen > 0) {
+  if (mHost.mLen > 0 &&
+      IsNormalizedAsciiHost(spec + mHost.mPos, mHost.mLen)) {
+    // The overwhelming majority of hosts we parse are already in their
+    // normalized form, and would come back from the unescape and IDN steps
+    // below byte-for-byte unchanged.  Leave the host in |spec| and skip
+    // both; only an IPv4 address in a non-canonical form (e.g. "0x7f.1")
+    // can still require rewriting.  IsNormalizedAsciiHost only accepts
+    // characters that are valid in a hostname, so the ValidIPv6orHostname
+    // check is not needed either.
+    mCheckedIfHostA = true;
+    mDisplayHost.Truncate();
+    if (!SegmentIs(spec, mScheme, "resource") &&
+        !SegmentIs(spec, mScheme, "chrome")) {
+      nsAutoCString ipString;
+      if (NS_SUCCEEDED(NormalizeIPv4(Substring(spec + mHost.mPos, mHost.mLen),
+                                     ipString))) {
+        encHost = ipString;
+        useEncHost = true;
+      }
+    }
+    approxLen += useEncHost ? encHost.Length() : mHost.mLen;
+  } else if (mHost.mLen > 0) {
     nsAutoCString tempHost;
     NS_UnescapeURL(spec + mHost.mPos, mHost.mLen, esc_AlwaysCopy | esc_Host,
                    tempHost);
@@ -17,6 +17,7 @@
 #include "nsICacheStorage.h"
 #include "nsISerializable.h"
 #include "nsIStreamTransportService.h"
+#include "nsITransportSecurityInfo.h"
 #include "nsISizeOf.h"
 
 #include "nsComponentManagerUtils.h"
@@ -1367,7 +1368,15 @@ nsresult CacheEntry::SetSecurityInfo(nsISupports* aSecurityInfo) {
   if (aSecurityInfo && !serializable) return NS_ERROR_UNEXPECTED;
 
   nsCString info;
-  if (serializable) {
+  nsCOMPtr<nsITransportSecurityInfo> transportSecInfo =
+      do_QueryInterface(aSecurityInfo);
+  if (transportSecInfo) {
+    // All entries loaded over the same connection store the same security
+    // info object; ToString hands out a shared pre-serialized form rather
+    // than re-encoding the cert chain for every entry.
+    rv = transportSecInfo->ToString(info);
+    NS_ENSURE_SUCCESS(rv, rv);
+  } else if (serializable) {
     rv = NS_SerializeToString(serializable, info);
     NS_ENSURE_SUCCESS(rv, rv);
   }
@@ -359,7 +359,7 @@ nsresult CacheFileChunk::Read(CacheFileHandle* aHandle, uint32_t aLen,
   tmpBuf->SetDataSize(aLen);
 
   rv = CacheFileIOManager::Read(aHandle, mIndex * kChunkSize, tmpBuf->Buf(),
-                                aLen, this);
+                                aLen, false, this);
   if (NS_WARN_IF(NS_FAILED(rv))) {
     rv = mIndex ? NS_ERROR_FILE_CORRUPTED : NS_ERROR_FILE_NOT_FOUND;
     SetError(rv);
@@ -605,6 +605,17 @@ nsresult CacheFileChunk::OnDataRead(CacheFileHandle* aHandle, char* aBuf,
 
   nsCOMPtr<CacheFileChunkListener> listener;
 
+  // Hash the data before entering the lock. mReadingStateBuf is stable
+  // between Read() and this callback and nothing else may touch it while the
+  // chunk is in READING state, so it can be accessed without the lock.
+  // Hashing a whole chunk under the lock would block readers of the other
+  // chunks of the entry for the duration.
+  CacheHash::Hash16_t hash = 0;
+  if (NS_SUCCEEDED(aResult)) {
+    hash = CacheHash::Hash16(mReadingStateBuf->Buf(),
+                             mReadingStateBuf->DataSize());
+  }
+
   {
     CacheFileAutoLock lock(mFile);
 
@@ -618,8 +629,6 @@ nsresult CacheFileChunk::OnDataRead(CacheFileHandle* aHandle, char* aBuf,
     tmpBuf.swap(mReadingStateBuf);
 
     if (NS_SUCCEEDED(aResult)) {
-      CacheHash::Hash16_t hash =
-          CacheHash::Hash16(tmpBuf->Buf(), tmpBuf->DataSize());
       if (hash != mExpectedHash) {
         LOG(
             ("CacheFileChunk::OnDataRead() - Hash mismatch! Hash of the data is"
@@ -1624,9 +1624,18 @@ nsresult CacheFileIOManager::OpenFileInternal(const SHA1Sum::Hash* aHash,
     return NS_OK;
   }
 
-  bool exists, evictedAsPinned = false, evictedAsNonPinned = false;
-  rv = file->Exists(&exists);
-  NS_ENSURE_SUCCESS(rv, rv);
+  bool exists = false, evictedAsPinned = false, evictedAsNonPinned = false;
+  // A single GetFileSize() call tells us both whether the file exists and,
+  // when it does, how big it is; asking Exists() separately would stat the
+  // file a second time.
+  int64_t fileSize = -1;
+  rv = file->GetFileSize(&fileSize);
+  if (NS_SUCCEEDED(rv)) {
+    exists = true;
+  } else if (rv != NS_ERROR_FILE_NOT_FOUND &&
+             rv != NS_ERROR_FILE_TARGET_DOES_NOT_EXIST) {
+    NS_ENSURE_SUCCESS(rv, rv);
+  }
 
   if (exists && mContextEvictor) {
     if (mContextEvictor->ContextsCount() == 0) {
@@ -1666,9 +1675,7 @@ nsresult CacheFileIOManager::OpenFileInternal(const SHA1Sum::Hash* aHash,
       MOZ_ASSERT(!handle->IsDoomed() && NS_SUCCEEDED(rv));
     }
 
-    rv = file->GetFileSize(&handle->mFileSize);
-    NS_ENSURE_SUCCESS(rv, rv);
-
+    handle->mFileSize = fileSize;
     handle->mFileExists = true;
 
     CacheIndex::EnsureEntryExists(aHash);
@@ -1751,9 +1758,16 @@ nsresult CacheFileIOManager::OpenSpecialFileInternal(
     return NS_OK;
   }
 
-  bool exists;
-  rv = file->Exists(&exists);
-  NS_ENSURE_SUCCESS(rv, rv);
+  bool exists = false;
+  // As in OpenFileInternal(), get existence and size with one stat call.
+  int64_t fileSize = -1;
+  rv = file->GetFileSize(&fileSize);
+  if (NS_SUCCEEDED(rv)) {
+    exists = true;
+  } else if (rv != NS_ERROR_FILE_NOT_FOUND &&
+             rv != NS_ERROR_FILE_TARGET_DOES_NOT_EXIST) {
+    NS_ENSURE_SUCCESS(rv, rv);
+  }
 
   if (!exists && (aFlags & (OPEN | CREATE | CREATE_NEW)) == OPEN) {
     return NS_ERROR_NOT_AVAILABLE;
@@ -1764,9 +1778,7 @@ nsresult CacheFileIOManager::OpenSpecialFileInternal(
   mSpecialHandles.AppendElement(handle);
 
   if (exists) {
-    rv = file->GetFileSize(&handle->mFileSize);
-    NS_ENSURE_SUCCESS(rv, rv);
-
+    handle->mFileSize = fileSize;
     handle->mFileExists = true;
   } else {
     handle->mFileSize = 0;
@@ -1829,11 +1841,11 @@ nsresult CacheFileIOManager::CloseHandleInternal(CacheFileHandle* aHandle) {
 
 // static
 nsresult CacheFileIOManager::Read(CacheFileHandle* aHandle, int64_t aOffset,
-                                  char* aBuf, int32_t aCount,
+                                  char* aBuf, int32_t aCount, bool aMetadata,
                                   CacheFileIOListener* aCallback) {
   LOG(("CacheFileIOManager::Read() [handle=%p, offset=%" PRId64 ", count=%d, "
-       "listener=%p]",
-       aHandle, aOffset, aCount, aCallback));
+       "metadata=%d, listener=%p]",
+       aHandle, aOffset, aCount, aMetadata, aCallback));
 
   if (CacheObserver::ShuttingDown()) {
     LOG(("  no reads after shutdown"));
@@ -1849,9 +1861,11 @@ nsresult CacheFileIOManager::Read(CacheFileHandle* aHandle, int64_t aOffset,
 
   RefPtr<ReadEvent> ev =
       new ReadEvent(aHandle, aOffset, aBuf, aCount, aCallback);
-  rv = ioMan->mIOThread->Dispatch(ev, aHandle->IsPriority()
-                                          ? CacheIOThread::READ_PRIORITY
-                                          : CacheIOThread::READ);
+  // Metadata and index reads go to the priority lane regardless of the
+  // handle's priority, see the comment in CacheFileIOManager.h.
+  rv = ioMan->mIOThread->Dispatch(
+      ev, aMetadata || aHandle->IsPriority() ? CacheIOThread::READ_PRIORITY
+                                             : CacheIOThread::READ);
   NS_ENSURE_SUCCESS(rv, rv);
 
   return NS_OK;
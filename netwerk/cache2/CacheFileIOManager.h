@@ -280,8 +280,13 @@ class CacheFileIOManager final : public nsITimerCallback, public nsINamed {
 
   static nsresult OpenFile(const nsACString& aKey, uint32_t aFlags,
                            CacheFileIOListener* aCallback);
+  // When aMetadata is true the read is dispatched to the priority read lane
+  // on the IO thread.  Metadata and index reads are small and gate entry
+  // availability, so they must not wait behind bulk data reads of large
+  // (e.g. media) entries.
   static nsresult Read(CacheFileHandle* aHandle, int64_t aOffset, char* aBuf,
-                       int32_t aCount, CacheFileIOListener* aCallback);
+                       int32_t aCount, bool aMetadata,
+                       CacheFileIOListener* aCallback);
   static nsresult Write(CacheFileHandle* aHandle, int64_t aOffset,
                         const char* aBuf, int32_t aCount, bool aValidate,
                         bool aTruncate, CacheFileIOListener* aCallback);
@@ -214,7 +214,7 @@ nsresult CacheFileMetadata::ReadMetadata(CacheFileMetadataListener* aListener) {
 
   mReadStart = mozilla::TimeStamp::Now();
   mListener = aListener;
-  rv = CacheFileIOManager::Read(mHandle, offset, mBuf, mBufSize, this);
+  rv = CacheFileIOManager::Read(mHandle, offset, mBuf, mBufSize, true, this);
   if (NS_FAILED(rv)) {
     LOG(
         ("CacheFileMetadata::ReadMetadata() - CacheFileIOManager::Read() failed"
@@ -757,7 +757,8 @@ nsresult CacheFileMetadata::OnDataRead(CacheFileHandle* aHandle, char* aBuf,
 
     mFirstRead = false;
     mReadStart = mozilla::TimeStamp::Now();
-    rv = CacheFileIOManager::Read(mHandle, realOffset, mBuf, missing, this);
+    rv = CacheFileIOManager::Read(mHandle, realOffset, mBuf, missing, true,
+                                  this);
     if (NS_FAILED(rv)) {
       LOG(
           ("CacheFileMetadata::OnDataRead() - CacheFileIOManager::Read() "
@@ -26,6 +26,13 @@
 #define kMinUnwrittenChanges 300
 #define kMinDumpInterval 20000  // in milliseconds
 #define kMaxBufSize 16384
+
+// The buffer size used when reading the index from disk.  Every buffer-full
+// costs an asynchronous read round trip through the IO thread, so a larger
+// buffer than kMaxBufSize is used to keep the number of trips low even for
+// the index of a large cache.  The buffer is released as soon as reading
+// finishes.
+#define kMaxReadBufSize (1024 * 1024)
 #define kIndexVersion 0x00000008
 #define kUpdateIndexStartDelay 50000  // in milliseconds
 #define kTelemetryReportBytesLimit (2U * 1024U * 1024U * 1024U)  // 2GB
@@ -2157,10 +2164,18 @@ void CacheIndex::StartReadingIndex() {
   mSkipEntries = 0;
   mRWHash = new CacheHash();
 
+  // The number of entries is known from the file size, so pre-size the
+  // hashtable instead of letting ParseRecords() grow it repeatedly while
+  // inserting the entries one by one.
+  MOZ_ASSERT(mIndex.Count() == 0);
+  mIndex = nsTHashtable<CacheIndexEntry>(
+      static_cast<uint32_t>(entriesSize / sizeof(CacheIndexRecord)));
+
   mRWBufPos =
       std::min(mRWBufSize, static_cast<uint32_t>(mIndexHandle->FileSize()));
 
-  rv = CacheFileIOManager::Read(mIndexHandle, 0, mRWBuf, mRWBufPos, this);
+  rv = CacheFileIOManager::Read(mIndexHandle, 0, mRWBuf, mRWBufPos, true,
+                                this);
   if (NS_FAILED(rv)) {
     LOG(
         ("CacheIndex::StartReadingIndex() - CacheFileIOManager::Read() failed "
@@ -2290,7 +2305,7 @@ void CacheIndex::ParseRecords() {
   mRWBufPos = pos + toRead;
 
   rv = CacheFileIOManager::Read(mIndexHandle, fileOffset, mRWBuf + pos, toRead,
-                                this);
+                                true, this);
   if (NS_FAILED(rv)) {
     LOG(
         ("CacheIndex::ParseRecords() - CacheFileIOManager::Read() failed "
@@ -2330,7 +2345,8 @@ void CacheIndex::StartReadingJournal() {
   mRWBufPos =
       std::min(mRWBufSize, static_cast<uint32_t>(mJournalHandle->FileSize()));
 
-  rv = CacheFileIOManager::Read(mJournalHandle, 0, mRWBuf, mRWBufPos, this);
+  rv = CacheFileIOManager::Read(mJournalHandle, 0, mRWBuf, mRWBufPos, true,
+                                this);
   if (NS_FAILED(rv)) {
     LOG(
         ("CacheIndex::StartReadingJournal() - CacheFileIOManager::Read() failed"
@@ -2411,7 +2427,7 @@ void CacheIndex::ParseJournal() {
   mRWBufPos = pos + toRead;
 
   rv = CacheFileIOManager::Read(mJournalHandle, fileOffset, mRWBuf + pos,
-                                toRead, this);
+                                toRead, true, this);
   if (NS_FAILED(rv)) {
     LOG(
         ("CacheIndex::ParseJournal() - CacheFileIOManager::Read() failed "
@@ -3345,7 +3361,10 @@ void CacheIndex::AllocBuffer() {
       }
       break;
     case READING:
-      mRWBufSize = kMaxBufSize;
+      MOZ_ASSERT(mIndexHandle);
+      mRWBufSize = std::max<int64_t>(
+          kMaxBufSize,
+          std::min<int64_t>(mIndexHandle->FileSize(), kMaxReadBufSize));
       break;
     default:
       MOZ_ASSERT(false, "Unexpected state!");
@@ -846,6 +846,16 @@ nsresult nsHostResolver::ResolveHost(const nsACString& aHost, uint16_t type,
   // callback before returning.
   RefPtr<nsHostRecord> result;
   nsresult status = NS_OK, rv = NS_OK;
+
+  // Build the lookup key before taking the lock; serializing the origin
+  // attributes and copying the strings is per-lookup work that doesn't need
+  // mLock and cache hits are frequent enough for the critical section to
+  // matter.
+  nsAutoCString originSuffix;
+  aOriginAttributes.CreateSuffix(originSuffix);
+
+  nsHostKey key(host, type, flags, af,
+                (aOriginAttributes.mPrivateBrowsingId > 0), originSuffix);
   {
     MutexAutoLock lock(mLock);
 
@@ -858,11 +868,6 @@ nsresult nsHostResolver::ResolveHost(const nsACString& aHost, uint16_t type,
       // any pending callbacks, then add to pending callbacks queue,
       // and return.  otherwise, add ourselves as first pending
       // callback, and proceed to do the lookup.
-      nsAutoCString originSuffix;
-      aOriginAttributes.CreateSuffix(originSuffix);
-
-      nsHostKey key(host, type, flags, af,
-                    (aOriginAttributes.mPrivateBrowsingId > 0), originSuffix);
       RefPtr<nsHostRecord>& entry = mRecordDB.GetOrInsert(key);
       if (!entry) {
         if (IS_ADDR_TYPE(type)) {
@@ -842,6 +842,10 @@ void HttpChannelChild::OnTransportAndData(const nsresult& channelStatus,
   if (NS_IsMainThread()) {
     DoOnStatus(this, transportStatus);
     DoOnProgress(this, progress, progressMax);
+  } else if (mLoadFlags & LOAD_BACKGROUND) {
+    // DoOnStatus/DoOnProgress would drop the notifications for a background
+    // channel anyway, so don't bounce a runnable to the main thread for every
+    // data chunk of a retargeted channel just to find that out there.
   } else {
     RefPtr<HttpChannelChild> self = this;
     nsCOMPtr<nsIEventTarget> neckoTarget = GetNeckoTarget();
@@ -29,6 +29,7 @@
 #include "mozilla/net/BackgroundChannelRegistrar.h"
 #include "nsSerializationHelper.h"
 #include "nsISerializable.h"
+#include "nsITransportSecurityInfo.h"
 #include "nsIApplicationCacheService.h"
 #include "mozilla/ipc/InputStreamUtils.h"
 #include "mozilla/ipc/URIUtils.h"
@@ -2418,6 +2419,14 @@ void HttpChannelParent::UpdateAndSerializeSecurityInfo(
   nsCOMPtr<nsISupports> secInfoSupp;
   mChannel->GetSecurityInfo(getter_AddRefs(secInfoSupp));
   if (secInfoSupp) {
+    // Prefer the memoized serialization so that the many channels sharing a
+    // connection's security info don't each re-encode the cert chain.
+    nsCOMPtr<nsITransportSecurityInfo> transportSecInfo =
+        do_QueryInterface(secInfoSupp);
+    if (transportSecInfo &&
+        NS_SUCCEEDED(transportSecInfo->ToString(aSerializedSecurityInfoOut))) {
+      return;
+    }
     nsCOMPtr<nsISerializable> secInfoSer = do_QueryInterface(secInfoSupp);
     if (secInfoSer) {
       NS_SerializeToString(secInfoSer, aSerializedSecurityInfoOut);
@@ -0,0 +1,77 @@
+# This Source Code Form is subject to the terms of the Mozilla Public
+# License, v. 2.0. If a copy of the MPL was not distributed with this
+# file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+# Generates nsHttpAtomTable.h, a perfect hash table over the static HTTP
+# atoms in nsHttpAtomList.h.  nsHttp::ResolveAtom() consults this table
+# before falling back to the runtime hash table for unknown headers, so the
+# common headers resolve without taking a lock and without any startup
+# table construction.
+
+import re
+
+from perfecthash import PerfectHash
+
+# Pick a nice power-of-two size for our intermediate PHF table, comfortably
+# larger than the number of atoms in nsHttpAtomList.h.
+PHFSIZE = 256
+
+ATOM_RE = re.compile(r'^HTTP_ATOM\((?P<name>[^,]+),\s*"(?P<value>[^"]*)"\)')
+
+
+def load_atoms(atom_list):
+    atoms = []
+    with open(atom_list) as fd:
+        for line in fd:
+            m = ATOM_RE.match(line.strip())
+            if m:
+                atoms.append((m.group('name').strip(), m.group('value')))
+    return atoms
+
+
+def main(output, atom_list):
+    atoms = load_atoms(atom_list)
+
+    # Atoms resolve case-insensitively, so the table is keyed by the
+    # lower-cased header name and ResolveAtom() lower-cases its input before
+    # calling LookupStaticHttpAtom().
+    phf = PerfectHash(atoms, PHFSIZE,
+                      key=lambda atom: atom[1].lower().encode('ascii'))
+
+    output.write("""\
+/* THIS FILE IS GENERATED BY gen_http_atom_table.py - DO NOT EDIT */
+
+#include "mozilla/PerfectHash.h"
+#include "nsHttp.h"
+#include "plstr.h"
+
+namespace mozilla {
+namespace net {
+
+// Any key longer than this cannot match a static atom, so ResolveAtom()
+// doesn't need to consult the table at all for it.
+static const size_t kStaticAtomMaxLength = %d;
+
+static nsHttpAtom* const sStaticAtoms[] = {
+""" % max(len(value) for _, value in atoms))
+
+    for name, _ in phf.entries:
+        output.write("  &nsHttp::%s,\n" % name)
+    output.write("};\n\n")
+
+    output.write(phf.cxx_codegen(
+        name='LookupStaticHttpAtom',
+        entry_type='uint16_t',
+        lower_entry=lambda atom: '%-4d /* %s */' % (phf.entries.index(atom),
+                                                    atom[1]),
+
+        # aKey is lower-cased, but the atom values are not; compare
+        # case-insensitively to double-check keys not in the table.
+        return_type='nsHttpAtom*',
+        return_entry='return !PL_strcasecmp(sStaticAtoms[entry]->get(), aKey)'
+                     ' ? sStaticAtoms[entry] : nullptr;'))
+
+    output.write("""
+}  // namespace net
+}  // namespace mozilla
+""")
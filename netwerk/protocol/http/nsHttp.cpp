@@ -8,6 +8,7 @@
 #include "HttpLog.h"
 
 #include "nsHttp.h"
+#include "nsHttpAtomTable.h"  // generated by gen_http_atom_table.py
 #include "CacheControlParser.h"
 #include "PLDHashTable.h"
 #include "mozilla/Mutex.h"
@@ -94,27 +95,10 @@ nsresult CreateAtomTable() {
     sLock = new Mutex("nsHttp.sLock");
   }
 
-  // The initial length for this table is a value greater than the number of
-  // known atoms (NUM_HTTP_ATOMS) because we expect to encounter a few random
-  // headers right off the bat.
-  sAtomTable =
-      new PLDHashTable(&ops, sizeof(PLDHashEntryStub), NUM_HTTP_ATOMS + 10);
-
-  // fill the table with our known atoms
-  const char* const atoms[] = {
-#define HTTP_ATOM(_name, _value) _name._val,
-#include "nsHttpAtomList.h"
-#undef HTTP_ATOM
-      nullptr};
-
-  for (int i = 0; atoms[i]; ++i) {
-    auto stub =
-        static_cast<PLDHashEntryStub*>(sAtomTable->Add(atoms[i], fallible));
-    if (!stub) return NS_ERROR_OUT_OF_MEMORY;
-
-    MOZ_ASSERT(!stub->key, "duplicate static atom");
-    stub->key = atoms[i];
-  }
+  // The known atoms are resolved from the static perfect hash table, so this
+  // table only ever holds the random headers we encounter at runtime, and a
+  // small initial length suffices.
+  sAtomTable = new PLDHashTable(&ops, sizeof(PLDHashEntryStub), 16);
 
   return NS_OK;
 }
@@ -139,7 +123,29 @@ Mutex* GetLock() { return sLock; }
 nsHttpAtom ResolveAtom(const char* str) {
   nsHttpAtom atom = {nullptr};
 
-  if (!str || !sAtomTable) return atom;
+  if (!str) return atom;
+
+  // Known headers should resolve from the static table, which is read-only
+  // and requires neither the lock nor the heap.  The table is keyed by the
+  // lower-cased header name, so lower-case the input first.
+  char lower[kStaticAtomMaxLength + 1];
+  size_t len = 0;
+  for (; str[len]; ++len) {
+    if (len == kStaticAtomMaxLength) {
+      len = 0;  // too long to be a static atom
+      break;
+    }
+    lower[len] = nsCRT::ToLower(str[len]);
+  }
+  if (len) {
+    lower[len] = '\0';
+    nsHttpAtom* staticAtom = LookupStaticHttpAtom(lower);
+    if (staticAtom) {
+      return *staticAtom;
+    }
+  }
+
+  if (!sAtomTable) return atom;
 
   MutexAutoLock lock(*sLock);
 
@@ -545,6 +551,15 @@ void localEnsureBuffer(UniquePtr<T[]>& buf, uint32_t newSize, uint32_t preserve,
                        uint32_t& objSize) {
   if (objSize >= newSize) return;
 
+  // Grow at least geometrically so that filling a large buffer with many
+  // small appends (e.g. packing lots of little h2 frames into the session
+  // output queue) copies each byte a constant number of times instead of
+  // re-copying the whole buffer on every 4KB step.
+  uint32_t geometric = objSize + (objSize >> 1);
+  if (geometric > objSize && newSize < geometric) {
+    newSize = geometric;
+  }
+
   // Leave a little slop on the new allocation - add 2KB to
   // what we need and then round the result up to a 4KB (page)
   // boundary.
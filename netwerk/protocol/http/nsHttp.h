@@ -136,6 +136,15 @@ enum class SpdyVersion {
 
 #define NS_HTTP_HEADER_SEPS ", \t"
 
+// The segment geometry of the response pipe between an HTTP transaction and
+// its channel.  The socket thread reads from the connection directly into a
+// pipe segment, so the segment size also bounds the largest single socket
+// read; nsIOService::gDefaultSegmentSize (4 KiB) costs a read per page of
+// response data.  The count is chosen to keep the pipe's total buffering at
+// the same 96 KiB the old 4 KiB x 24 geometry provided.
+#define NS_HTTP_SEGMENT_SIZE 32768
+#define NS_HTTP_SEGMENT_COUNT 3
+
 //-----------------------------------------------------------------------------
 // http atoms...
 //-----------------------------------------------------------------------------
@@ -48,32 +48,48 @@ nsresult nsHttpChunkedDecoder::HandleChunkedContent(
   // chunk.  the chunked encoding is ended by any chunk whose size is zero,
   // followed by the trailer, which is terminated by an empty line.
 
+  // The buffer is rewritten in place: |in| walks the encoded data while
+  // |out| marks the end of the decoded content.  Chunk data is shifted down
+  // over the framing that preceded it, so each content byte is moved at most
+  // once no matter how many chunks the segment contains.  (The previous
+  // version shifted the whole unparsed tail down after every chunk header,
+  // which is quadratic for segments full of small chunks.)
+  char* out = buf;
+  char* in = buf;
+
   while (count) {
     if (mChunkRemaining) {
       uint32_t amt = std::min(mChunkRemaining, count);
 
+      if (out != in) {
+        memmove(out, in, amt);
+      }
+      out += amt;
+      in += amt;
+
       count -= amt;
       mChunkRemaining -= amt;
 
       *contentRead += amt;
-      buf += amt;
     } else if (mReachedEOF)
       break;  // done
     else {
       uint32_t bytesConsumed = 0;
 
-      nsresult rv = ParseChunkRemaining(buf, count, &bytesConsumed);
+      nsresult rv = ParseChunkRemaining(in, count, &bytesConsumed);
       if (NS_FAILED(rv)) return rv;
 
+      in += bytesConsumed;
       count -= bytesConsumed;
-
-      if (count) {
-        // shift buf by bytesConsumed
-        memmove(buf, buf + bytesConsumed, count);
-      }
     }
   }
 
+  // Bytes past the end of the chunked body (pipelined data following the
+  // trailer) are handed back to the caller right after the content.
+  if (count && out != in) {
+    memmove(out, in, count);
+  }
+
   *contentRemaining = count;
   return NS_OK;
 }
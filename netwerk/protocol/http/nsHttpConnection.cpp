@@ -2098,8 +2098,11 @@ nsresult nsHttpConnection::OnSocketReadable() {
     }
 
     mSocketInCondition = NS_OK;
-    rv = mTransaction->WriteSegmentsAgain(
-        this, nsIOService::gDefaultSegmentSize, &n, &again);
+    // Offer a full response pipe segment per pass so OnWriteSegment can pull
+    // the data out of the socket in reads of that size rather than
+    // gDefaultSegmentSize quanta.
+    rv = mTransaction->WriteSegmentsAgain(this, NS_HTTP_SEGMENT_SIZE, &n,
+                                          &again);
     LOG(("nsHttpConnection::OnSocketReadable %p trans->ws rv=%" PRIx32
          " n=%d socketin=%" PRIx32 "\n",
          this, static_cast<uint32_t>(rv), n,
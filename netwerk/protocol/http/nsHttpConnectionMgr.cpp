@@ -4051,7 +4051,17 @@ nsresult nsHttpConnectionMgr::nsHalfOpenSocket::SetupStreams(
   } else if (mCaps & NS_HTTP_DISABLE_IPV6) {
     tmpFlags |= nsISocketTransport::DISABLE_IPV6;
   } else if (mEnt->PreferenceKnown()) {
-    if (mEnt->mPreferIPv6) {
+    if (isBackup) {
+      // The primary socket is already trying the preferred family.  Let the
+      // backup start on the opposite one so that the syn-retry race spans
+      // both address families ("happy eyeballs") instead of re-running the
+      // same route that is possibly losing SYNs.
+      if (mEnt->mPreferIPv6) {
+        tmpFlags |= nsISocketTransport::DISABLE_IPV6;
+      } else if (mEnt->mPreferIPv4) {
+        tmpFlags |= nsISocketTransport::DISABLE_IPV4;
+      }
+    } else if (mEnt->mPreferIPv6) {
       tmpFlags |= nsISocketTransport::DISABLE_IPV4;
     } else if (mEnt->mPreferIPv4) {
       tmpFlags |= nsISocketTransport::DISABLE_IPV6;
@@ -15,6 +15,56 @@
 namespace mozilla {
 namespace net {
 
+// Assigns aValue to aDest, sharing static storage when the value is one of
+// the most common ones seen on the network.  Every header of every live
+// channel otherwise keeps its own heap copy of these few strings, which with
+// hundreds of channels per process adds up to a lot of small fragmented
+// allocations.  An entry assigned a literal stays cheap to copy as well:
+// nsCString propagates the literal flag instead of cloning the buffer.
+static void AssignHeaderValue(nsCString& aDest, const nsACString& aValue) {
+#define TRY_COMMON_VALUE(val)     \
+  if (aValue.EqualsLiteral(val)) {\
+    aDest.AssignLiteral(val);     \
+    return;                       \
+  }
+
+  TRY_COMMON_VALUE("gzip")
+  TRY_COMMON_VALUE("br")
+  TRY_COMMON_VALUE("deflate")
+  TRY_COMMON_VALUE("identity")
+  TRY_COMMON_VALUE("keep-alive")
+  TRY_COMMON_VALUE("Keep-Alive")
+  TRY_COMMON_VALUE("close")
+  TRY_COMMON_VALUE("chunked")
+  TRY_COMMON_VALUE("bytes")
+  TRY_COMMON_VALUE("none")
+  TRY_COMMON_VALUE("no-cache")
+  TRY_COMMON_VALUE("no-store")
+  TRY_COMMON_VALUE("max-age=0")
+  TRY_COMMON_VALUE("private")
+  TRY_COMMON_VALUE("public")
+  TRY_COMMON_VALUE("nosniff")
+  TRY_COMMON_VALUE("DENY")
+  TRY_COMMON_VALUE("SAMEORIGIN")
+  TRY_COMMON_VALUE("Accept-Encoding")
+  TRY_COMMON_VALUE("accept-encoding")
+  TRY_COMMON_VALUE("*")
+  TRY_COMMON_VALUE("0")
+  TRY_COMMON_VALUE("text/html")
+  TRY_COMMON_VALUE("text/html; charset=UTF-8")
+  TRY_COMMON_VALUE("text/html; charset=utf-8")
+  TRY_COMMON_VALUE("text/css")
+  TRY_COMMON_VALUE("application/javascript")
+  TRY_COMMON_VALUE("application/json")
+  TRY_COMMON_VALUE("image/png")
+  TRY_COMMON_VALUE("image/jpeg")
+  TRY_COMMON_VALUE("image/gif")
+
+#undef TRY_COMMON_VALUE
+
+  aDest = aValue;
+}
+
 //-----------------------------------------------------------------------------
 // nsHttpHeaderArray <public>
 //-----------------------------------------------------------------------------
@@ -96,7 +146,7 @@ nsresult nsHttpHeaderArray::SetHeader_internal(
   if (!headerName.Equals(header.get())) {
     entry->headerNameOriginal = headerName;
   }
-  entry->value = value;
+  AssignHeaderValue(entry->value, value);
   entry->variety = variety;
   return NS_OK;
 }
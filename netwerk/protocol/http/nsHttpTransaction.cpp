@@ -446,10 +446,10 @@ nsresult nsHttpTransaction::Init(
                      ? static_cast<int64_t>(requestContentLength)
                      : -1;
 
-  // create pipe for response stream
+  // create pipe for response stream - see the comment on NS_HTTP_SEGMENT_SIZE
+  // for why this doesn't use the default nsIOService geometry.
   rv = NS_NewPipe2(getter_AddRefs(mPipeIn), getter_AddRefs(mPipeOut), true,
-                   true, nsIOService::gDefaultSegmentSize,
-                   nsIOService::gDefaultSegmentCount);
+                   true, NS_HTTP_SEGMENT_SIZE, NS_HTTP_SEGMENT_COUNT);
   if (NS_FAILED(rv)) return rv;
 
   nsCOMPtr<nsIAsyncInputStream> tmp(mPipeIn);
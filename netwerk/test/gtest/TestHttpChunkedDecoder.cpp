@@ -0,0 +1,148 @@
+#include "gtest/gtest.h"
+#include "gtest/MozGTestBench.h"  // For MOZ_GTEST_BENCH
+
+#include <algorithm>
+
+#include "nsHttpChunkedDecoder.h"
+#include "nsString.h"
+
+using namespace mozilla;
+using namespace mozilla::net;
+
+// Feeds |input| to the decoder in pieces of at most |feedSize| bytes and
+// collects the decoded content, the final remainder and the decoder result.
+static nsresult Decode(nsHttpChunkedDecoder& aDecoder, const nsACString& aInput,
+                       uint32_t aFeedSize, nsCString& aContent,
+                       nsCString& aRemainder) {
+  aContent.Truncate();
+  aRemainder.Truncate();
+
+  uint32_t pos = 0;
+  while (pos < aInput.Length()) {
+    uint32_t feed = std::min<uint32_t>(aFeedSize, aInput.Length() - pos);
+
+    nsAutoCString buf(Substring(aInput, pos, feed));
+    pos += feed;
+
+    uint32_t contentRead = 0;
+    uint32_t contentRemaining = 0;
+    nsresult rv = aDecoder.HandleChunkedContent(
+        buf.BeginWriting(), feed, &contentRead, &contentRemaining);
+    if (NS_FAILED(rv)) {
+      return rv;
+    }
+
+    aContent.Append(buf.get(), contentRead);
+    aRemainder.Assign(buf.get() + contentRead, contentRemaining);
+  }
+
+  return NS_OK;
+}
+
+TEST(TestHttpChunkedDecoder, SmallChunks)
+{
+  nsHttpChunkedDecoder decoder;
+  nsAutoCString input;
+  for (int i = 0; i < 100; ++i) {
+    input.AppendLiteral("5\r\nhello\r\n");
+  }
+  input.AppendLiteral("0\r\n\r\n");
+
+  nsAutoCString content;
+  nsAutoCString remainder;
+  ASSERT_EQ(Decode(decoder, input, input.Length(), content, remainder), NS_OK);
+
+  ASSERT_EQ(content.Length(), 500u);
+  ASSERT_TRUE(StringBeginsWith(content, NS_LITERAL_CSTRING("hellohello")));
+  ASSERT_TRUE(remainder.IsEmpty());
+  ASSERT_TRUE(decoder.ReachedEOF());
+}
+
+TEST(TestHttpChunkedDecoder, SplitFraming)
+{
+  // Feed the body a few bytes at a time so chunk-size lines and CRLFs are
+  // split across HandleChunkedContent calls.
+  const char input[] = "4\r\nwiki\r\n6\r\npedia \r\nB\r\nin chunks.\n\r\n0\r\n\r\n";
+
+  for (uint32_t feedSize = 1; feedSize <= 7; ++feedSize) {
+    nsHttpChunkedDecoder decoder;
+    nsAutoCString content;
+    nsAutoCString remainder;
+    ASSERT_EQ(Decode(decoder, nsDependentCString(input), feedSize, content,
+                     remainder),
+              NS_OK);
+
+    ASSERT_TRUE(content.EqualsLiteral("wikipedia in chunks.\n"));
+    ASSERT_TRUE(remainder.IsEmpty());
+    ASSERT_TRUE(decoder.ReachedEOF());
+  }
+}
+
+TEST(TestHttpChunkedDecoder, ExtensionAndTrailer)
+{
+  // Note: trailer headers are only retained when the http atom table exists,
+  // which it doesn't in this harness; this only exercises the framing.
+  nsHttpChunkedDecoder decoder;
+  const char input[] =
+      "3;ext=val\r\nfoo\r\n"
+      "0\r\n"
+      "Server-Timing: cache;dur=1\r\n"
+      "\r\n";
+
+  nsAutoCString content;
+  nsAutoCString remainder;
+  ASSERT_EQ(Decode(decoder, nsDependentCString(input), sizeof(input) - 1,
+                   content, remainder),
+            NS_OK);
+
+  ASSERT_TRUE(content.EqualsLiteral("foo"));
+  ASSERT_TRUE(decoder.ReachedEOF());
+  ASSERT_TRUE(remainder.IsEmpty());
+}
+
+TEST(TestHttpChunkedDecoder, PipelinedRemainder)
+{
+  nsHttpChunkedDecoder decoder;
+  const char input[] = "3\r\nfoo\r\n0\r\n\r\nHTTP/1.1 200 OK";
+
+  nsAutoCString content;
+  nsAutoCString remainder;
+  ASSERT_EQ(Decode(decoder, nsDependentCString(input), sizeof(input) - 1,
+                   content, remainder),
+            NS_OK);
+
+  ASSERT_TRUE(content.EqualsLiteral("foo"));
+  ASSERT_TRUE(decoder.ReachedEOF());
+  ASSERT_TRUE(remainder.EqualsLiteral("HTTP/1.1 200 OK"));
+}
+
+TEST(TestHttpChunkedDecoder, MalformedChunkSize)
+{
+  nsHttpChunkedDecoder decoder;
+  const char input[] = "xyz\r\nfoo\r\n";
+
+  nsAutoCString content;
+  nsAutoCString remainder;
+  ASSERT_EQ(Decode(decoder, nsDependentCString(input), sizeof(input) - 1,
+                   content, remainder),
+            NS_ERROR_UNEXPECTED);
+}
+
+// Event-stream style traffic: a large segment consisting of many small
+// chunks, the case where stripping the framing used to be quadratic.
+MOZ_GTEST_BENCH(TestHttpChunkedDecoder, DecodeManySmallChunks, [] {
+  nsAutoCString input;
+  for (int i = 0; i < 20000; ++i) {
+    input.AppendLiteral("A\r\n0123456789\r\n");
+  }
+  input.AppendLiteral("0\r\n\r\n");
+
+  for (int rep = 0; rep < 10; ++rep) {
+    nsHttpChunkedDecoder decoder;
+    nsAutoCString content;
+    nsAutoCString remainder;
+    ASSERT_EQ(Decode(decoder, input, input.Length(), content, remainder),
+              NS_OK);
+    ASSERT_EQ(content.Length(), 200000u);
+  }
+});
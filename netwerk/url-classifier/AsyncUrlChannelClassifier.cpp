@@ -72,6 +72,8 @@ class URIData {
 
   const nsTArray<nsCString>& Fragments();
 
+  const nsTArray<Completion>& FragmentHashes();
+
   nsIURI* URI() const;
 
  private:
@@ -81,6 +83,7 @@ class URIData {
   nsCOMPtr<nsIURI> mURI;
   nsCString mURISpec;
   nsTArray<nsCString> mFragments;
+  nsTArray<Completion> mFragmentHashes;
 };
 
 /* static */
@@ -139,6 +142,19 @@ const nsTArray<nsCString>& URIData::Fragments() {
   return mFragments;
 }
 
+const nsTArray<Completion>& URIData::FragmentHashes() {
+  MOZ_ASSERT(!NS_IsMainThread());
+
+  // Multiple tables point to the same URIData, so the fragments are hashed
+  // just once here, like the fragments themselves are created just once.
+  if (mFragmentHashes.IsEmpty()) {
+    nsresult rv = LookupCache::HashFragments(Fragments(), &mFragmentHashes);
+    Unused << NS_WARN_IF(NS_FAILED(rv));
+  }
+
+  return mFragmentHashes;
+}
+
 nsIURI* URIData::URI() const {
   MOZ_ASSERT(NS_IsMainThread());
   return mURI;
@@ -229,8 +245,9 @@ bool TableData::DoLookup(nsUrlClassifierDBServiceWorker* aWorkerClassifier) {
     UC_LOG(("TableData::DoLookup[%p] - starting lookup", this));
 
     const nsTArray<nsCString>& fragments = mURIData->Fragments();
+    const nsTArray<Completion>& hashes = mURIData->FragmentHashes();
     nsresult rv = aWorkerClassifier->DoSingleLocalLookupWithURIFragments(
-        fragments, mTable, mResults);
+        fragments, hashes, mTable, mResults);
     Unused << NS_WARN_IF(NS_FAILED(rv));
 
     mState = mResults.IsEmpty() ? TableData::eNoMatch : TableData::eMatch;
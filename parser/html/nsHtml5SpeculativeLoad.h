@@ -173,6 +173,24 @@ class nsHtml5SpeculativeLoad {
         mTypeOrCharsetSourceOrDocumentModeOrMetaCSPOrSizesOrIntegrity);
   }
 
+  /**
+   * Speculative load for a sheet @import-ed from the prefix of an inline
+   * <style>. A pre-scan of the style text can only extract the URL itself,
+   * so everything else is defaulted as for an attribute-less
+   * <link rel="stylesheet">.
+   */
+  inline void InitImportStyle(const nsString& aUrl) {
+    MOZ_ASSERT(mOpCode == eSpeculativeLoadUninitialized,
+               "Trying to reinitialize a speculative load!");
+    mOpCode = eSpeculativeLoadStyle;
+    mUrlOrSizes.Assign(aUrl);
+    mCharsetOrSrcset.SetIsVoid(true);
+    mCrossOriginOrMedia.SetIsVoid(true);
+    mReferrerPolicyOrIntegrity.SetIsVoid(true);
+    mTypeOrCharsetSourceOrDocumentModeOrMetaCSPOrSizesOrIntegrity.SetIsVoid(
+        true);
+  }
+
   /**
    * "Speculative" manifest loads aren't truly speculative--if a manifest
    * gets loaded, we are committed to it. There can never be a <script>
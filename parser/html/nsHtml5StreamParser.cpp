@@ -6,9 +6,12 @@
 
 #include "nsHtml5StreamParser.h"
 
+#include <algorithm>
+
 #include "mozilla/DebugOnly.h"
 #include "mozilla/Encoding.h"
 #include "nsContentUtils.h"
+#include "nsReadableUtils.h"
 #include "nsCyrillicDetector.h"
 #include "nsHtml5Tokenizer.h"
 #include "nsIHttpChannel.h"
@@ -184,6 +187,7 @@ nsHtml5StreamParser::nsHtml5StreamParser(nsHtml5TreeOpExecutor* aExecutor,
           StaticPrefs::intl_charset_detector_iso2022jp_allowed())),
       mInitialEncodingWasFromParentFrame(false),
       mHasHadErrors(false),
+      mDecoderMayHavePendingState(true),
       mDecodingLocalFileAsUTF8(false),
       mFlushTimer(NS_NewTimer(mEventTarget)),
       mFlushTimerMutex("nsHtml5StreamParser mFlushTimerMutex"),
@@ -395,6 +399,9 @@ nsHtml5StreamParser::SetupDecodingAndWriteSniffingBufferAndCurrentSegment(
     mDecodingLocalFileAsUTF8 = false;
     mUnicodeDecoder = mEncoding->NewDecoderWithBOMRemoval();
   }
+  // Until the decoder has seen past the potential BOM, it may be
+  // holding BOM state across calls.
+  mDecoderMayHavePendingState = true;
   if (mSniffingBuffer) {
     rv = WriteStreamBytes(MakeSpan(mSniffingBuffer.get(), mSniffingLength));
     NS_ENSURE_SUCCESS(rv, rv);
@@ -410,6 +417,9 @@ nsresult nsHtml5StreamParser::SetupDecodingFromBom(
   mEncoding = aEncoding;
   mDecodingLocalFileAsUTF8 = false;
   mUnicodeDecoder = mEncoding->NewDecoderWithoutBOMHandling();
+  // The BOM has already been consumed here, so the decoder starts without
+  // any state.
+  mDecoderMayHavePendingState = false;
   mCharsetSource = kCharsetFromByteOrderMark;
   mFeedChardet = false;
   mTreeBuilder->SetDocumentCharset(mEncoding, mCharsetSource);
@@ -843,8 +853,42 @@ nsresult nsHtml5StreamParser::WriteStreamBytes(
     MarkAsBroken(NS_ERROR_NULL_POINTER);
     return NS_ERROR_NULL_POINTER;
   }
-  size_t totalRead = 0;
   auto src = aFromSegment;
+  if (mEncoding == UTF_8_ENCODING && !mDecoderMayHavePendingState &&
+      !mDecodingLocalFileAsUTF8) {
+    // The decoder is known not to be holding an incomplete byte sequence
+    // or BOM state, so a leading ASCII run decodes to itself and can be
+    // widened straight into the buffers without a decoder call per buffer
+    // boundary. Both the validation and the widening are SIMD-accelerated.
+    size_t ascii = Encoding::ASCIIValidUpTo(src);
+    while (ascii) {
+      auto dst = mLastBuffer->TailAsSpan(READ_BUFFER_SIZE);
+      size_t written = std::min(ascii, dst.Length());
+      if (written) {
+        ConvertLatin1toUTF16(AsChars(src.To(written)), dst);
+        if (recordreplay::IsRecordingOrReplaying()) {
+          recordreplay::AddContentParseData16(this, dst.data(), written);
+        }
+        src = src.From(written);
+        ascii -= written;
+        mLastBuffer->AdvanceEnd(written);
+      }
+      if (ascii) {
+        RefPtr<nsHtml5OwningUTF16Buffer> newBuf =
+            nsHtml5OwningUTF16Buffer::FalliblyCreate(READ_BUFFER_SIZE);
+        if (!newBuf) {
+          MarkAsBroken(NS_ERROR_OUT_OF_MEMORY);
+          return NS_ERROR_OUT_OF_MEMORY;
+        }
+        mLastBuffer = (mLastBuffer->next = newBuf.forget());
+      }
+    }
+    if (src.IsEmpty()) {
+      // The segment ended with an ASCII byte, so the decoder still holds
+      // no state.
+      return NS_OK;
+    }
+  }
   for (;;) {
     auto dst = mLastBuffer->TailAsSpan(READ_BUFFER_SIZE);
     uint32_t result;
@@ -867,7 +911,6 @@ nsresult nsHtml5StreamParser::WriteStreamBytes(
       }
     }
     src = src.From(read);
-    totalRead += read;
     mLastBuffer->AdvanceEnd(written);
     if (result == kOutputFull) {
       RefPtr<nsHtml5OwningUTF16Buffer> newBuf =
@@ -878,8 +921,15 @@ nsresult nsHtml5StreamParser::WriteStreamBytes(
       }
       mLastBuffer = (mLastBuffer->next = newBuf.forget());
     } else {
-      MOZ_ASSERT(totalRead == aFromSegment.Length(),
+      MOZ_ASSERT(src.IsEmpty(),
                  "The Unicode decoder consumed the wrong number of bytes.");
+      if (mEncoding == UTF_8_ENCODING && !aFromSegment.IsEmpty()) {
+        // An ASCII byte can be part of neither an incomplete byte sequence
+        // nor an undecided BOM, so if the segment ended with one, the next
+        // segment may take the ASCII fast path above.
+        mDecoderMayHavePendingState =
+            aFromSegment[aFromSegment.Length() - 1] >= 0x80;
+      }
       if (mDecodingLocalFileAsUTF8 &&
           mLocalFileBytesBuffered == LOCAL_FILE_UTF_8_BUFFER_SIZE) {
         CommitLocalFileToUTF8();
@@ -893,6 +943,7 @@ void nsHtml5StreamParser::ReDecodeLocalFile() {
   MOZ_ASSERT(mDecodingLocalFileAsUTF8);
   mDecodingLocalFileAsUTF8 = false;
   mUnicodeDecoder = mEncoding->NewDecoderWithBOMRemoval();
+  mDecoderMayHavePendingState = true;
   mHasHadErrors = false;
 
   // We need the detector to start with fresh state.
@@ -1112,6 +1163,7 @@ nsresult nsHtml5StreamParser::OnStartRequest(nsIRequest* aRequest) {
   // Instantiate the converter here to avoid BOM sniffing.
   mDecodingLocalFileAsUTF8 = false;
   mUnicodeDecoder = mEncoding->NewDecoderWithBOMRemoval();
+  mDecoderMayHavePendingState = true;
   return NS_OK;
 }
 
@@ -107,7 +107,14 @@ class nsHtml5StreamParser final : public nsICharsetDetectionObserver {
   using Encoding = mozilla::Encoding;
 
   const uint32_t SNIFFING_BUFFER_SIZE = 1024;
-  const uint32_t READ_BUFFER_SIZE = 1024;
+  // Size (in UTF-16 code units) of the buffers the decoded stream is split
+  // into for tokenization. Each buffer costs an allocation plus a round of
+  // tokenizer re-entry, speculation bookkeeping and tree op flushing, so
+  // keeping this at a network-segment-ish size instead of 1024 avoids
+  // slicing large documents into thousands of pieces. Interruptibility is
+  // unaffected: the parser checks for termination between buffers, and
+  // tokenizing 4096 units is still far below perceptible latency.
+  const uint32_t READ_BUFFER_SIZE = 4096;
   const uint32_t LOCAL_FILE_UTF_8_BUFFER_SIZE = 1024 * 1024 * 4;  // 4 MB
 
   friend class nsHtml5RequestStopper;
@@ -562,6 +569,14 @@ class nsHtml5StreamParser final : public nsICharsetDetectionObserver {
 
   bool mHasHadErrors;
 
+  /**
+   * If true, the decoder may be holding state across calls (an incomplete
+   * byte sequence or an undecided BOM), so WriteStreamBytes() must not
+   * widen a leading ASCII run directly into the buffers but has to feed
+   * everything through the decoder.
+   */
+  bool mDecoderMayHavePendingState;
+
   /**
    * If true, we are decoding a local file that lacks an encoding
    * declaration as UTF-8 and we are not tokenizing yet.
@@ -10,6 +10,11 @@
 #include "mozilla/Likely.h"
 #include "mozilla/UniquePtr.h"
 
+// How much of the leading text of an inline <style> is gathered for the
+// speculative @import scan. @import rules must precede all other rules, so
+// sheets with a larger prefix of interest than this are rare.
+static const uint32_t kMaxSpeculationStyleTextLength = 1024;
+
 nsHtml5TreeBuilder::nsHtml5TreeBuilder(nsHtml5OplessBuilder* aBuilder)
     : mode(0),
       originalMode(0),
@@ -39,7 +44,8 @@ nsHtml5TreeBuilder::nsHtml5TreeBuilder(nsHtml5OplessBuilder* aBuilder)
       mSpeculativeLoadStage(nullptr),
       mBroken(NS_OK),
       mCurrentHtmlScriptIsAsyncOrDefer(false),
-      mPreventScriptExecution(false)
+      mPreventScriptExecution(false),
+      mSpeculationStyleElement(nullptr)
 #ifdef DEBUG
       ,
       mActive(false)
@@ -78,7 +84,8 @@ nsHtml5TreeBuilder::nsHtml5TreeBuilder(nsAHtml5TreeOpSink* aOpSink,
       mSpeculativeLoadStage(aStage),
       mBroken(NS_OK),
       mCurrentHtmlScriptIsAsyncOrDefer(false),
-      mPreventScriptExecution(false)
+      mPreventScriptExecution(false),
+      mSpeculationStyleElement(nullptr)
 #ifdef DEBUG
       ,
       mActive(false)
@@ -648,6 +655,20 @@ void nsHtml5TreeBuilder::appendCharacters(nsIContentHandle* aParent,
     return;
   }
 
+  if (mSpeculativeLoadStage && aParent == mSpeculationStyleElement &&
+      mSpeculationStyleText.Length() < kMaxSpeculationStyleTextLength) {
+    // Gather the leading text of an inline style sheet so that its prefix
+    // can be scanned for @import rules when the element is popped.
+    mSpeculationStyleText.Append(aBuffer, aLength);
+  }
+
+  if (!mOpQueue.IsEmpty() &&
+      mOpQueue.LastElement().TryCoalesceText(aBuffer, aLength, aParent)) {
+    // Merged into the previous character flush for the same parent, so the
+    // main thread performs one append instead of one per flush.
+    return;
+  }
+
   auto bufferCopy = mozilla::MakeUniqueFallible<char16_t[]>(aLength);
   if (!bufferCopy) {
     // Just assigning mBroken instead of generating tree op. The caller
@@ -888,6 +909,13 @@ void nsHtml5TreeBuilder::elementPushed(int32_t aNamespace, nsAtom* aName,
     }
     return;
   }
+  if (mSpeculativeLoadStage && aName == nsGkAtoms::style) {
+    // Start gathering this inline sheet's leading text; see
+    // appendCharacters() and ScanSpeculationStyleText().
+    mSpeculationStyleElement = aElement;
+    mSpeculationStyleText.Truncate();
+    return;
+  }
   if (mSpeculativeLoadStage && aName == nsGkAtoms::picture) {
     // mSpeculativeLoadStage is non-null only in the off-the-main-thread
     // tree builder, which handles the network stream
@@ -957,6 +985,12 @@ void nsHtml5TreeBuilder::elementPopped(int32_t aNamespace, nsAtom* aName,
     treeOp->Init(eTreeOpDoneAddingChildren, aElement);
     return;
   }
+  if (mSpeculativeLoadStage && aName == nsGkAtoms::style &&
+      aElement == mSpeculationStyleElement) {
+    ScanSpeculationStyleText();
+    mSpeculationStyleElement = nullptr;
+    mSpeculationStyleText.Truncate();
+  }
   if (aName == nsGkAtoms::style ||
       (aNamespace == kNameSpaceID_XHTML && aName == nsGkAtoms::link)) {
     if (mBuilder) {
@@ -1026,6 +1060,147 @@ void nsHtml5TreeBuilder::elementPopped(int32_t aNamespace, nsAtom* aName,
   }
 }
 
+static bool IsCssWhitespace(char16_t aChar) {
+  return aChar == ' ' || aChar == '\t' || aChar == '\n' || aChar == '\r' ||
+         aChar == '\f';
+}
+
+/**
+ * Advances aCur past CSS whitespace and comments. Returns false when the end
+ * of the text (or an unterminated comment) is reached.
+ */
+static bool SkipCssWhitespaceAndComments(const char16_t*& aCur,
+                                         const char16_t* aEnd) {
+  for (;;) {
+    while (aCur < aEnd && IsCssWhitespace(*aCur)) {
+      ++aCur;
+    }
+    if (aCur + 1 < aEnd && aCur[0] == '/' && aCur[1] == '*') {
+      aCur += 2;
+      for (;;) {
+        if (aCur + 1 >= aEnd) {
+          return false;
+        }
+        if (aCur[0] == '*' && aCur[1] == '/') {
+          aCur += 2;
+          break;
+        }
+        ++aCur;
+      }
+      continue;
+    }
+    return aCur < aEnd;
+  }
+}
+
+/**
+ * Advances aCur past aIdent if the text continues with it, compared ASCII
+ * case-insensitively. Leaves aCur alone otherwise.
+ */
+static bool ConsumeCssIdent(const char16_t*& aCur, const char16_t* aEnd,
+                            const char* aIdent) {
+  const char16_t* cur = aCur;
+  for (const char* ident = aIdent; *ident; ++ident, ++cur) {
+    if (cur == aEnd || (*cur | 0x20) != static_cast<char16_t>(*ident)) {
+      return false;
+    }
+  }
+  aCur = cur;
+  return true;
+}
+
+/**
+ * Reads a quoted CSS string starting at aCur into aString. Bails out on
+ * escapes and newlines rather than trying to be a full tokenizer.
+ */
+static bool ConsumeCssString(const char16_t*& aCur, const char16_t* aEnd,
+                             nsString& aString) {
+  char16_t quote = *aCur;
+  MOZ_ASSERT(quote == '"' || quote == '\'');
+  const char16_t* cur = aCur + 1;
+  const char16_t* start = cur;
+  while (cur < aEnd && *cur != quote && *cur != '\\' && *cur != '\n') {
+    ++cur;
+  }
+  if (cur == aEnd || *cur != quote) {
+    return false;
+  }
+  aString.Assign(start, cur - start);
+  aCur = cur + 1;
+  return true;
+}
+
+void nsHtml5TreeBuilder::ScanSpeculationStyleText() {
+  // A minimal scan of the prefix of an inline style sheet for @import rules,
+  // which must precede all other rules. This runs on the parser thread well
+  // before the sheet reaches the CSS parser on the main thread, so imported
+  // sheets can start loading while the document is still being parsed.
+  // Anything the scan cannot make sense of makes it stop; a wrongly
+  // extracted URL costs at most one unused speculative fetch, since the CSS
+  // parser still decides what actually gets loaded and used.
+  const char16_t* cur = mSpeculationStyleText.BeginReading();
+  const char16_t* end = mSpeculationStyleText.EndReading();
+  while (SkipCssWhitespaceAndComments(cur, end)) {
+    if (*cur != '@') {
+      return;
+    }
+    ++cur;
+    if (ConsumeCssIdent(cur, end, "charset")) {
+      // Nothing to extract; an inline sheet's encoding is the document's.
+    } else if (ConsumeCssIdent(cur, end, "import")) {
+      if (!SkipCssWhitespaceAndComments(cur, end)) {
+        return;
+      }
+      nsString url;
+      if (*cur == '"' || *cur == '\'') {
+        if (!ConsumeCssString(cur, end, url)) {
+          return;
+        }
+      } else if (ConsumeCssIdent(cur, end, "url(")) {
+        if (!SkipCssWhitespaceAndComments(cur, end)) {
+          return;
+        }
+        if (*cur == '"' || *cur == '\'') {
+          if (!ConsumeCssString(cur, end, url)) {
+            return;
+          }
+        } else {
+          const char16_t* start = cur;
+          while (cur < end && *cur != ')' && *cur != '(' && *cur != '"' &&
+                 *cur != '\'' && *cur != '\\') {
+            ++cur;
+          }
+          if (cur == end || *cur != ')') {
+            return;
+          }
+          const char16_t* urlEnd = cur;
+          while (urlEnd > start && IsCssWhitespace(urlEnd[-1])) {
+            --urlEnd;
+          }
+          url.Assign(start, urlEnd - start);
+        }
+      } else {
+        return;
+      }
+      if (!url.IsEmpty()) {
+        mSpeculativeLoadQueue.AppendElement()->InitImportStyle(url);
+      }
+    } else {
+      // Some other at-rule; @import rules can no longer follow.
+      return;
+    }
+    // Skip the rest of the rule: a media query, the closing paren of a
+    // url() token, or the charset string.
+    while (cur < end && *cur != ';') {
+      ++cur;
+    }
+    if (cur == end) {
+      return;
+    }
+    ++cur;
+  }
+}
+
 void nsHtml5TreeBuilder::accumulateCharacters(const char16_t* aBuf,
                                               int32_t aStart, int32_t aLength) {
   MOZ_RELEASE_ASSERT(charBufferLen + aLength <= charBuffer.length,
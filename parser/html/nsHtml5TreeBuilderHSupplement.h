@@ -24,6 +24,14 @@ nsHtml5TreeOpStage* mSpeculativeLoadStage;
 nsresult mBroken;
 bool mCurrentHtmlScriptIsAsyncOrDefer;
 bool mPreventScriptExecution;
+// The handle of the <style> element whose text is currently being gathered
+// for @import pre-scanning, or null when not inside an inline style. Used
+// only when mSpeculativeLoadStage is non-null; the handle is never
+// dereferenced, only compared.
+nsIContentHandle* mSpeculationStyleElement;
+// The leading text of that element's sheet. Capped at a small length,
+// since @import rules must precede all other rules.
+nsString mSpeculationStyleText;
 #ifdef DEBUG
 bool mActive;
 #endif
@@ -80,6 +88,12 @@ void MarkAsBrokenAndRequestSuspensionWithoutBuilder(nsresult aRv) {
 
 void MarkAsBrokenFromPortability(nsresult aRv);
 
+/**
+ * Scans the gathered prefix of an inline style sheet for @import rules and
+ * enqueues a speculative load for each imported URL.
+ */
+void ScanSpeculationStyleText();
+
 public:
 explicit nsHtml5TreeBuilder(nsHtml5OplessBuilder* aBuilder);
 
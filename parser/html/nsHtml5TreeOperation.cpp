@@ -6,7 +6,9 @@
 
 #include "nsHtml5TreeOperation.h"
 #include "mozAutoDocUpdate.h"
+#include "mozilla/CheckedInt.h"
 #include "mozilla/Likely.h"
+#include "mozilla/UniquePtr.h"
 #include "mozilla/dom/Comment.h"
 #include "mozilla/dom/DocumentType.h"
 #include "mozilla/dom/Element.h"
@@ -127,6 +129,39 @@ nsHtml5TreeOperation::~nsHtml5TreeOperation() {
   }
 }
 
+// Upper bound (in UTF-16 code units) on the buffer of a coalesced
+// eTreeOpAppendText op.
+static const int32_t kMaxCoalescedTextLength = 1 << 16;
+
+bool nsHtml5TreeOperation::TryCoalesceText(const char16_t* aBuffer,
+                                           int32_t aLength,
+                                           nsIContentHandle* aParent) {
+  MOZ_ASSERT(aBuffer, "Null buffer");
+  if (mOpCode != eTreeOpAppendText ||
+      mOne.node != static_cast<nsIContent**>(aParent)) {
+    return false;
+  }
+  int32_t oldLength = mFour.integer;
+  mozilla::CheckedInt<int32_t> newLength(oldLength);
+  newLength += aLength;
+  // The cap keeps the copying of already-queued data amortized-linear when a
+  // single enormous text node arrives as a long run of character flushes.
+  if (!newLength.isValid() || newLength.value() > kMaxCoalescedTextLength) {
+    return false;
+  }
+  auto combined = mozilla::MakeUniqueFallible<char16_t[]>(newLength.value());
+  if (!combined) {
+    // Let the caller allocate a separate op instead.
+    return false;
+  }
+  memcpy(combined.get(), mTwo.unicharPtr, oldLength * sizeof(char16_t));
+  memcpy(combined.get() + oldLength, aBuffer, aLength * sizeof(char16_t));
+  delete[] mTwo.unicharPtr;
+  mTwo.unicharPtr = combined.release();
+  mFour.integer = newLength.value();
+  return true;
+}
+
 nsresult nsHtml5TreeOperation::AppendTextToTextNode(
     const char16_t* aBuffer, uint32_t aLength, dom::Text* aTextNode,
     nsHtml5DocumentBuilder* aBuilder) {
@@ -156,7 +191,8 @@ nsresult nsHtml5TreeOperation::AppendText(const char16_t* aBuffer,
   }
 
   nsNodeInfoManager* nodeInfoManager = aParent->OwnerDoc()->NodeInfoManager();
-  RefPtr<nsTextNode> text = new nsTextNode(nodeInfoManager);
+  RefPtr<nsTextNode> text =
+      new (nodeInfoManager) nsTextNode(nodeInfoManager);
   NS_ASSERTION(text, "Infallible malloc failed?");
   rv = text->SetText(aBuffer, aLength, false);
   NS_ENSURE_SUCCESS(rv, rv);
@@ -575,7 +611,8 @@ nsresult nsHtml5TreeOperation::FosterParentText(
 
     nsNodeInfoManager* nodeInfoManager =
         aStackParent->OwnerDoc()->NodeInfoManager();
-    RefPtr<nsTextNode> text = new nsTextNode(nodeInfoManager);
+    RefPtr<nsTextNode> text =
+        new (nodeInfoManager) nsTextNode(nodeInfoManager);
     NS_ASSERTION(text, "Infallible malloc failed?");
     rv = text->SetText(aBuffer, aLength, false);
     NS_ENSURE_SUCCESS(rv, rv);
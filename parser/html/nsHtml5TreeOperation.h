@@ -464,6 +464,16 @@ class nsHtml5TreeOperation final {
     mFour.integer = aLineNumber;
   }
 
+  /**
+   * Tries to coalesce the given character data into this operation instead
+   * of requiring a new op. Succeeds only if this is an eTreeOpAppendText
+   * appending to aParent and the combined buffer stays below a size cap, so
+   * that repeated coalescing of a huge text node can't degenerate into
+   * quadratic copying.
+   */
+  bool TryCoalesceText(const char16_t* aBuffer, int32_t aLength,
+                       nsIContentHandle* aParent);
+
   inline bool IsRunScript() { return mOpCode == eTreeOpRunScript; }
 
   inline bool IsMarkAsBroken() { return mOpCode == eTreeOpMarkAsBroken; }
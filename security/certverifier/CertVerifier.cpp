@@ -19,6 +19,9 @@
 #include "mozilla/Assertions.h"
 #include "mozilla/Casting.h"
 #include "mozilla/IntegerPrintfMacros.h"
+#include "mozilla/StaticMutex.h"
+#include "mozilla/StaticPtr.h"
+#include "nsDataHashtable.h"
 #include "nsNSSComponent.h"
 #include "nsPromiseFlatString.h"
 #include "nsServiceManagerUtils.h"
@@ -142,6 +145,24 @@ Result IsCertChainRootBuiltInRoot(const UniqueCERTCertList& chain,
   return IsCertBuiltInRoot(root, result);
 }
 
+// The answers IsCertBuiltInRoot computes depend only on the certificate and
+// on the set of loaded PKCS#11 modules. Since a busy session asks the same
+// question about the same few roots on every handshake, and every miss walks
+// every slot of every module, the answers are memoized here, keyed by the
+// certificate's DER. ClearBuiltInRootsCache must be called whenever the
+// module set changes.
+static StaticMutex sBuiltInRootsCacheMutex;
+static StaticAutoPtr<nsDataHashtable<nsCStringHashKey, bool>>
+    sBuiltInRootsCache;
+// The cache should only ever hold the handful of roots actually in use;
+// guard against pathological inputs anyway.
+static const uint32_t kBuiltInRootsCacheMaxEntries = 64;
+
+void ClearBuiltInRootsCache() {
+  StaticMutexAutoLock lock(sBuiltInRootsCacheMutex);
+  sBuiltInRootsCache = nullptr;
+}
+
 // The term "builtin root" traditionally refers to a root CA certificate that
 // has been added to the NSS trust store, because it has been approved
 // for inclusion according to the Mozilla CA policy, and might be accepted
@@ -153,6 +174,8 @@ Result IsCertBuiltInRoot(CERTCertificate* cert, bool& result) {
 
   result = false;
 #ifdef DEBUG
+  // The cache is not used in debug builds because the answer can additionally
+  // depend on the test built-in root hash pref, which may change at any time.
   nsCOMPtr<nsINSSComponent> component(do_GetService(PSM_COMPONENT_CONTRACTID));
   if (!component) {
     return Result::FATAL_ERROR_LIBRARY_FAILURE;
@@ -164,6 +187,16 @@ Result IsCertBuiltInRoot(CERTCertificate* cert, bool& result) {
   if (result) {
     return Success;
   }
+#else
+  nsDependentCSubstring certDER(
+      BitwiseCast<const char*, const unsigned char*>(cert->derCert.data),
+      cert->derCert.len);
+  {
+    StaticMutexAutoLock cacheLock(sBuiltInRootsCacheMutex);
+    if (sBuiltInRootsCache && sBuiltInRootsCache->Get(certDER, &result)) {
+      return Success;
+    }
+  }
 #endif  // DEBUG
   AutoSECMODListReadLock lock;
   for (SECMODModuleList* list = SECMOD_GetDefaultModuleList(); list;
@@ -195,6 +228,17 @@ Result IsCertBuiltInRoot(CERTCertificate* cert, bool& result) {
       }
     }
   }
+#ifndef DEBUG
+  {
+    StaticMutexAutoLock cacheLock(sBuiltInRootsCacheMutex);
+    if (!sBuiltInRootsCache) {
+      sBuiltInRootsCache = new nsDataHashtable<nsCStringHashKey, bool>();
+    } else if (sBuiltInRootsCache->Count() >= kBuiltInRootsCacheMaxEntries) {
+      sBuiltInRootsCache->Clear();
+    }
+    sBuiltInRootsCache->Put(certDER, result);
+  }
+#endif  // DEBUG
   return Success;
 }
 
@@ -254,6 +254,10 @@ class CertVerifier {
 };
 
 mozilla::pkix::Result IsCertBuiltInRoot(CERTCertificate* cert, bool& result);
+// Drops the memoized results of IsCertBuiltInRoot. Must be called whenever
+// the set of loaded PKCS#11 modules changes, since that can change which
+// certificates count as built-in roots.
+void ClearBuiltInRootsCache();
 mozilla::pkix::Result CertListContainsExpectedKeys(
     const CERTCertList* certList, const char* hostname,
     mozilla::pkix::Time time, CertVerifier::PinningMode pinningMode);
@@ -8,6 +8,7 @@
 
 #include <stdint.h>
 
+#include "CertVerifier.h"
 #include "ExtendedValidation.h"
 #include "NSSErrorsService.h"
 #include "OCSPVerificationTrustDomain.h"
@@ -1377,6 +1378,7 @@ bool LoadLoadableRoots(const nsCString& dir) {
     return false;
   }
 
+  ClearBuiltInRootsCache();
   return true;
 }
 
@@ -1385,6 +1387,7 @@ void UnloadLoadableRoots() {
 
   if (rootsModule) {
     SECMOD_UnloadUserModule(rootsModule.get());
+    ClearBuiltInRootsCache();
   }
 }
 
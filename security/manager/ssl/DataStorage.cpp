@@ -10,6 +10,7 @@
 #include "mozilla/ClearOnShutdown.h"
 #include "mozilla/dom/PContent.h"
 #include "mozilla/dom/ContentParent.h"
+#include "mozilla/HashFunctions.h"
 #include "mozilla/Preferences.h"
 #include "mozilla/Services.h"
 #include "mozilla/StaticMutex.h"
@@ -41,6 +42,13 @@ static const uint32_t sMaxDataEntries = 1024;
 static const int64_t sOneDayInMicroseconds =
     int64_t(24 * 60 * 60) * PR_USEC_PER_SEC;
 
+// Hashes a key for DataStorage::KeyFilter. The filter covers the keys of all
+// three tables without regard to type; a filter miss means "in no table",
+// which is all the lock-free fast path in Get needs.
+static uint32_t FilterKeyHash(const nsACString& aKey) {
+  return mozilla::HashString(aKey.BeginReading(), aKey.Length());
+}
+
 namespace {
 
 // DataStorageSharedThread provides one shared thread that every DataStorage
@@ -486,6 +494,7 @@ DataStorage::Reader::Run() {
         Entry newerEntry;
         bool present = mDataStorage->mPersistentDataTable.Get(key, &newerEntry);
         if (!present) {
+          mDataStorage->mKeyFilter.Add(FilterKeyHash(key));
           mDataStorage->mPersistentDataTable.Put(key, entry);
         }
       }
@@ -629,6 +638,13 @@ nsresult DataStorage::AsyncReadData(const MutexAutoLock& /*aProofOfLock*/) {
 void DataStorage::WaitForReady() {
   MOZ_DIAGNOSTIC_ASSERT(mInitCalled, "Waiting before Init() has been called?");
 
+  // mReady only ever goes from false to true, so once we've seen it set we
+  // can avoid the monitor entirely. This runs for every Get on the request
+  // path, long after initialization has finished.
+  if (mReady) {
+    return;
+  }
+
   MonitorAutoLock readyLock(mReadyMonitor);
   while (!mReady) {
     readyLock.Wait();
@@ -638,6 +654,15 @@ void DataStorage::WaitForReady() {
 
 nsCString DataStorage::Get(const nsCString& aKey, DataStorageType aType) {
   WaitForReady();
+
+  // Most keys looked up on the request path (e.g. HSTS checks for hosts that
+  // never sent an HSTS header) aren't in any table. The filter never answers
+  // "no" for a present key, so a miss here means we can return without
+  // taking mMutex at all.
+  if (!mKeyFilter.MightContain(FilterKeyHash(aKey))) {
+    return EmptyCString();
+  }
+
   MutexAutoLock lock(mMutex);
 
   Entry entry;
@@ -730,7 +755,10 @@ void DataStorage::MaybeEvictOneEntry(DataStorageType aType,
       }
     }
 
-    table.Remove(toEvict.mKey);
+    if (table.Contains(toEvict.mKey)) {
+      table.Remove(toEvict.mKey);
+      mKeyFilter.Remove(FilterKeyHash(toEvict.mKey));
+    }
   }
 }
 
@@ -795,6 +823,9 @@ nsresult DataStorage::PutInternal(const nsCString& aKey, Entry& aEntry,
                                   DataStorageType aType,
                                   const MutexAutoLock& aProofOfLock) {
   DataStorageTable& table = GetTableForType(aType, aProofOfLock);
+  if (!table.Contains(aKey)) {
+    mKeyFilter.Add(FilterKeyHash(aKey));
+  }
   table.Put(aKey, aEntry);
 
   if (aType == DataStorage_Persistent && !mPendingWrite) {
@@ -809,7 +840,10 @@ void DataStorage::Remove(const nsCString& aKey, DataStorageType aType) {
   MutexAutoLock lock(mMutex);
 
   DataStorageTable& table = GetTableForType(aType, lock);
-  table.Remove(aKey);
+  if (table.Contains(aKey)) {
+    table.Remove(aKey);
+    mKeyFilter.Remove(FilterKeyHash(aKey));
+  }
 
   if (aType == DataStorage_Persistent && !mPendingWrite) {
     Unused << AsyncSetTimer(lock);
@@ -921,6 +955,7 @@ nsresult DataStorage::Clear() {
   mPersistentDataTable.Clear();
   mTemporaryDataTable.Clear();
   mPrivateDataTable.Clear();
+  mKeyFilter.Clear();
 
   if (XRE_IsParentProcess()) {
     // Asynchronously clear the file. This is similar to the permission manager
@@ -1037,6 +1072,9 @@ DataStorage::Observe(nsISupports* /*aSubject*/, const char* aTopic,
 
   if (strcmp(aTopic, "last-pb-context-exited") == 0) {
     MutexAutoLock lock(mMutex);
+    for (auto iter = mPrivateDataTable.Iter(); !iter.Done(); iter.Next()) {
+      mKeyFilter.Remove(FilterKeyHash(iter.Key()));
+    }
     mPrivateDataTable.Clear();
   }
 
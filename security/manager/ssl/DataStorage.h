@@ -178,6 +178,54 @@ class DataStorage : public nsIObserver {
     Entry mEntry;
   };
 
+  // A counting Bloom filter over the keys of all three tables. The request
+  // path (e.g. one HSTS check per load) uses it to answer "definitely not
+  // present" without taking mMutex; a false positive just means doing the
+  // table lookup under the lock as before. Writers must hold mMutex, so the
+  // counters never race with each other. Readers use relaxed atomic loads
+  // and take no lock; a reader that misses a concurrent insertion behaves as
+  // if the lookup had happened before the insertion, which is fine. The
+  // counters can't saturate because the tables are limited to
+  // sMaxDataEntries entries each.
+  class KeyFilter {
+   public:
+    KeyFilter() { Clear(); }
+
+    // The following three methods must only be called with mMutex held.
+    void Add(uint32_t aHash) {
+      ++mCounters[FirstSlot(aHash)];
+      ++mCounters[SecondSlot(aHash)];
+    }
+
+    void Remove(uint32_t aHash) {
+      --mCounters[FirstSlot(aHash)];
+      --mCounters[SecondSlot(aHash)];
+    }
+
+    void Clear() {
+      for (auto& counter : mCounters) {
+        counter = 0;
+      }
+    }
+
+    // May be called on any thread without holding mMutex.
+    bool MightContain(uint32_t aHash) const {
+      return mCounters[FirstSlot(aHash)] && mCounters[SecondSlot(aHash)];
+    }
+
+   private:
+    static const uint32_t kKeyBits = 12;
+    static const uint32_t kKeyMask = (1 << kKeyBits) - 1;
+    static const size_t kArraySize = 1 << kKeyBits;
+
+    static uint32_t FirstSlot(uint32_t aHash) { return aHash & kKeyMask; }
+    static uint32_t SecondSlot(uint32_t aHash) {
+      return (aHash >> 16) & kKeyMask;
+    }
+
+    Atomic<uint32_t, Relaxed> mCounters[kArraySize];
+  };
+
   typedef nsDataHashtable<nsCStringHashKey, Entry> DataStorageTable;
   typedef nsRefPtrHashtable<nsStringHashKey, DataStorage> DataStorages;
 
@@ -222,10 +270,17 @@ class DataStorage : public nsIObserver {
   bool mShuttingDown;
   // (End list of members protected by mMutex)
 
+  // Modified only with mMutex held; see the class comment for how reads may
+  // happen on any thread with no lock.
+  KeyFilter mKeyFilter;
+
   mozilla::Atomic<bool> mInitCalled;  // Indicates that Init() has been called.
 
   Monitor mReadyMonitor;  // Do not acquire this at the same time as mMutex.
-  bool mReady;  // Indicates that saved data has been read and Get can proceed.
+  // Indicates that saved data has been read and Get can proceed. Only ever
+  // transitions from false to true, so once a reader has seen it set it can
+  // skip taking mReadyMonitor.
+  mozilla::Atomic<bool, ReleaseAcquire> mReady;
 
   const nsString mFilename;
 
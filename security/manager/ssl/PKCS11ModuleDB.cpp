@@ -6,6 +6,7 @@
 
 #include "PKCS11ModuleDB.h"
 
+#include "CertVerifier.h"
 #include "ScopedNSSTypes.h"
 #include "nsIMutableArray.h"
 #include "nsNSSCertHelper.h"
@@ -58,6 +59,7 @@ PKCS11ModuleDB::DeleteModule(const nsAString& aModuleName) {
     return NS_ERROR_FAILURE;
   }
 
+  ClearBuiltInRootsCache();
   return NS_OK;
 }
 
@@ -103,6 +105,7 @@ PKCS11ModuleDB::AddModule(const nsAString& aModuleName,
   if (srv != SECSuccess) {
     return NS_ERROR_FAILURE;
   }
+  ClearBuiltInRootsCache();
   return NS_OK;
 }
 
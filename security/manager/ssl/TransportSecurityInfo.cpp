@@ -21,6 +21,7 @@
 #include "nsNSSComponent.h"
 #include "nsNSSHelper.h"
 #include "nsReadableUtils.h"
+#include "nsSerializationHelper.h"
 #include "nsServiceManagerUtils.h"
 #include "nsXULAppAPI.h"
 #include "mozpkix/pkixtypes.h"
@@ -57,7 +58,8 @@ TransportSecurityInfo::TransportSecurityInfo()
       mMutex("TransportSecurityInfo::mMutex"),
       mSecurityState(nsIWebProgressListener::STATE_IS_INSECURE),
       mErrorCode(0),
-      mPort(0) {}
+      mPort(0),
+      mSerializationGeneration(0) {}
 
 NS_IMPL_ISUPPORTS(TransportSecurityInfo, nsITransportSecurityInfo,
                   nsIInterfaceRequestor, nsISerializable, nsIClassInfo)
@@ -101,6 +103,14 @@ void TransportSecurityInfo::SetCanceled(PRErrorCode errorCode) {
   MutexAutoLock lock(mMutex);
   mErrorCode = errorCode;
   mCanceled = true;
+  mCachedSerializedForm.Truncate();
+  mSerializationGeneration++;
+}
+
+void TransportSecurityInfo::InvalidateCachedSerializedForm() {
+  MutexAutoLock lock(mMutex);
+  mCachedSerializedForm.Truncate();
+  mSerializationGeneration++;
 }
 
 bool TransportSecurityInfo::IsCanceled() { return mCanceled; }
@@ -113,6 +123,7 @@ TransportSecurityInfo::GetSecurityState(uint32_t* state) {
 
 void TransportSecurityInfo::SetSecurityState(uint32_t aState) {
   mSecurityState = aState;
+  InvalidateCachedSerializedForm();
 }
 
 NS_IMETHODIMP
@@ -245,6 +256,34 @@ TransportSecurityInfo::Write(nsIObjectOutputStream* aStream) {
   return NS_OK;
 }
 
+NS_IMETHODIMP
+TransportSecurityInfo::ToString(nsACString& aResult) {
+  uint32_t generation;
+  {
+    MutexAutoLock lock(mMutex);
+    if (!mCachedSerializedForm.IsEmpty()) {
+      aResult = mCachedSerializedForm;
+      return NS_OK;
+    }
+    generation = mSerializationGeneration;
+  }
+
+  // NS_SerializeToString re-enters this object through Write(), which takes
+  // mMutex, so the lock must not be held across this call.
+  nsAutoCString serialized;
+  nsresult rv = NS_SerializeToString(this, serialized);
+  if (NS_FAILED(rv)) {
+    return rv;
+  }
+
+  MutexAutoLock lock(mMutex);
+  if (generation == mSerializationGeneration) {
+    mCachedSerializedForm = serialized;
+  }
+  aResult = serialized;
+  return NS_OK;
+}
+
 #define CHILD_DIAGNOSTIC_ASSERT(condition, message)       \
   if (XRE_GetProcessType() == GeckoProcessType_Content) { \
     MOZ_DIAGNOSTIC_ASSERT(condition, message);            \
@@ -396,6 +435,9 @@ TransportSecurityInfo::Read(nsIObjectInputStream* aStream) {
 
   MutexAutoLock lock(mMutex);
 
+  mCachedSerializedForm.Truncate();
+  mSerializationGeneration++;
+
   rv = aStream->Read32(&mSecurityState);
   CHILD_DIAGNOSTIC_ASSERT(NS_SUCCEEDED(rv), "Deserialization should not fail");
   if (NS_FAILED(rv)) {
@@ -673,14 +715,22 @@ void RememberCertErrorsTable::LookupCertErrorBits(
 
 void TransportSecurityInfo::SetStatusErrorBits(nsNSSCertificate* cert,
                                                uint32_t collected_errors) {
-  MutexAutoLock lock(mMutex);
-
+  // SetServerCert invalidates the cached serialization, which takes mMutex,
+  // so it must be called before the lock is acquired here.
   SetServerCert(cert, EVStatus::NotEV);
 
-  mHaveCertErrorBits = true;
-  mIsDomainMismatch = collected_errors & nsICertOverrideService::ERROR_MISMATCH;
-  mIsNotValidAtThisTime = collected_errors & nsICertOverrideService::ERROR_TIME;
-  mIsUntrusted = collected_errors & nsICertOverrideService::ERROR_UNTRUSTED;
+  {
+    MutexAutoLock lock(mMutex);
+
+    mHaveCertErrorBits = true;
+    mIsDomainMismatch =
+        collected_errors & nsICertOverrideService::ERROR_MISMATCH;
+    mIsNotValidAtThisTime =
+        collected_errors & nsICertOverrideService::ERROR_TIME;
+    mIsUntrusted = collected_errors & nsICertOverrideService::ERROR_UNTRUSTED;
+    mCachedSerializedForm.Truncate();
+    mSerializationGeneration++;
+  }
 
   RememberCertErrorsTable::GetInstance().RememberCertHasError(this, SECFailure);
 }
@@ -699,6 +749,7 @@ nsresult TransportSecurityInfo::SetFailedCertChain(
     UniqueCERTCertList certList) {
   // nsNSSCertList takes ownership of certList
   mFailedCertChain = new nsNSSCertList(std::move(certList));
+  InvalidateCachedSerializedForm();
 
   return NS_OK;
 }
@@ -719,6 +770,7 @@ void TransportSecurityInfo::SetServerCert(nsNSSCertificate* aServerCert,
   mServerCert = aServerCert;
   mIsEV = (aEVStatus == EVStatus::EV);
   mHasIsEVStatus = true;
+  InvalidateCachedSerializedForm();
 }
 
 NS_IMETHODIMP
@@ -735,6 +787,7 @@ nsresult TransportSecurityInfo::SetSucceededCertChain(
     UniqueCERTCertList aCertList) {
   // nsNSSCertList takes ownership of certList
   mSucceededCertChain = new nsNSSCertList(std::move(aCertList));
+  InvalidateCachedSerializedForm();
 
   return NS_OK;
 }
@@ -833,6 +886,8 @@ void TransportSecurityInfo::SetCertificateTransparencyInfo(
     const mozilla::psm::CertificateTransparencyInfo& info) {
   using mozilla::ct::CTPolicyCompliance;
 
+  InvalidateCachedSerializedForm();
+
   mCertificateTransparencyStatus =
       nsITransportSecurityInfo::CERTIFICATE_TRANSPARENCY_NOT_APPLICABLE;
 
@@ -121,6 +121,16 @@ class TransportSecurityInfo : public nsITransportSecurityInfo,
   nsCString mHostName;
   OriginAttributes mOriginAttributes;
 
+  // Memoized result of ToString(), protected by mMutex along with its
+  // generation counter.  The setters of any state that feeds Write() clear
+  // the memo and bump the generation; the counter lets ToString() notice a
+  // setter racing with an in-progress serialization and skip caching the
+  // then-outdated result.
+  nsCString mCachedSerializedForm;
+  uint32_t mSerializationGeneration;
+
+  void InvalidateCachedSerializedForm();
+
   nsCOMPtr<nsIX509Cert> mServerCert;
   nsCOMPtr<nsIX509CertList> mSucceededCertChain;
 
@@ -1170,6 +1170,13 @@ static void reportHandshakeResult(int32_t bytesTransferred, bool wasReading,
 
 int32_t checkHandshake(int32_t bytesTransfered, bool wasReading,
                        PRFileDesc* ssl_layer_fd, nsNSSSocketInfo* socketInfo) {
+  // Fast path for an established connection transferring data: nothing below
+  // applies and there's no reason to pay for the thread-local PR_GetError()
+  // lookup on every single record read on the socket thread.
+  if (bytesTransfered > 0 && !socketInfo->IsHandshakePending()) {
+    return bytesTransfered;
+  }
+
   const PRErrorCode originalError = PR_GetError();
   PRErrorCode err = originalError;
 
@@ -86,6 +86,30 @@ TEST_F(psm_DataStorageTest, GetPutRemove) {
   EXPECT_TRUE(result.IsEmpty());
 }
 
+TEST_F(psm_DataStorageTest, RepeatedPutRemove) {
+  // Overwriting an entry repeatedly and then removing it must not affect
+  // lookups of other entries (the negative-lookup filter counts each key
+  // once, not once per Put).
+  NS_NAMED_LITERAL_CSTRING(otherKey, "other");
+  EXPECT_EQ(NS_OK, storage->Put(testKey, testValue, DataStorage_Temporary));
+  EXPECT_EQ(NS_OK, storage->Put(otherKey, testValue, DataStorage_Temporary));
+  for (int i = 0; i < 3; i++) {
+    EXPECT_EQ(NS_OK, storage->Put(testKey, nsPrintfCString("%d", i),
+                                  DataStorage_Temporary));
+  }
+  storage->Remove(testKey, DataStorage_Temporary);
+  // Removing an absent key must be harmless.
+  storage->Remove(testKey, DataStorage_Temporary);
+  nsCString result = storage->Get(testKey, DataStorage_Temporary);
+  EXPECT_TRUE(result.IsEmpty());
+  result = storage->Get(otherKey, DataStorage_Temporary);
+  EXPECT_STREQ("value", result.get());
+  // A removed key can be added back.
+  EXPECT_EQ(NS_OK, storage->Put(testKey, testValue, DataStorage_Temporary));
+  result = storage->Get(testKey, DataStorage_Temporary);
+  EXPECT_STREQ("value", result.get());
+}
+
 TEST_F(psm_DataStorageTest, InputValidation) {
   // Keys may not have tabs or newlines
   EXPECT_EQ(NS_ERROR_INVALID_ARG,
@@ -254,7 +254,11 @@ nsresult StartupCache::GetBuffer(const char* id, UniquePtr<char[]>* outbuf,
     }
   }
 
-  nsresult rv = GetBufferFromZipArchive(mArchive, true, id, outbuf, length);
+  // Entries are deflated, so corrupt data makes inflation fail and turns into
+  // a cache miss, and a torn archive fails OpenArchive outright; both already
+  // protect us without paying for a CRC pass over every entry we read during
+  // startup.
+  nsresult rv = GetBufferFromZipArchive(mArchive, false, id, outbuf, length);
   if (NS_SUCCEEDED(rv)) {
     Telemetry::AccumulateCategorical(
         Telemetry::LABELS_STARTUP_CACHE_REQUESTS::HitDisk);
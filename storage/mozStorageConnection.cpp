@@ -1519,9 +1519,12 @@ nsresult Connection::initializeClone(Connection* aClone, bool aReadOnly) {
       "cache_size",  "temp_store",         "foreign_keys", "journal_size_limit",
       "synchronous", "wal_autocheckpoint", "busy_timeout"};
   for (auto& pragma : pragmas) {
-    // Read-only connections just need cache_size and temp_store pragmas.
+    // Read-only connections just need cache_size and temp_store pragmas,
+    // plus busy_timeout so that readers running against a WAL database wait
+    // out a writer's checkpoint instead of failing with SQLITE_BUSY.
     if (aReadOnly && ::strcmp(pragma, "cache_size") != 0 &&
-        ::strcmp(pragma, "temp_store") != 0) {
+        ::strcmp(pragma, "temp_store") != 0 &&
+        ::strcmp(pragma, "busy_timeout") != 0) {
       continue;
     }
 
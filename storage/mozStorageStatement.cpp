@@ -143,6 +143,18 @@ nsresult Statement::initialize(Connection* aDBConnection,
     columnNames[i].Assign(name);
   }
 
+  // Cache the parameter names too, so that binding by name doesn't have to
+  // search the statement's parameter list on every bind.
+  mParamNames.Clear();
+  nsCString* paramNames = mParamNames.AppendElements(mParamCount);
+  for (uint32_t i = 0; i < mParamCount; i++) {
+    // Parameter indexes are 1-based.  Unnamed ("?") parameters have no name.
+    const char* name = ::sqlite3_bind_parameter_name(mDBStatement, i + 1);
+    if (name) {
+      paramNames[i].Assign(name);
+    }
+  }
+
 #ifdef DEBUG
   // We want to try and test for LIKE and that consumers are using
   // escapeStringForLIKE instead of just trusting user input.  The idea to
@@ -395,17 +407,19 @@ NS_IMETHODIMP
 Statement::GetParameterIndex(const nsACString& aName, uint32_t* _index) {
   if (!mDBStatement) return NS_ERROR_NOT_INITIALIZED;
 
-  // We do not accept any forms of names other than ":name", but we need to add
-  // the colon for SQLite.
+  // We do not accept any forms of names other than ":name", but the names we
+  // cached at prepare time carry the prefix character, so add the colon.
   nsAutoCString name(":");
   name.Append(aName);
-  int ind = ::sqlite3_bind_parameter_index(mDBStatement, name.get());
-  if (ind == 0)  // Named parameter not found.
-    return NS_ERROR_INVALID_ARG;
-
-  *_index = ind - 1;  // SQLite indexes are 1-based, we are 0-based.
+  for (uint32_t i = 0; i < mParamCount; i++) {
+    if (mParamNames[i].Equals(name)) {
+      *_index = i;
+      return NS_OK;
+    }
+  }
 
-  return NS_OK;
+  // Named parameter not found.
+  return NS_ERROR_INVALID_ARG;
 }
 
 NS_IMETHODIMP
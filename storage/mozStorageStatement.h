@@ -75,6 +75,7 @@ class Statement final : public mozIStorageStatement,
   uint32_t mParamCount;
   uint32_t mResultColumnCount;
   nsTArray<nsCString> mColumnNames;
+  nsTArray<nsCString> mParamNames;
   bool mExecuting;
 
   /**
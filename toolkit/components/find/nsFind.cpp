@@ -152,35 +152,45 @@ static bool IsTextFormControl(nsIContent& aContent) {
   return formControl->IsTextControl(true);
 }
 
-static bool SkipNode(const nsIContent* aContent) {
-  const nsIContent* content = aContent;
-  while (content) {
-    if (!IsVisibleNode(content) || content->IsComment() ||
-        content->IsAnyOfHTMLElements(nsGkAtoms::script, nsGkAtoms::noframes,
-                                     nsGkAtoms::select)) {
-      DEBUG_FIND_PRINTF("Skipping node: ");
-      DumpNode(content);
-      return true;
-    }
+// Checks only aContent itself; callers that cannot rely on the ancestors
+// having been checked already need SkipNode() below.
+static bool SkipNodeIgnoringAncestors(const nsIContent* aContent) {
+  if (!IsVisibleNode(aContent) || aContent->IsComment() ||
+      aContent->IsAnyOfHTMLElements(nsGkAtoms::script, nsGkAtoms::noframes,
+                                    nsGkAtoms::select)) {
+    DEBUG_FIND_PRINTF("Skipping node: ");
+    DumpNode(aContent);
+    return true;
+  }
 
-    // Skip option nodes if their select is a combo box, or if they
-    // have no select (somehow).
-    if (content->IsHTMLElement(nsGkAtoms::option)) {
-      const HTMLOptionElement* option = HTMLOptionElement::FromNode(content);
-      if (option) {
-        HTMLSelectElement* select =
-            HTMLSelectElement::FromNodeOrNull(option->GetParent());
-        if (!select || select->IsCombobox()) {
-          DEBUG_FIND_PRINTF("Skipping node: ");
-          DumpNode(content);
-          return true;
-        }
+  // Skip option nodes if their select is a combo box, or if they
+  // have no select (somehow).
+  if (aContent->IsHTMLElement(nsGkAtoms::option)) {
+    const HTMLOptionElement* option = HTMLOptionElement::FromNode(aContent);
+    if (option) {
+      HTMLSelectElement* select =
+          HTMLSelectElement::FromNodeOrNull(option->GetParent());
+      if (!select || select->IsCombobox()) {
+        DEBUG_FIND_PRINTF("Skipping node: ");
+        DumpNode(aContent);
+        return true;
       }
     }
+  }
+
+  // Skip NAC in non-form-control.
+  if (aContent->IsInNativeAnonymousSubtree() &&
+      !IsTextFormControl(AnonymousSubtreeRootParent(*aContent))) {
+    return true;
+  }
+
+  return false;
+}
 
-    // Skip NAC in non-form-control.
-    if (content->IsInNativeAnonymousSubtree() &&
-        !IsTextFormControl(AnonymousSubtreeRootParent(*content))) {
+static bool SkipNode(const nsIContent* aContent) {
+  for (const nsIContent* content = aContent; content;
+       content = content->GetFlattenedTreeParent()) {
+    if (SkipNodeIgnoringAncestors(content)) {
       return true;
     }
 
@@ -188,8 +198,6 @@ static bool SkipNode(const nsIContent* aContent) {
     if (IsBlockNode(content)) {
       return false;
     }
-
-    content = content->GetFlattenedTreeParent();
   }
 
   return false;
@@ -261,15 +269,43 @@ struct nsFind::State final {
 void nsFind::State::Advance() {
   MOZ_ASSERT(mInitialized);
 
+  if (mFindBackward) {
+    // Going backward the iterator enters a subtree at its last descendant,
+    // before any of the ancestors have been seen, so every node has to vet
+    // its whole ancestor chain (up to the nearest block).
+    while (true) {
+      nsIContent* current = mIterator.GetPrev();
+
+      if (!current) {
+        return;
+      }
+
+      if (SkipNode(current)) {
+        continue;
+      }
+
+      if (current->IsText()) {
+        return;
+      }
+    }
+  }
+
+  // Going forward the iterator visits every element before descending into
+  // it, so the ancestors of the current node have already been vetted (the
+  // starting node's ancestors by Initialize()).  Each node thus only needs
+  // to be checked by itself, and a skippable element prunes its entire
+  // subtree instead of every descendant re-walking the ancestor chain.
+  bool skipChildren = false;
   while (true) {
-    nsIContent* current =
-        mFindBackward ? mIterator.GetPrev() : mIterator.GetNext();
+    nsIContent* current = skipChildren ? mIterator.GetNextSkippingChildren()
+                                       : mIterator.GetNext();
 
     if (!current) {
       return;
     }
 
-    if (!current->IsContent() || SkipNode(current->AsContent())) {
+    skipChildren = SkipNodeIgnoringAncestors(current);
+    if (skipChildren) {
       continue;
     }
 
@@ -481,6 +481,153 @@ PRTime GetExpirationTimeFromChannel(nsIChannel* aChannel) {
   return expiration < 0 ? PR_Now() + MAX_FAVICON_EXPIRATION : expiration;
 }
 
+/**
+ * Paints a scaled-down version of the given surface on a aSize x aSize
+ * canvas and encodes the result as a png payload.
+ *
+ * @param aSurface
+ *        The image to be scaled down.
+ * @param aSize
+ *        Width and height of the target payload.
+ * @param _data
+ *        Out parameter, will contain the encoded data.
+ */
+nsresult ScaleAndEncodePNG(gfx::DataSourceSurface* aSurface, int32_t aSize,
+                           nsCString& _data) {
+  RefPtr<gfx::DataSourceSurface> targetDataSurface =
+      gfx::Factory::CreateDataSourceSurface(gfx::IntSize(aSize, aSize),
+                                            gfx::SurfaceFormat::B8G8R8A8, true);
+  NS_ENSURE_STATE(targetDataSurface);
+
+  {  // Block scope for map.
+    gfx::DataSourceSurface::MappedSurface map;
+    if (!targetDataSurface->Map(gfx::DataSourceSurface::MapType::WRITE, &map)) {
+      return NS_ERROR_FAILURE;
+    }
+
+    RefPtr<gfx::DrawTarget> dt = gfx::Factory::CreateDrawTargetForData(
+        gfx::BackendType::CAIRO, map.mData, targetDataSurface->GetSize(),
+        map.mStride, gfx::SurfaceFormat::B8G8R8A8);
+    NS_ENSURE_STATE(dt);
+
+    gfx::IntSize frameSize = aSurface->GetSize();
+    dt->DrawSurface(aSurface, gfx::Rect(0, 0, aSize, aSize),
+                    gfx::Rect(0, 0, frameSize.width, frameSize.height),
+                    gfx::DrawSurfaceOptions(),
+                    gfx::DrawOptions(1.0f, gfx::CompositionOp::OP_SOURCE));
+    targetDataSurface->Unmap();
+  }
+
+  nsCOMPtr<imgIEncoder> encoder =
+      do_CreateInstance("@mozilla.org/image/encoder;2?type=image/png");
+  NS_ENSURE_STATE(encoder);
+
+  gfx::DataSourceSurface::MappedSurface map;
+  if (!targetDataSurface->Map(gfx::DataSourceSurface::MapType::READ, &map)) {
+    return NS_ERROR_FAILURE;
+  }
+  nsresult rv = encoder->InitFromData(
+      map.mData, map.mStride * aSize, aSize, aSize, map.mStride,
+      imgIEncoder::INPUT_FORMAT_HOSTARGB, EmptyString());
+  targetDataSurface->Unmap();
+  NS_ENSURE_SUCCESS(rv, rv);
+
+  nsCOMPtr<nsIInputStream> iconStream = encoder;
+  NS_ENSURE_STATE(iconStream);
+  return NS_ConsumeStream(iconStream, UINT32_MAX, _data);
+}
+
+/**
+ * Optimizes the icon payload for storage: the image is decoded, downscaled
+ * to the closest supported size and re-encoded as png.  A payload that is
+ * still over the maximum allowed size afterwards is discarded.
+ * Contrary to nsFaviconService::OptimizeIconSizes this only uses imagelib
+ * APIs that are safe on any thread, so it can run on the async thread; on
+ * the other hand it cannot split multi-frame ico files into one payload per
+ * frame, thus those keep being handled on the main-thread.
+ *
+ * @param aIcon
+ *        The icon to be optimized.  Should have a single payload with
+ *        needsOptimize set; on failure the payloads array is emptied.
+ */
+void OptimizeIconPayloads(IconData& aIcon) {
+  MOZ_ASSERT(!NS_IsMainThread());
+  MOZ_ASSERT(aIcon.needsOptimize);
+  MOZ_ASSERT(aIcon.payloads.Length() == 1);
+
+  aIcon.needsOptimize = false;
+  IconPayload payload = aIcon.payloads[0];
+  aIcon.payloads.Clear();
+
+  if (payload.mimeType.EqualsLiteral(SVG_MIME_TYPE)) {
+    // Nothing to optimize, but check the payload size.
+    if (payload.data.Length() < nsIFaviconService::MAX_FAVICON_BUFFER_SIZE) {
+      aIcon.payloads.AppendElement(payload);
+    }
+    return;
+  }
+
+  // Decode the payload to a surface.
+  nsCOMPtr<nsIInputStream> stream;
+  nsresult rv = NS_NewByteInputStream(getter_AddRefs(stream), payload.data,
+                                      NS_ASSIGNMENT_DEPEND);
+  if (NS_WARN_IF(NS_FAILED(rv))) {
+    return;
+  }
+  RefPtr<gfx::SourceSurface> surface = image::ImageOps::DecodeToSurface(
+      stream.forget(), payload.mimeType, imgIContainer::DECODE_FLAGS_DEFAULT);
+  if (NS_WARN_IF(!surface)) {
+    return;
+  }
+  RefPtr<gfx::DataSourceSurface> dataSurface = surface->GetDataSurface();
+  if (NS_WARN_IF(!dataSurface)) {
+    return;
+  }
+
+  // For non-square images, pick the largest side.
+  int32_t originalSize =
+      std::max(dataSurface->GetSize().width, dataSurface->GetSize().height);
+
+  IconPayload newPayload;
+  newPayload.mimeType = NS_LITERAL_CSTRING(PNG_MIME_TYPE);
+  newPayload.width = originalSize;
+  for (uint16_t size : gFaviconSizes) {
+    // The icon could be smaller than 16, that is our minimum.
+    // Icons smaller than 16px are kept as-is.
+    if (originalSize >= 16) {
+      if (size > originalSize) {
+        continue;
+      }
+      newPayload.width = size;
+    }
+
+    // If the original payload is png and the size is the same, no reason to
+    // rescale the image.
+    if (newPayload.mimeType.Equals(payload.mimeType) &&
+        newPayload.width == originalSize &&
+        payload.data.Length() < nsIFaviconService::MAX_FAVICON_BUFFER_SIZE) {
+      newPayload.data = payload.data;
+    } else {
+      // Otherwise, scale and recompress.
+      newPayload.data.Truncate();
+      rv = ScaleAndEncodePNG(dataSurface, newPayload.width, newPayload.data);
+      if (NS_WARN_IF(NS_FAILED(rv))) {
+        return;
+      }
+    }
+
+    // If the icon size is good, we are done, otherwise try the next size.
+    if (newPayload.data.Length() < nsIFaviconService::MAX_FAVICON_BUFFER_SIZE ||
+        originalSize < 16) {
+      break;
+    }
+  }
+
+  if (newPayload.data.Length() < nsIFaviconService::MAX_FAVICON_BUFFER_SIZE) {
+    aIcon.payloads.AppendElement(newPayload);
+  }
+}
+
 }  // namespace
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -756,12 +903,21 @@ AsyncFetchAndSetIconForPage::OnStopRequest(nsIRequest* aRequest,
         mozilla::Telemetry::PLACES_FAVICON_OTHER_SIZES, payload.data.Length());
   }
 
-  rv = favicons->OptimizeIconSizes(mIcon);
-  NS_ENSURE_SUCCESS(rv, rv);
+  if (payload.mimeType.EqualsLiteral("image/x-icon") ||
+      payload.mimeType.EqualsLiteral("image/vnd.microsoft.icon")) {
+    // Multi-frame ico files are split into one payload per size, and that
+    // requires main-thread-only imagelib APIs.
+    rv = favicons->OptimizeIconSizes(mIcon);
+    NS_ENSURE_SUCCESS(rv, rv);
 
-  // If there's not valid payload, don't store the icon into to the database.
-  if (mIcon.payloads.Length() == 0) {
-    return NS_OK;
+    // If there's not valid payload, don't store the icon into to the database.
+    if (mIcon.payloads.Length() == 0) {
+      return NS_OK;
+    }
+  } else {
+    // Any other format is optimized on the async thread, just before storing
+    // it, to keep expensive image decoding off the main-thread.
+    mIcon.needsOptimize = true;
   }
 
   mIcon.status = ICON_STATUS_CHANGED;
@@ -796,6 +952,14 @@ AsyncAssociateIconToPage::Run() {
   MOZ_ASSERT(mPage.canAddToHistory || !mPage.bookmarkedSpec.IsEmpty(),
              "The page should be addable to history or a bookmark");
 
+  if (mIcon.needsOptimize) {
+    OptimizeIconPayloads(mIcon);
+    // If there's not valid payload, don't store the icon into to the database.
+    if (mIcon.payloads.Length() == 0) {
+      return NS_OK;
+    }
+  }
+
   bool shouldUpdateIcon = mIcon.status & ICON_STATUS_CHANGED;
   if (!shouldUpdateIcon) {
     for (const auto& payload : mIcon.payloads) {
@@ -1036,6 +1200,19 @@ NS_IMETHODIMP
 AsyncReplaceFaviconData::Run() {
   MOZ_ASSERT(!NS_IsMainThread());
 
+  if (mIcon.needsOptimize) {
+    OptimizeIconPayloads(mIcon);
+    if (mIcon.payloads.Length() == 0) {
+      // We cannot optimize this favicon size and we are over the maximum size
+      // allowed, so don't store it into the database to avoid bloating it,
+      // and drop the in-memory copy.
+      nsCOMPtr<nsIRunnable> event = NewRunnableMethod(
+          "places::AsyncReplaceFaviconData::RemoveIconDataCacheEntry", this,
+          &AsyncReplaceFaviconData::RemoveIconDataCacheEntry);
+      return NS_DispatchToMainThread(event);
+    }
+  }
+
   RefPtr<Database> DB = Database::GetDatabase();
   NS_ENSURE_STATE(DB);
 
@@ -78,7 +78,8 @@ struct IconData {
       : expiration(0),
         fetchMode(FETCH_NEVER),
         status(ICON_STATUS_UNKNOWN),
-        rootIcon(0) {}
+        rootIcon(0),
+        needsOptimize(false) {}
 
   nsCString spec;
   nsCString host;
@@ -86,6 +87,10 @@ struct IconData {
   enum AsyncFaviconFetchMode fetchMode;
   uint16_t status;  // This is a bitset, see ICON_STATUS_* defines above.
   uint8_t rootIcon;
+  // Whether the payloads still need to be optimized for storage.  That work
+  // happens on the async thread, just before storing them in the database,
+  // to keep expensive image decoding off the main-thread.
+  bool needsOptimize;
   nsTArray<IconPayload> payloads;
 };
 
@@ -368,15 +368,27 @@ nsDependentCSubstring MatchAutoCompleteFunction::fixupURISpec(
     const nsACString& aURISpec, int32_t aMatchBehavior, nsACString& aSpecBuf) {
   nsDependentCSubstring fixedSpec;
 
+  // The caller only ever searches through the first
+  // MAX_CHARS_TO_SEARCH_THROUGH characters of the fixed-up spec, so there's
+  // no point in unescaping and validating more of the input than can
+  // contribute to that window: the prefix that may be cut off below, plus a
+  // factor of three since unescaping can shrink three bytes to one.  This
+  // bounds the per-row work on the very long URLs (e.g. data: URIs) that can
+  // appear in history.
+  const size_type specLength =
+      std::min(aURISpec.Length(),
+               static_cast<size_type>(8 /* max cut prefix, "https://" */ +
+                                      MAX_CHARS_TO_SEARCH_THROUGH * 3));
+
   // Try to unescape the string.  If that succeeds and yields a different
   // string which is also valid UTF-8, we'll use it.
   // Otherwise, we will simply use our original string.
-  bool unescaped = NS_UnescapeURL(aURISpec.BeginReading(), aURISpec.Length(),
+  bool unescaped = NS_UnescapeURL(aURISpec.BeginReading(), specLength,
                                   esc_SkipControl, aSpecBuf);
   if (unescaped && IsUTF8(aSpecBuf)) {
     fixedSpec.Rebind(aSpecBuf, 0);
   } else {
-    fixedSpec.Rebind(aURISpec, 0);
+    fixedSpec.Rebind(aURISpec.BeginReading(), specLength);
   }
 
   if (aMatchBehavior == mozIPlacesAutoComplete::MATCH_ANYWHERE_UNMODIFIED)
@@ -616,29 +628,29 @@ CalculateFrecencyFunction::OnFunctionCall(mozIStorageValueArray* aArguments,
     // In case the visit is a redirect target, calculate the frecency
     // as if the original page was visited.
     // If it's a redirect source, we may want to use a lower bonus.
-    nsCString redirectsTransitionFragment = nsPrintfCString(
-        "%d AND %d ", nsINavHistoryService::TRANSITION_REDIRECT_PERMANENT,
-        nsINavHistoryService::TRANSITION_REDIRECT_TEMPORARY);
+    // The redirect transition values are baked into the query text so that
+    // it's a compile-time constant; bulk recalculation invokes this function
+    // once per page, and rebuilding the query each time just to look up the
+    // cached statement is wasted work.
+    static_assert(nsINavHistoryService::TRANSITION_REDIRECT_PERMANENT == 5 &&
+                      nsINavHistoryService::TRANSITION_REDIRECT_TEMPORARY == 6,
+                  "The transition values below must be updated");
     nsCOMPtr<mozIStorageStatement> getVisits = DB->GetStatement(
-        NS_LITERAL_CSTRING(
-            "/* do not warn (bug 659740 - SQLite may ignore index if few "
-            "visits exist) */"
-            "SELECT "
-            "IFNULL(origin.visit_type, v.visit_type) AS visit_type, "
-            "target.visit_type AS target_visit_type, "
-            "ROUND((strftime('%s','now','localtime','utc') - "
-            "v.visit_date/1000000)/86400) AS age_in_days "
-            "FROM moz_historyvisits v "
-            "LEFT JOIN moz_historyvisits origin ON origin.id = v.from_visit "
-            "AND v.visit_type BETWEEN ") +
-        redirectsTransitionFragment +
-        NS_LITERAL_CSTRING(
-            "LEFT JOIN moz_historyvisits target ON v.id = target.from_visit "
-            "AND target.visit_type BETWEEN ") +
-        redirectsTransitionFragment +
-        NS_LITERAL_CSTRING("WHERE v.place_id = :page_id "
-                           "ORDER BY v.visit_date DESC "
-                           "LIMIT :max_visits "));
+        "/* do not warn (bug 659740 - SQLite may ignore index if few "
+        "visits exist) */"
+        "SELECT "
+        "IFNULL(origin.visit_type, v.visit_type) AS visit_type, "
+        "target.visit_type AS target_visit_type, "
+        "ROUND((strftime('%s','now','localtime','utc') - "
+        "v.visit_date/1000000)/86400) AS age_in_days "
+        "FROM moz_historyvisits v "
+        "LEFT JOIN moz_historyvisits origin ON origin.id = v.from_visit "
+        "AND v.visit_type BETWEEN 5 AND 6 "
+        "LEFT JOIN moz_historyvisits target ON v.id = target.from_visit "
+        "AND target.visit_type BETWEEN 5 AND 6 "
+        "WHERE v.place_id = :page_id "
+        "ORDER BY v.visit_date DESC "
+        "LIMIT :max_visits ");
     NS_ENSURE_STATE(getVisits);
     mozStorageStatementScoper visitsScoper(getVisits);
     rv = getVisits->BindInt64ByName(NS_LITERAL_CSTRING("page_id"), pageId);
@@ -446,15 +446,25 @@ nsFaviconService::ReplaceFaviconData(nsIURI* aFaviconURI,
   iconData->payloads.Clear();
   iconData->payloads.AppendElement(payload);
 
-  rv = OptimizeIconSizes(*iconData);
-  NS_ENSURE_SUCCESS(rv, rv);
+  if (payload.mimeType.EqualsLiteral("image/x-icon") ||
+      payload.mimeType.EqualsLiteral("image/vnd.microsoft.icon")) {
+    // Multi-frame ico files are split into one payload per size, and that
+    // requires main-thread-only imagelib APIs.
+    rv = OptimizeIconSizes(*iconData);
+    NS_ENSURE_SUCCESS(rv, rv);
 
-  // If there's not valid payload, don't store the icon into to the database.
-  if ((*iconData).payloads.Length() == 0) {
-    // We cannot optimize this favicon size and we are over the maximum size
-    // allowed, so we will not save data to the db to avoid bloating it.
-    mUnassociatedIcons.RemoveEntry(aFaviconURI);
-    return NS_ERROR_FAILURE;
+    // If there's not valid payload, don't store the icon into to the database.
+    if ((*iconData).payloads.Length() == 0) {
+      // We cannot optimize this favicon size and we are over the maximum size
+      // allowed, so we will not save data to the db to avoid bloating it.
+      mUnassociatedIcons.RemoveEntry(aFaviconURI);
+      return NS_ERROR_FAILURE;
+    }
+  } else {
+    // Any other format is optimized on the async thread, just before storing
+    // it, to keep expensive image decoding off the main-thread.  An icon that
+    // cannot be optimized will be silently dropped at that point.
+    iconData->needsOptimize = true;
   }
 
   // If the database contains an icon at the given url, we will update the
@@ -680,13 +690,16 @@ nsresult nsFaviconService::GetFaviconLinkForIconString(const nsCString& aSpec,
 }
 
 /**
- * Checks the icon and evaluates if it needs to be optimized.
+ * Checks the icon and evaluates if it needs to be optimized.  This must run
+ * on the main-thread because it may split multi-frame ico files into one
+ * payload per frame, and that requires main-thread-only imagelib APIs.
+ * Other formats are optimized on the async thread, see OptimizeIconPayloads
+ * in FaviconHelpers.cpp.
  *
  * @param aIcon
  *        The icon to be evaluated.
  */
 nsresult nsFaviconService::OptimizeIconSizes(IconData& aIcon) {
-  // TODO (bug 1346139): move optimization to the async thread.
   MOZ_ASSERT(NS_IsMainThread());
   // There should only be a single payload at this point, it may have to be
   // split though, if it's an ico file.
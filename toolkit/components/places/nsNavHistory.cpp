@@ -260,16 +260,13 @@ class FixAndDecayFrecencyRunnable final : public Runnable {
     nsresult rv = updateStmt->Execute();
     NS_ENSURE_SUCCESS(rv, rv);
 
-    nsCOMPtr<mozIStorageStatement> selectStmt = mDB->GetStatement(
-        "SELECT id FROM moz_places WHERE frecency < 0 "
-        "LIMIT 1");
-    NS_ENSURE_STATE(selectStmt);
-    bool hasResult = false;
-    rv = selectStmt->ExecuteStep(&hasResult);
+    int32_t affectedRowCount = 0;
+    rv = mDB->MainConn()->GetAffectedRows(&affectedRowCount);
     NS_ENSURE_SUCCESS(rv, rv);
-    if (hasResult) {
-      // There are more invalid frecencies to fix. Re-dispatch to the async
-      // storage thread for the next chunk.
+    if (affectedRowCount > 0) {
+      // There may be more invalid frecencies to fix. Re-dispatch to the async
+      // storage thread for the next chunk; the final chunk updates nothing
+      // and falls through.
       return NS_DispatchToCurrentThread(this);
     }
 
@@ -6,11 +6,10 @@
 #include "mozilla/dom/Document.h"
 #include "mozilla/dom/SessionStoreListener.h"
 #include "mozilla/dom/BrowserChild.h"
+#include "mozilla/Preferences.h"
 #include "nsIBrowser.h"
 #include "nsIDocShell.h"
 #include "nsIDocShellTreeOwner.h"
-#include "nsIPrefService.h"
-#include "nsIPrefBranch.h"
 #include "nsITimer.h"
 #include "nsIXULBrowserWindow.h"
 #include "nsIXULWindow.h"
@@ -28,6 +27,13 @@ static const char kTimeOutDisable[] =
 // Timeout for waiting an idle period to send data.
 static const char kPrefInterval[] = "browser.sessionstore.interval";
 
+// The prefs are var-cached once and shared by all tabs, rather than tracked
+// with a pref observer per TabListener, so pref changes don't fan out to
+// every tab.
+static bool sPrefsInitialized = false;
+static bool sTimeoutDisabled = false;
+static int32_t sUpdateInterval = 15000;
+
 NS_IMPL_CYCLE_COLLECTION(ContentSessionStore, mDocShell)
 NS_IMPL_CYCLE_COLLECTION_ROOT_NATIVE(ContentSessionStore, AddRef)
 NS_IMPL_CYCLE_COLLECTION_UNROOT_NATIVE(ContentSessionStore, Release)
@@ -107,7 +113,6 @@ void ContentSessionStore::OnDocumentEnd() { mScrollChanged = WITH_CHANGE; }
 
 NS_INTERFACE_MAP_BEGIN_CYCLE_COLLECTION(TabListener)
   NS_INTERFACE_MAP_ENTRY(nsIDOMEventListener)
-  NS_INTERFACE_MAP_ENTRY(nsIObserver)
   NS_INTERFACE_MAP_ENTRY(nsIPrivacyTransitionObserver)
   NS_INTERFACE_MAP_ENTRY(nsIWebProgressListener)
   NS_INTERFACE_MAP_ENTRY(nsISupportsWeakReference)
@@ -124,10 +129,7 @@ TabListener::TabListener(nsIDocShell* aDocShell, Element* aElement)
       mOwnerContent(aElement),
       mProgressListenerRegistered(false),
       mEventListenerRegistered(false),
-      mPrefObserverRegistered(false),
-      mUpdatedTimer(nullptr),
-      mTimeoutDisabled(false),
-      mUpdateInterval(15000) {
+      mUpdatedTimer(nullptr) {
   MOZ_ASSERT(mDocShell);
 }
 
@@ -142,12 +144,10 @@ nsresult TabListener::Init() {
   NS_ENSURE_SUCCESS(rv, rv);
   mProgressListenerRegistered = true;
 
-  nsCOMPtr<nsIPrefBranch> prefBranch = do_GetService(NS_PREFSERVICE_CONTRACTID);
-  NS_WARNING_ASSERTION(prefBranch, "no prefservice");
-  if (prefBranch) {
-    prefBranch->AddObserver(kTimeOutDisable, this, true);
-    prefBranch->AddObserver(kPrefInterval, this, true);
-    mPrefObserverRegistered = true;
+  if (!sPrefsInitialized) {
+    Preferences::AddBoolVarCache(&sTimeoutDisabled, kTimeOutDisable, false);
+    Preferences::AddIntVarCache(&sUpdateInterval, kPrefInterval, 15000);
+    sPrefsInitialized = true;
   }
 
   nsCOMPtr<EventTarget> eventTarget = nullptr;
@@ -188,13 +188,13 @@ void TabListener::AddTimerForUpdate() {
     return;
   }
 
-  if (mTimeoutDisabled) {
+  if (sTimeoutDisabled) {
     UpdateSessionStore();
     return;
   }
 
   NS_NewTimerWithFuncCallback(getter_AddRefs(mUpdatedTimer), TimerCallback,
-                              this, mUpdateInterval, nsITimer::TYPE_ONE_SHOT,
+                              this, sUpdateInterval, nsITimer::TYPE_ONE_SHOT,
                               "TabListener::TimerCallback");
 }
 
@@ -319,39 +319,6 @@ NS_IMETHODIMP TabListener::OnContentBlockingEvent(nsIWebProgress* aWebProgress,
   return NS_ERROR_NOT_IMPLEMENTED;
 }
 
-nsresult TabListener::Observe(nsISupports* aSubject, const char* aTopic,
-                              const char16_t* aData) {
-  MOZ_ASSERT(!strcmp(aTopic, NS_PREFBRANCH_PREFCHANGE_TOPIC_ID),
-             "unexpected topic!");
-
-  nsCOMPtr<nsIPrefBranch> prefBranch = do_QueryInterface(aSubject);
-
-  bool timeoutDisabled;
-  if (NS_SUCCEEDED(
-          prefBranch->GetBoolPref(kTimeOutDisable, &timeoutDisabled))) {
-    if (mTimeoutDisabled != timeoutDisabled) {
-      mTimeoutDisabled = timeoutDisabled;
-      if (mUpdatedTimer) {
-        StopTimerForUpdate();
-        AddTimerForUpdate();
-      }
-    }
-  }
-
-  int32_t interval = 0;
-  if (NS_SUCCEEDED(prefBranch->GetIntPref(kPrefInterval, &interval))) {
-    if (mUpdateInterval != interval) {
-      mUpdateInterval = interval;
-      if (mUpdatedTimer) {
-        StopTimerForUpdate();
-        AddTimerForUpdate();
-      }
-    }
-  }
-
-  return NS_OK;
-}
-
 nsCString CollectPosition(Document& aDocument) {
   PresShell* presShell = aDocument.GetPresShell();
   if (!presShell) {
@@ -443,7 +410,6 @@ bool TabListener::UpdateSessionStore(uint32_t aFlushId, bool aIsFinal) {
     return false;
   }
 
-  uint32_t chromeFlags = 0;
   nsCOMPtr<nsIDocShellTreeOwner> treeOwner;
   mDocShell->GetTreeOwner(getter_AddRefs(treeOwner));
   if (!treeOwner) {
@@ -453,9 +419,6 @@ bool TabListener::UpdateSessionStore(uint32_t aFlushId, bool aIsFinal) {
   if (!window) {
     return false;
   }
-  if (window && NS_FAILED(window->GetChromeFlags(&chromeFlags))) {
-    return false;
-  }
 
   nsCOMPtr<nsIXULBrowserWindow> xulBrowserWindow;
   window->GetXULBrowserWindow(getter_AddRefs(xulBrowserWindow));
@@ -506,15 +469,6 @@ void TabListener::RemoveListeners() {
       mEventListenerRegistered = false;
     }
   }
-
-  if (mPrefObserverRegistered) {
-    nsCOMPtr<nsIObserverService> obs = mozilla::services::GetObserverService();
-    if (obs) {
-      obs->RemoveObserver(this, kTimeOutDisable);
-      obs->RemoveObserver(this, kPrefInterval);
-      mPrefObserverRegistered = false;
-    }
-  }
 }
 
 TabListener::~TabListener() { RemoveListeners(); }
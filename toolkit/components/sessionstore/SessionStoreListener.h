@@ -54,7 +54,6 @@ class ContentSessionStore {
 };
 
 class TabListener : public nsIDOMEventListener,
-                    public nsIObserver,
                     public nsIPrivacyTransitionObserver,
                     public nsIWebProgressListener,
                     public nsSupportsWeakReference {
@@ -70,7 +69,6 @@ class TabListener : public nsIDOMEventListener,
   NS_DECL_CYCLE_COLLECTION_CLASS_AMBIGUOUS(TabListener, nsIDOMEventListener)
 
   NS_DECL_NSIDOMEVENTLISTENER
-  NS_DECL_NSIOBSERVER
   NS_DECL_NSIPRIVACYTRANSITIONOBSERVER
   NS_DECL_NSIWEBPROGRESSLISTENER
 
@@ -86,11 +84,8 @@ class TabListener : public nsIDOMEventListener,
   RefPtr<mozilla::dom::Element> mOwnerContent;
   bool mProgressListenerRegistered;
   bool mEventListenerRegistered;
-  bool mPrefObserverRegistered;
   // Timer used to update data
   nsCOMPtr<nsITimer> mUpdatedTimer;
-  bool mTimeoutDisabled;
-  int32_t mUpdateInterval;
 };
 
 }  // namespace dom
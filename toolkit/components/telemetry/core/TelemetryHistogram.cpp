@@ -284,9 +284,11 @@ namespace {
 bool gInitDone = false;
 
 // Whether we are collecting the base, opt-out, Histogram data.
-bool gCanRecordBase = false;
+// Atomic, as it is read on accumulation fast paths that don't take
+// |gTelemetryHistogramMutex|.
+mozilla::Atomic<bool, mozilla::Relaxed> gCanRecordBase(false);
 // Whether we are collecting the extended, opt-in, Histogram data.
-bool gCanRecordExtended = false;
+mozilla::Atomic<bool, mozilla::Relaxed> gCanRecordExtended(false);
 
 // The storage for actual Histogram instances.
 // We use separate ones for plain and keyed histograms.
@@ -2543,6 +2545,20 @@ void TelemetryHistogram::Accumulate(HistogramID aID, uint32_t aSample) {
     return;
   }
 
+  if (!internal_CanRecordBase()) {
+    return;
+  }
+
+  // In child processes the sample is only buffered through
+  // TelemetryIPCAccumulator, which has its own lock, so there is no need to
+  // contend on |gTelemetryHistogramMutex| for high-frequency probes here.
+  if (!XRE_IsParentProcess()) {
+    if (internal_IsRecordingEnabled(aID)) {
+      TelemetryIPCAccumulator::AccumulateChildHistogram(aID, aSample);
+    }
+    return;
+  }
+
   StaticMutexAutoLock locker(gTelemetryHistogramMutex);
   internal_Accumulate(locker, aID, aSample);
 }
@@ -2557,6 +2573,21 @@ void TelemetryHistogram::Accumulate(HistogramID aID,
   MOZ_ASSERT(!gHistogramInfos[aID].keyed,
              "Cannot accumulate into a keyed histogram. No key given.");
 
+  if (!internal_CanRecordBase()) {
+    return;
+  }
+
+  // See the single-sample overload: child-process samples go through the
+  // IPC accumulator's own lock.
+  if (!XRE_IsParentProcess()) {
+    if (internal_IsRecordingEnabled(aID)) {
+      for (uint32_t sample : aSamples) {
+        TelemetryIPCAccumulator::AccumulateChildHistogram(aID, sample);
+      }
+    }
+    return;
+  }
+
   StaticMutexAutoLock locker(gTelemetryHistogramMutex);
   for (uint32_t sample : aSamples) {
     internal_Accumulate(locker, aID, sample);
@@ -2582,6 +2613,20 @@ void TelemetryHistogram::Accumulate(HistogramID aID, const nsCString& aKey,
     return;
   }
 
+  if (!gInitDone || !internal_CanRecordBase()) {
+    return;
+  }
+
+  // See the plain overload: child-process samples go through the IPC
+  // accumulator's own lock.
+  if (!XRE_IsParentProcess()) {
+    if (internal_IsRecordingEnabled(aID)) {
+      TelemetryIPCAccumulator::AccumulateChildKeyedHistogram(aID, aKey,
+                                                             aSample);
+    }
+    return;
+  }
+
   StaticMutexAutoLock locker(gTelemetryHistogramMutex);
   internal_Accumulate(locker, aID, aKey, aSample);
 }
@@ -2609,6 +2654,22 @@ void TelemetryHistogram::Accumulate(HistogramID aID, const nsCString& aKey,
     return;
   }
 
+  if (!gInitDone || !internal_CanRecordBase()) {
+    return;
+  }
+
+  // See the plain overload: child-process samples go through the IPC
+  // accumulator's own lock.
+  if (!XRE_IsParentProcess()) {
+    if (internal_IsRecordingEnabled(aID)) {
+      for (uint32_t sample : aSamples) {
+        TelemetryIPCAccumulator::AccumulateChildKeyedHistogram(aID, aKey,
+                                                               sample);
+      }
+    }
+    return;
+  }
+
   StaticMutexAutoLock locker(gTelemetryHistogramMutex);
   for (uint32_t sample : aSamples) {
     internal_Accumulate(locker, aID, aKey, sample);
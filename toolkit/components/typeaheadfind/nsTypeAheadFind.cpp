@@ -54,6 +54,7 @@
 #include "mozilla/dom/RangeBinding.h"
 #include "mozilla/dom/Selection.h"
 #include "nsRange.h"
+#include "nsLayoutUtils.h"
 #include "nsXBLBinding.h"
 
 #include "nsTypeAheadFind.h"
@@ -1119,6 +1120,15 @@ nsTypeAheadFind::GetFoundRange(nsRange** aFoundRange) {
   return NS_OK;
 }
 
+// Collects the client rects of a range in app units, relative to the
+// containing block for client rects.
+struct MOZ_STACK_CLASS RangeRectCollector final
+    : public nsLayoutUtils::RectCallback {
+  AutoTArray<nsRect, 8> mRects;
+
+  void AddRect(const nsRect& aRect) override { mRects.AppendElement(aRect); }
+};
+
 NS_IMETHODIMP
 nsTypeAheadFind::IsRangeVisible(nsRange* aRange, bool aMustBeInViewPort,
                                 bool* aResult) {
@@ -1212,14 +1222,16 @@ bool nsTypeAheadFind::IsRangeVisible(PresShell* aPresShell,
 
       nsIFrame* containerFrame =
           nsLayoutUtils::GetContainingBlockForClientRect(frame);
-      RefPtr<DOMRectList> rects = aRange->GetClientRects(true, true);
-      for (uint32_t i = 0; i < rects->Length(); ++i) {
-        RefPtr<DOMRect> rect = rects->Item(i);
-        nsRect r(nsPresContext::CSSPixelsToAppUnits((float)rect->X()),
-                 nsPresContext::CSSPixelsToAppUnits((float)rect->Y()),
-                 nsPresContext::CSSPixelsToAppUnits((float)rect->Width()),
-                 nsPresContext::CSSPixelsToAppUnits((float)rect->Height()));
-
+      // Collect the range rects in app units directly; going through
+      // GetClientRects() would create a DOMRect object per rect and
+      // round-trip the coordinates through CSS pixels, which matters when
+      // this runs for every candidate range of a find operation.
+      RangeRectCollector rects;
+      nsRange::CollectClientRectsAndText(
+          &rects, nullptr, aRange, aRange->GetStartContainer(),
+          aRange->StartOffset(), aRange->GetEndContainer(), aRange->EndOffset(),
+          true, true);
+      for (nsRect r : rects.mRects) {
         // r is relative to containerFrame; transform it back to frame, so we
         // can do a proper visibility check that is cropped to all of frame's
         // ancestor scroll frames.
@@ -1344,14 +1356,14 @@ bool nsTypeAheadFind::IsRangeRendered(PresShell* aPresShell,
   // viewport. Do a hit-test to determine that quickly and properly.
   AutoTArray<nsIFrame*, 8> frames;
   nsIFrame* rootFrame = aPresShell->GetRootFrame();
-  RefPtr<nsRange> range = static_cast<nsRange*>(aRange);
-  RefPtr<mozilla::dom::DOMRectList> rects = range->GetClientRects(true, true);
-  for (uint32_t i = 0; i < rects->Length(); ++i) {
-    RefPtr<mozilla::dom::DOMRect> rect = rects->Item(i);
-    nsRect r(nsPresContext::CSSPixelsToAppUnits((float)rect->X()),
-             nsPresContext::CSSPixelsToAppUnits((float)rect->Y()),
-             nsPresContext::CSSPixelsToAppUnits((float)rect->Width()),
-             nsPresContext::CSSPixelsToAppUnits((float)rect->Height()));
+  // As in IsRangeVisible(), collect the rects in app units rather than
+  // materializing a DOMRectList.
+  RangeRectCollector rects;
+  nsRange::CollectClientRectsAndText(
+      &rects, nullptr, aRange, aRange->GetStartContainer(),
+      aRange->StartOffset(), aRange->GetEndContainer(), aRange->EndOffset(),
+      true, true);
+  for (const nsRect& r : rects.mRects) {
     // Append visible frames to frames array.
     nsLayoutUtils::GetFramesForArea(
         rootFrame, r, frames,
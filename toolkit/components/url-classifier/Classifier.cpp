@@ -406,10 +406,12 @@ void Classifier::TableRequest(nsACString& aResult) {
 }
 
 nsresult Classifier::CheckURIFragments(
-    const nsTArray<nsCString>& aSpecFragments, const nsACString& aTable,
+    const nsTArray<nsCString>& aSpecFragments,
+    const nsTArray<Completion>& aSpecHashes, const nsACString& aTable,
     LookupResultArray& aResults) {
   // A URL can form up to 30 different fragments
   MOZ_ASSERT(aSpecFragments.Length() != 0);
+  MOZ_ASSERT(aSpecFragments.Length() == aSpecHashes.Length());
   MOZ_ASSERT(aSpecFragments.Length() <=
              (MAX_HOST_COMPONENTS * (MAX_PATH_COMPONENTS + 2)));
 
@@ -431,8 +433,7 @@ nsresult Classifier::CheckURIFragments(
 
   // Now check each lookup fragment against the entries in the DB.
   for (uint32_t i = 0; i < aSpecFragments.Length(); i++) {
-    Completion lookupHash;
-    lookupHash.FromPlaintext(aSpecFragments[i]);
+    const Completion& lookupHash = aSpecHashes[i];
 
     bool has, confirmed;
     uint32_t matchLength;
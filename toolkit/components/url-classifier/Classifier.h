@@ -59,8 +59,11 @@ class Classifier {
   /**
    * Check URL fragments against a specified table.
    * The fragments should be generated by |LookupCache::GetLookupFragments|
+   * and the matching hashes by |LookupCache::HashFragments|, so that the
+   * hashing is done once per URL rather than once per table.
    */
   nsresult CheckURIFragments(const nsTArray<nsCString>& aSpecFragments,
+                             const nsTArray<Completion>& aSpecHashes,
                              const nsACString& table,
                              LookupResultArray& aResults);
 
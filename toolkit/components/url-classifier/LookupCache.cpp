@@ -305,7 +305,7 @@ nsresult LookupCache::GetLookupFragments(const nsACString& aSpec,
    *    successivly removing the leading component.  The top-level component
    *    can be skipped. This is not done if the hostname is a numerical IP.
    */
-  nsTArray<nsCString> hosts;
+  AutoTArray<nsCString, MAX_HOST_COMPONENTS> hosts;
   hosts.AppendElement(host);
 
   if (!IsCanonicalizedIP(host)) {
@@ -336,7 +336,7 @@ nsresult LookupCache::GetLookupFragments(const nsACString& aSpec,
    *    path component, that is, a trailing slash should never be
    *    appended that was not present in the original url.
    */
-  nsTArray<nsCString> paths;
+  AutoTArray<nsCString, MAX_PATH_COMPONENTS + 2> paths;
   nsAutoCString pathToAdd;
 
   path.BeginReading(begin);
@@ -365,20 +365,38 @@ nsresult LookupCache::GetLookupFragments(const nsACString& aSpec,
   // Check an empty path (for whole-domain blacklist entries)
   paths.AppendElement(EmptyCString());
 
+  aFragments->SetCapacity(hosts.Length() * paths.Length());
   for (uint32_t hostIndex = 0; hostIndex < hosts.Length(); hostIndex++) {
     for (uint32_t pathIndex = 0; pathIndex < paths.Length(); pathIndex++) {
       nsCString key;
+      // Allocate the concatenation in one go; these keys are generated for
+      // every classified URL, so the extra growth reallocations add up.
+      key.SetCapacity(hosts[hostIndex].Length() + 1 +
+                      paths[pathIndex].Length());
       key.Assign(hosts[hostIndex]);
       key.Append('/');
       key.Append(paths[pathIndex]);
 
-      aFragments->AppendElement(key);
+      aFragments->AppendElement(std::move(key));
     }
   }
 
   return NS_OK;
 }
 
+/* static */
+nsresult LookupCache::HashFragments(const nsTArray<nsCString>& aFragments,
+                                    nsTArray<Completion>* aHashes) {
+  aHashes->SetCapacity(aFragments.Length());
+  for (const nsCString& fragment : aFragments) {
+    Completion hash;
+    nsresult rv = hash.FromPlaintext(fragment);
+    NS_ENSURE_SUCCESS(rv, rv);
+    aHashes->AppendElement(hash);
+  }
+  return NS_OK;
+}
+
 /* static */
 nsresult LookupCache::GetHostKeys(const nsACString& aSpec,
                                   nsTArray<nsCString>* aHostKeys) {
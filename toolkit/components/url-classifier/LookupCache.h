@@ -182,6 +182,11 @@ class LookupCache {
   // entry
   static nsresult GetLookupFragments(const nsACString& aSpec,
                                      nsTArray<nsCString>* aFragments);
+  // hash the fragments from GetLookupFragments() into Completions. The same
+  // fragment set gets checked against every active table, so callers should
+  // hash once per URL and reuse the result across tables.
+  static nsresult HashFragments(const nsTArray<nsCString>& aFragments,
+                                nsTArray<Completion>* aHashes);
   // Similar to GetKey(), but if the domain contains three or more components,
   // two keys will be returned:
   //  hostname.com/foo/bar -> [hostname.com]
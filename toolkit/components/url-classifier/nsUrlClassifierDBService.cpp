@@ -170,9 +170,15 @@ class nsUrlClassifierDBService::FeatureHolder final {
     nsresult rv = LookupCache::GetLookupFragments(aSpec, &fragments);
     NS_ENSURE_SUCCESS(rv, rv);
 
+    // Hash the fragments once up front; the hashes are the same for every
+    // table we check below.
+    nsTArray<Completion> fragmentHashes;
+    rv = LookupCache::HashFragments(fragments, &fragmentHashes);
+    NS_ENSURE_SUCCESS(rv, rv);
+
     for (TableData* tableData : mTableData) {
       rv = aWorker->DoSingleLocalLookupWithURIFragments(
-          fragments, tableData->mTable, tableData->mResults);
+          fragments, fragmentHashes, tableData->mTable, tableData->mResults);
       if (NS_WARN_IF(NS_FAILED(rv))) {
         return rv;
       }
@@ -334,7 +340,8 @@ nsresult nsUrlClassifierDBServiceWorker::QueueLookup(
 }
 
 nsresult nsUrlClassifierDBServiceWorker::DoSingleLocalLookupWithURIFragments(
-    const nsTArray<nsCString>& aSpecFragments, const nsACString& aTable,
+    const nsTArray<nsCString>& aSpecFragments,
+    const nsTArray<Completion>& aSpecHashes, const nsACString& aTable,
     LookupResultArray& aResults) {
   if (gShuttingDownThread) {
     return NS_ERROR_ABORT;
@@ -349,8 +356,8 @@ nsresult nsUrlClassifierDBServiceWorker::DoSingleLocalLookupWithURIFragments(
     return NS_ERROR_NOT_AVAILABLE;
   }
 
-  nsresult rv =
-      mClassifier->CheckURIFragments(aSpecFragments, aTable, aResults);
+  nsresult rv = mClassifier->CheckURIFragments(aSpecFragments, aSpecHashes,
+                                               aTable, aResults);
   if (NS_WARN_IF(NS_FAILED(rv))) {
     return rv;
   }
@@ -173,11 +173,13 @@ class nsUrlClassifierDBServiceWorker final : public nsIUrlClassifierDBService {
   // update operations to prevent lookups from blocking for too long.
   nsresult HandlePendingLookups();
 
-  // Perform a blocking classifier lookup for a given url fragments set.
+  // Perform a blocking classifier lookup for a given url fragments set and
+  // the corresponding fragment hashes.
   // Can be called on either the main thread or the worker thread.
   nsresult DoSingleLocalLookupWithURIFragments(
-      const nsTArray<nsCString>& aSpecFragments, const nsACString& aTable,
-      LookupResultArray& aResults);
+      const nsTArray<nsCString>& aSpecFragments,
+      const nsTArray<mozilla::safebrowsing::Completion>& aSpecHashes,
+      const nsACString& aTable, LookupResultArray& aResults);
 
   // Open the DB connection
   nsresult GCC_MANGLING_WORKAROUND OpenDb();
@@ -24,6 +24,9 @@ ProfileBuffer::ProfileBuffer(uint32_t aCapacity)
                      "aCapacity is larger than what we support");
   mCapacity = RoundUpPow2(aCapacity);
   mEntryIndexMask = mCapacity - 1;
+  // The entries are left uninitialized on purpose (see the default
+  // ProfileBufferEntry constructor), so the OS only commits the buffer's
+  // pages as the buffer actually fills up.
   mEntries = MakeUnique<ProfileBufferEntry[]>(mCapacity);
 }
 
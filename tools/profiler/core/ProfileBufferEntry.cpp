@@ -25,9 +25,6 @@ using namespace mozilla;
 ////////////////////////////////////////////////////////////////////////
 // BEGIN ProfileBufferEntry
 
-ProfileBufferEntry::ProfileBufferEntry()
-    : mKind(Kind::INVALID), mStorage{0, 0, 0, 0, 0, 0, 0, 0} {}
-
 // aString must be a static string.
 ProfileBufferEntry::ProfileBufferEntry(Kind aKind, const char* aString)
     : mKind(aKind) {
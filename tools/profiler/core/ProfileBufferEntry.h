@@ -61,7 +61,13 @@ class ProfileBufferEntry {
         LIMIT
   };
 
-  ProfileBufferEntry();
+  // Intentionally a user-provided constructor that leaves the entry
+  // uninitialized (and not `= default`, which would make value-initializing
+  // ProfileBuffer's big entry array zero-fill it). Initializing the entries
+  // would commit all of the buffer's pages up front -- tens of megabytes
+  // with startup profiling -- even though the buffer fills gradually, and
+  // entries are always written via AddEntry() before they can be read.
+  ProfileBufferEntry() {}
 
   // This is equal to sizeof(double), which is the largest non-char variant in
   // |u|.
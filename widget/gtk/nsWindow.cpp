@@ -13,6 +13,7 @@
 #include "mozilla/MouseEvents.h"
 #include "mozilla/PresShell.h"
 #include "mozilla/RefPtr.h"
+#include "mozilla/StaticPrefs.h"
 #include "mozilla/TextEvents.h"
 #include "mozilla/TimeStamp.h"
 #include "mozilla/TouchEvents.h"
@@ -2587,6 +2588,10 @@ void nsWindow::OnMotionNotifyEvent(GdkEventMotion* aEvent) {
   bool synthEvent = false;
 #ifdef MOZ_X11
   XEvent xevent;
+  // Motion events overtaken by the compression loop below, oldest first.
+  // They are kept so that the coalesced samples can be attached to the
+  // dispatched event rather than dropped outright.
+  AutoTArray<XEvent, 8> overtakenEvents;
 
   if (mIsX11Display) {
     while (XPending(GDK_WINDOW_XDISPLAY(aEvent->window))) {
@@ -2596,6 +2601,9 @@ void nsWindow::OnMotionNotifyEvent(GdkEventMotion* aEvent) {
           peeked.type != MotionNotify)
         break;
 
+      if (synthEvent) {
+        overtakenEvents.AppendElement(xevent);
+      }
       synthEvent = true;
       XNextEvent(GDK_WINDOW_XDISPLAY(aEvent->window), &xevent);
     }
@@ -2637,6 +2645,33 @@ void nsWindow::OnMotionNotifyEvent(GdkEventMotion* aEvent) {
 
   KeymapWrapper::InitInputEvent(event, modifierState);
 
+#ifdef MOZ_X11
+  // When the compression loop ate older motion events, attach them (oldest
+  // first, ending with the dispatched sample itself) as the coalesced-sample
+  // list, the same shape CoalescedMouseData produces for e10s, so that
+  // PointerEvent::getCoalescedEvents still sees the full-rate history.
+  if (synthEvent && StaticPrefs::dom_w3c_pointer_events_enabled()) {
+    RefPtr<WidgetPointerEventHolder> holder = new WidgetPointerEventHolder();
+    // The motion event that triggered the compression is the oldest sample.
+    WidgetPointerEvent* sample = holder->mEvents.AppendElement(event);
+    sample->mRefPoint = GetRefPoint(this, aEvent);
+    sample->AssignEventTime(GetWidgetEventTime(aEvent->time));
+    for (const XEvent& overtaken : overtakenEvents) {
+      sample = holder->mEvents.AppendElement(event);
+      sample->mRefPoint.x = nscoord(overtaken.xmotion.x);
+      sample->mRefPoint.y = nscoord(overtaken.xmotion.y);
+      sample->AssignEventTime(GetWidgetEventTime(overtaken.xmotion.time));
+    }
+    // The dispatched event is the newest sample in its own history.
+    holder->mEvents.AppendElement(event);
+    for (WidgetPointerEvent& coalesced : holder->mEvents) {
+      coalesced.mFlags.mBubbles = false;
+      coalesced.mFlags.mCancelable = false;
+    }
+    event.mCoalescedWidgetEvents = holder;
+  }
+#endif /* MOZ_X11 */
+
   DispatchInputEvent(&event);
 }
 
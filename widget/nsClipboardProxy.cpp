@@ -70,7 +70,19 @@ nsClipboardProxy::GetData(nsITransferable* aTransferable,
       // If this is an image, convert it into an nsIInputStream.
       const nsCString& flavor = item.flavor();
       mozilla::ipc::Shmem data = item.data().get_Shmem();
-      if (flavor.EqualsLiteral(kJPEGImageMime) ||
+      if (item.shmemIsUTF16()) {
+        // A large string sent out-of-line.
+        nsCOMPtr<nsISupportsString> dataWrapper =
+            do_CreateInstance(NS_SUPPORTS_STRING_CONTRACTID, &rv);
+        NS_ENSURE_SUCCESS(rv, rv);
+
+        rv = dataWrapper->SetData(
+            nsDependentSubstring(data.get<char16_t>(), data.Size<char16_t>()));
+        NS_ENSURE_SUCCESS(rv, rv);
+
+        rv = aTransferable->SetTransferData(flavor.get(), dataWrapper);
+        NS_ENSURE_SUCCESS(rv, rv);
+      } else if (flavor.EqualsLiteral(kJPEGImageMime) ||
           flavor.EqualsLiteral(kJPGImageMime) ||
           flavor.EqualsLiteral(kPNGImageMime) ||
           flavor.EqualsLiteral(kGIFImageMime)) {
@@ -228,11 +228,6 @@ class PromiseJobRunnable final : public MicroTaskRunnable {
     nsIGlobalObject* global = callback ? xpc::NativeGlobal(callback) : nullptr;
     if (global && !global->IsDying()) {
       // Propagate the user input event handling bit if needed.
-      nsCOMPtr<nsPIDOMWindowInner> win = do_QueryInterface(global);
-      RefPtr<Document> doc;
-      if (win) {
-        doc = win->GetExtantDoc();
-      }
       AutoHandlingUserInputStatePusher userInpStatePusher(
           mPropagateUserInputEventHandling);
 
@@ -783,19 +783,38 @@ struct CCGraph {
 
   static const uint32_t kInitialMapLength = 16384;
 
+  // The size of mPtrInfoMap at the end of the previous collection, used to
+  // pre-size the map for the next one.
+  uint32_t mLastMapCount;
+
  public:
   CCGraph()
-      : mRootCount(0), mPtrInfoMap(kInitialMapLength), mOutOfMemory(false) {}
+      : mRootCount(0),
+        mPtrInfoMap(kInitialMapLength),
+        mOutOfMemory(false),
+        mLastMapCount(0) {}
 
   ~CCGraph() {}
 
-  void Init() { MOZ_ASSERT(IsEmpty(), "Failed to call CCGraph::Clear"); }
+  void Init() {
+    MOZ_ASSERT(IsEmpty(), "Failed to call CCGraph::Clear");
+
+    // Consecutive collections tend to produce similarly sized graphs, and
+    // graphs can easily contain hundreds of thousands of nodes, so reserve
+    // the previous collection's node count up front rather than rehashing
+    // the map over and over as the graph is rebuilt from scratch.  If the
+    // reservation fails we simply detect OOM later, when adding nodes.
+    if (mLastMapCount > kInitialMapLength) {
+      Unused << mPtrInfoMap.reserve(mLastMapCount);
+    }
+  }
 
   void Clear() {
     mNodes.Clear();
     mEdges.Clear();
     mWeakMaps.Clear();
     mRootCount = 0;
+    mLastMapCount = mPtrInfoMap.count();
     mPtrInfoMap.clearAndCompact();
     mOutOfMemory = false;
   }
@@ -2559,10 +2578,17 @@ class RemoveSkippableVisitor : public SnowWhiteKiller {
       }
       return true;
     }
+    if (!aEntry->mRefCnt->IsPurple()) {
+      // The object has been AddRef'd since it was added to the buffer, so it
+      // can be removed without the expense of resolving its canonical
+      // participant.
+      aBuffer.Remove(aEntry);
+      return true;
+    }
     void* o = aEntry->mObject;
     nsCycleCollectionParticipant* cp = aEntry->mParticipant;
     ToParticipant(o, &cp);
-    if (aEntry->mRefCnt->IsPurple() && !cp->CanSkip(o, false) &&
+    if (!cp->CanSkip(o, false) &&
         (!mRemoveChildlessNodes || MayHaveChild(o, cp))) {
       return true;
     }
@@ -133,10 +133,10 @@ const nsCOMPtr<T> nsMaybeWeakPtr<T>::GetValue() const {
       }
     }
   } else {
-    ref = do_QueryInterface(mPtr, &rv);
-    if (NS_SUCCEEDED(rv)) {
-      return ref;
-    }
+    // A strong reference is only ever stored from a T*, so we can cast it
+    // back without a QueryInterface round-trip.
+    ref = static_cast<T*>(mPtr.get());
+    return ref;
   }
 
   return nullptr;
@@ -1241,6 +1241,16 @@ class JemallocHeapReporter final : public nsIMemoryReporter {
       "heap-allocated", KIND_OTHER, UNITS_BYTES, stats.allocated,
 "The same as 'heap-committed/allocated'.");
 
+    MOZ_COLLECT_REPORT(
+      "heap-secondary-arenas", KIND_OTHER, UNITS_BYTES,
+      stats.allocated_secondary,
+"The portion of 'heap-allocated' that was allocated from arenas other than "
+"the default one: the JS engine's string and array-buffer-contents arenas, "
+"the arenas that threads opt into with jemalloc_thread_local_arena (Servo "
+"style workers and the WebRender render thread), and other moz_arena users. "
+"Comparing this with 'heap-allocated' over time attributes heap growth "
+"between those subsystems and the rest of Gecko.");
+
     // We mark this and the other heap-overhead reporters as KIND_NONHEAP
     // because KIND_HEAP memory means "counted in heap-allocated", which
     // this is not.
@@ -1748,7 +1758,13 @@ nsMemoryReporterManager::GetReportsExtended(
 
   MEMORY_REPORTING_LOG("GetReports (gen=%u)\n", generation);
 
-  uint32_t concurrency = Preferences::GetUint("memory.report_concurrency", 1);
+  // The concurrency limit bounds the peak memory overhead of reporting
+  // itself (see bug 1154053), but a limit of 1 makes child processes report
+  // strictly one after another, which on sessions with many content
+  // processes takes long enough to distort the snapshot (and can run into
+  // the timeout). Ten at a time keeps the overhead modest while letting the
+  // parent's main thread process child reports as they stream in.
+  uint32_t concurrency = Preferences::GetUint("memory.report_concurrency", 10);
   MOZ_ASSERT(concurrency >= 1);
   if (concurrency < 1) {
     concurrency = 1;
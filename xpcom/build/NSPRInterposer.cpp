@@ -62,22 +62,43 @@ class NSPRIOAutoObservation : public IOInterposeObserver::Observation {
  public:
   explicit NSPRIOAutoObservation(IOInterposeObserver::Operation aOp,
                                  PRFileDesc* aFd)
-      : IOInterposeObserver::Observation(aOp, "NSPRIOInterposer") {
-    char filename[MAXPATHLEN];
-    if (mShouldReport && aFd &&
-        GetPathFromFd(PR_FileDesc2NativeHandle(aFd), filename,
-                      sizeof(filename)) != -1) {
-      mFilename = NS_ConvertUTF8toUTF16(filename);
-    } else {
-      mFilename.Truncate();
+      : IOInterposeObserver::Observation(aOp, "NSPRIOInterposer"),
+        mFd(mShouldReport ? aFd : nullptr),
+        mHasQueriedFilename(false) {
+    if (aOp == IOInterposeObserver::OpClose && mFd) {
+      // The file descriptor is no longer valid by the time the observers run,
+      // so close is the one operation that has to resolve the filename up
+      // front.  For everything else we wait until an observer actually asks,
+      // which most never do.
+      QueryFilename();
     }
   }
 
-  void Filename(nsAString& aFilename) override { aFilename = mFilename; }
+  void Filename(nsAString& aFilename) override {
+    if (!mHasQueriedFilename) {
+      QueryFilename();
+    }
+
+    aFilename = mFilename;
+  }
 
   ~NSPRIOAutoObservation() override { Report(); }
 
  private:
+  void QueryFilename() {
+    mHasQueriedFilename = true;
+
+    char filename[MAXPATHLEN];
+    if (mFd && GetPathFromFd(PR_FileDesc2NativeHandle(mFd), filename,
+                             sizeof(filename)) != -1) {
+      mFilename = NS_ConvertUTF8toUTF16(filename);
+    } else {
+      mFilename.Truncate();
+    }
+  }
+
+  PRFileDesc* mFd;
+  bool mHasQueriedFilename;
   nsString mFilename;
 };
 
@@ -10,6 +10,7 @@
 #include "mozilla/ArenaAllocator.h"
 #include "mozilla/CheckedInt.h"
 #include "nsAString.h"
+#include "nsTDependentString.h"
 
 /**
  * Extensions to the ArenaAllocator class.
@@ -50,6 +51,30 @@ T* ArenaStrdup(const detail::nsTStringRepr<T>& aStr,
   return detail::DuplicateString(aStr.BeginReading(), aStr.Length(), aArena);
 }
 
+/**
+ * Makes an arena allocated null-terminated copy of the source string and
+ * returns a dependent string wrapping the copy. This allows a group of
+ * related short-lived strings to share one arena and be released together
+ * when the arena is cleared, instead of each owning a heap buffer.
+ *
+ * The returned string must not outlive |aArena|. Allocation failure is
+ * fatal, like the arena's infallible Allocate().
+ *
+ * @param aStr String to copy.
+ * @param aArena The arena to allocate the string copy out of.
+ * @return A dependent string viewing the arena allocated copy.
+ */
+template <typename T, size_t ArenaSize, size_t Alignment>
+nsTDependentString<T> ArenaStrdupString(
+    const detail::nsTStringRepr<T>& aStr,
+    ArenaAllocator<ArenaSize, Alignment>& aArena) {
+  T* copy = detail::DuplicateString(aStr.BeginReading(), aStr.Length(), aArena);
+  if (!copy) {
+    NS_ABORT_OOM((size_t(aStr.Length()) + 1) * sizeof(T));
+  }
+  return nsTDependentString<T>(copy, aStr.Length());
+}
+
 /**
  * Copies the source string and adds a null terminator. Source string does not
  * have to be null terminated.
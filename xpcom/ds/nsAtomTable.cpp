@@ -220,6 +220,15 @@ class nsAtomTable {
   nsStaticAtom* GetStaticAtom(const nsAString& aUTF16String);
   void RegisterStaticAtoms(const nsStaticAtom* aAtoms, size_t aAtomsLen);
 
+  // Shared miss path for the Atomize() variants. Creates the atom for
+  // |aUTF16String| without holding the subtable lock, so that the allocation
+  // and char copy don't serialize concurrent atomizers, then inserts it under
+  // the lock. If another thread atomized the same string in the meantime we
+  // defer to its atom and discard ours.
+  already_AddRefed<nsAtom> InsertAtom(nsAtomSubTable& aTable,
+                                      AtomTableKey& aKey,
+                                      const nsAString& aUTF16String);
+
   // The result of this function may be imprecise if other threads are operating
   // on atoms concurrently. It's also slow, since it triggers a GC before
   // counting.
@@ -544,6 +553,27 @@ already_AddRefed<nsAtom> NS_Atomize(const char* aUTF8String) {
   return gAtomTable->Atomize(nsDependentCString(aUTF8String));
 }
 
+already_AddRefed<nsAtom> nsAtomTable::InsertAtom(nsAtomSubTable& aTable,
+                                                 AtomTableKey& aKey,
+                                                 const nsAString& aUTF16String) {
+  RefPtr<nsAtom> atom =
+      dont_AddRef(nsDynamicAtom::Create(aUTF16String, aKey.mHash));
+
+  MutexAutoLock lock(aTable.mLock);
+  AtomTableEntry* he = aTable.Add(aKey);
+  if (he->mAtom) {
+    // Another thread inserted an atom for this string while we were creating
+    // ours. Ours was never published, so a table GC would never reclaim it;
+    // destroy it directly rather than going through Release().
+    RefPtr<nsAtom> existing = he->mAtom;
+    nsDynamicAtom::Destroy(atom.forget().take()->AsDynamic());
+    return existing.forget();
+  }
+
+  he->mAtom = atom;
+  return atom.forget();
+}
+
 already_AddRefed<nsAtom> nsAtomTable::Atomize(const nsACString& aUTF8String) {
   bool err;
   AtomTableKey key(aUTF8String.Data(), aUTF8String.Length(), &err);
@@ -556,21 +586,19 @@ already_AddRefed<nsAtom> nsAtomTable::Atomize(const nsACString& aUTF8String) {
     return Atomize(str);
   }
   nsAtomSubTable& table = SelectSubTable(key);
-  MutexAutoLock lock(table.mLock);
-  AtomTableEntry* he = table.Add(key);
-
-  if (he->mAtom) {
-    RefPtr<nsAtom> atom = he->mAtom;
-    return atom.forget();
+  {
+    MutexAutoLock lock(table.mLock);
+    AtomTableEntry* he = table.Search(key);
+    if (he) {
+      RefPtr<nsAtom> atom = he->mAtom;
+      return atom.forget();
+    }
   }
 
+  // Miss. Do the UTF-16 conversion and atom creation outside the lock.
   nsString str;
   CopyUTF8toUTF16(aUTF8String, str);
-  RefPtr<nsAtom> atom = dont_AddRef(nsDynamicAtom::Create(str, key.mHash));
-
-  he->mAtom = atom;
-
-  return atom.forget();
+  return InsertAtom(table, key, str);
 }
 
 already_AddRefed<nsAtom> NS_Atomize(const nsACString& aUTF8String) {
@@ -586,19 +614,16 @@ already_AddRefed<nsAtom> NS_Atomize(const char16_t* aUTF16String) {
 already_AddRefed<nsAtom> nsAtomTable::Atomize(const nsAString& aUTF16String) {
   AtomTableKey key(aUTF16String.Data(), aUTF16String.Length());
   nsAtomSubTable& table = SelectSubTable(key);
-  MutexAutoLock lock(table.mLock);
-  AtomTableEntry* he = table.Add(key);
-
-  if (he->mAtom) {
-    RefPtr<nsAtom> atom = he->mAtom;
-    return atom.forget();
+  {
+    MutexAutoLock lock(table.mLock);
+    AtomTableEntry* he = table.Search(key);
+    if (he) {
+      RefPtr<nsAtom> atom = he->mAtom;
+      return atom.forget();
+    }
   }
 
-  RefPtr<nsAtom> atom =
-      dont_AddRef(nsDynamicAtom::Create(aUTF16String, key.mHash));
-  he->mAtom = atom;
-
-  return atom.forget();
+  return InsertAtom(table, key, aUTF16String);
 }
 
 already_AddRefed<nsAtom> NS_Atomize(const nsAString& aUTF16String) {
@@ -618,18 +643,17 @@ already_AddRefed<nsAtom> nsAtomTable::AtomizeMainThread(
   }
 
   nsAtomSubTable& table = SelectSubTable(key);
-  MutexAutoLock lock(table.mLock);
-  AtomTableEntry* he = table.Add(key);
-
-  if (he->mAtom) {
-    retVal = he->mAtom;
-  } else {
-    RefPtr<nsAtom> newAtom =
-        dont_AddRef(nsDynamicAtom::Create(aUTF16String, key.mHash));
-    he->mAtom = newAtom;
-    retVal = newAtom.forget();
+  {
+    MutexAutoLock lock(table.mLock);
+    AtomTableEntry* he = table.Search(key);
+    if (he) {
+      retVal = he->mAtom;
+      p.Set(retVal);
+      return retVal.forget();
+    }
   }
 
+  retVal = InsertAtom(table, key, aUTF16String);
   p.Set(retVal);
   return retVal.forget();
 }
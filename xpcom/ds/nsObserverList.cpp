@@ -30,15 +30,19 @@ void nsObserverList::GetObserverList(nsISimpleEnumerator** anEnumerator) {
   e.forget(anEnumerator);
 }
 
-void nsObserverList::FillObserverArray(nsCOMArray<nsIObserver>& aArray) {
+void nsObserverList::FillObserverArray(
+    nsTArray<nsCOMPtr<nsIObserver>>& aArray) {
   aArray.SetCapacity(mObservers.Length());
 
-  nsMaybeWeakPtrArray<nsIObserver> observers(mObservers);
+  // Observers can be removed from the list (even reentrantly, while the weak
+  // references below are being resolved), so iterate over a snapshot of it.
+  AutoTArray<nsMaybeWeakPtr<nsIObserver>, 8> observers;
+  observers.AppendElements(mObservers);
 
   for (int32_t i = observers.Length() - 1; i >= 0; --i) {
     nsCOMPtr<nsIObserver> observer = observers[i].GetValue();
     if (observer) {
-      aArray.AppendObject(observer);
+      aArray.AppendElement(std::move(observer));
     } else {
       // the object has gone away, remove the weakref
       mObservers.RemoveElementAt(i);
@@ -59,10 +63,13 @@ void nsObserverList::AppendStrongObservers(nsCOMArray<nsIObserver>& aArray) {
 
 void nsObserverList::NotifyObservers(nsISupports* aSubject, const char* aTopic,
                                      const char16_t* someData) {
-  nsCOMArray<nsIObserver> observers;
+  // Most topics have only a handful of observers, so with the inline
+  // capacities here and in FillObserverArray() the common notification
+  // doesn't touch the heap at all.
+  AutoTArray<nsCOMPtr<nsIObserver>, 8> observers;
   FillObserverArray(observers);
 
-  for (int32_t i = 0; i < observers.Count(); ++i) {
+  for (uint32_t i = 0; i < observers.Length(); ++i) {
     observers[i]->Observe(aSubject, aTopic, someData);
   }
 }
@@ -74,13 +81,13 @@ nsObserverEnumerator::nsObserverEnumerator(nsObserverList* aObserverList)
 
 NS_IMETHODIMP
 nsObserverEnumerator::HasMoreElements(bool* aResult) {
-  *aResult = (mIndex < mObservers.Count());
+  *aResult = (mIndex < mObservers.Length());
   return NS_OK;
 }
 
 NS_IMETHODIMP
 nsObserverEnumerator::GetNext(nsISupports** aResult) {
-  if (mIndex == mObservers.Count()) {
+  if (mIndex == mObservers.Length()) {
     return NS_ERROR_FAILURE;
   }
 
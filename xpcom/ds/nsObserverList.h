@@ -39,7 +39,7 @@ class nsObserverList : public nsCharPtrHashKey {
 
   // Fill an array with the observers of this category.
   // The array is filled in last-added-first order.
-  void FillObserverArray(nsCOMArray<nsIObserver>& aArray);
+  void FillObserverArray(nsTArray<nsCOMPtr<nsIObserver>>& aArray);
 
   // Like FillObserverArray(), but only for strongly held observers.
   void AppendStrongObservers(nsCOMArray<nsIObserver>& aArray);
@@ -59,8 +59,8 @@ class nsObserverEnumerator final : public nsSimpleEnumerator {
  private:
   ~nsObserverEnumerator() override = default;
 
-  int32_t mIndex;  // Counts up from 0
-  nsCOMArray<nsIObserver> mObservers;
+  uint32_t mIndex;  // Counts up from 0
+  nsTArray<nsCOMPtr<nsIObserver>> mObservers;
 };
 
 #endif /* nsObserverList_h___ */
@@ -517,6 +517,16 @@ nsPersistentProperties::Enumerate(nsISimpleEnumerator** aResult) {
   return NS_NewArrayEnumerator(aResult, props, NS_GET_IID(nsIPropertyElement));
 }
 
+void nsPersistentProperties::EnumerateEntries(
+    const std::function<void(const nsCString& aKey, const nsString& aValue)>&
+        aCallback) const {
+  for (auto iter = mTable.ConstIter(); !iter.Done(); iter.Next()) {
+    auto entry = static_cast<const PropertyTableEntry*>(iter.Get());
+    aCallback(nsDependentCString(entry->mKey),
+              nsDependentString(entry->mValue));
+  }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // XXX Some day we'll unify the nsIPersistentProperties interface with
 // nsIProperties, but until now...
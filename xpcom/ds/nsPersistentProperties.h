@@ -7,6 +7,8 @@
 #ifndef nsPersistentProperties_h___
 #define nsPersistentProperties_h___
 
+#include <functional>
+
 #include "nsIPersistentProperties2.h"
 #include "PLDHashTable.h"
 #include "nsString.h"
@@ -27,6 +29,16 @@ class nsPersistentProperties final : public nsIPersistentProperties {
   size_t SizeOfIncludingThis(
       mozilla::MallocSizeOf aMallocSizeOf) const override;
 
+  /**
+   * Steps through all key/value pairs, calling aCallback for each one. Unlike
+   * Enumerate(), this does not allocate a property element and an array slot
+   * per pair. The strings passed to the callback point into this instance's
+   * arena and must be copied if they outlive it.
+   */
+  void EnumerateEntries(
+      const std::function<void(const nsCString& aKey, const nsString& aValue)>&
+          aCallback) const;
+
  private:
   ~nsPersistentProperties();
 
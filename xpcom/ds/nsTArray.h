@@ -1615,6 +1615,28 @@ class nsTArray_Impl
     return AppendElements<Item, Allocator, FallibleAlloc>(aArray);
   }
 
+  // Move-construct elements from a raw range onto the end of this array. The
+  // source elements are left in their moved-from state; the caller still owns
+  // them and is responsible for destroying them. Unlike the AppendElements
+  // overload taking an nsTArray_Impl&&, this works with any buffer of movable
+  // elements, so it can be used to flatten several arrays into one without
+  // copying their contents.
+  // @param aArray    The elements to move into this array.
+  // @param aArrayLen The number of elements to move into this array.
+  // @return          A pointer to the new elements in the array, or null if
+  //                  the operation failed due to insufficient memory.
+ protected:
+  template <class Item, typename ActualAlloc = Alloc>
+  elem_type* MoveAppendElements(Item* aArray, size_type aArrayLen);
+
+ public:
+  template <class Item>
+  /* MOZ_MUST_USE */
+  elem_type* MoveAppendElements(Item* aArray, size_type aArrayLen,
+                                const mozilla::fallible_t&) {
+    return MoveAppendElements<Item, FallibleAlloc>(aArray, aArrayLen);
+  }
+
   // Move all elements from another array to the end of this array.
   // @return A pointer to the newly appended elements, or null on OOM.
  protected:
@@ -2362,6 +2384,25 @@ auto nsTArray_Impl<E, Alloc>::AppendElements(const Item* aArray,
   return Elements() + len;
 }
 
+template <typename E, class Alloc>
+template <class Item, typename ActualAlloc>
+auto nsTArray_Impl<E, Alloc>::MoveAppendElements(Item* aArray,
+                                                 size_type aArrayLen)
+    -> elem_type* {
+  if (!ActualAlloc::Successful(this->template ExtendCapacity<ActualAlloc>(
+          Length(), aArrayLen, sizeof(elem_type)))) {
+    return nullptr;
+  }
+  index_type len = Length();
+  elem_type* iter = Elements() + len;
+  for (Item *src = aArray, *end = aArray + aArrayLen; src != end;
+       ++src, ++iter) {
+    elem_traits::Construct(iter, std::move(*src));
+  }
+  this->IncrementLength(aArrayLen);
+  return Elements() + len;
+}
+
 template <typename E, class Alloc>
 template <class Item, class Allocator, typename ActualAlloc>
 auto nsTArray_Impl<E, Alloc>::AppendElements(
@@ -2465,6 +2506,7 @@ class nsTArray : public nsTArray_Impl<E, nsTArrayInfallibleAllocator> {
   using base_type::InsertElementAt;
   using base_type::InsertElementsAt;
   using base_type::InsertElementSorted;
+  using base_type::MoveAppendElements;
   using base_type::ReplaceElementsAt;
   using base_type::SetCapacity;
   using base_type::SetLength;
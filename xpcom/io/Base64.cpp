@@ -33,18 +33,15 @@ uint8_t CharTo8Bit(T aChar) {
 
 template <typename SrcT, typename DestT>
 static void Encode3to4(const SrcT* aSrc, DestT* aDest) {
-  uint32_t b32 = (uint32_t)0;
-  int i, j = 18;
-
-  for (i = 0; i < 3; ++i) {
-    b32 <<= 8;
-    b32 |= CharTo8Bit(aSrc[i]);
-  }
-
-  for (i = 0; i < 4; ++i) {
-    aDest[i] = base[(uint32_t)((b32 >> j) & 0x3F)];
-    j -= 6;
-  }
+  // Straight-line table lookups; the shift loops the NSPR original used here
+  // defeat vectorization and cost measurably on large inputs.
+  uint8_t src0 = CharTo8Bit(aSrc[0]);
+  uint8_t src1 = CharTo8Bit(aSrc[1]);
+  uint8_t src2 = CharTo8Bit(aSrc[2]);
+  aDest[0] = base[src0 >> 2];
+  aDest[1] = base[((src0 & 0x03) << 4) | (src1 >> 4)];
+  aDest[2] = base[((src1 & 0x0F) << 2) | (src2 >> 6)];
+  aDest[3] = base[src2 & 0x3F];
 }
 
 template <typename SrcT, typename DestT>
@@ -296,6 +296,10 @@ class nsPipe final : public nsIPipe {
   uint32_t GetBufferSegmentCount(const nsPipeReadState& aReadState,
                                  const ReentrantMonitorAutoEnter& ev) const;
   bool IsAdvanceBufferFull(const ReentrantMonitorAutoEnter& ev) const;
+  nsresult GetWriteSegmentInternal(char*& aSegment, uint32_t& aSegmentLen,
+                                   const ReentrantMonitorAutoEnter& ev);
+  void AdvanceWriteCursorInternal(uint32_t aCount, nsPipeEvents& aEvents,
+                                  const ReentrantMonitorAutoEnter& ev);
 
   //
   // methods below may be called while outside the pipe's monitor
@@ -304,6 +308,13 @@ class nsPipe final : public nsIPipe {
   void DrainInputStream(nsPipeReadState& aReadState, nsPipeEvents& aEvents);
   nsresult GetWriteSegment(char*& aSegment, uint32_t& aSegmentLen);
   void AdvanceWriteCursor(uint32_t aCount);
+  // Equivalent to AdvanceWriteCursor() followed by GetWriteSegment(), but
+  // done under a single monitor acquisition.  A bulk writer crosses a
+  // segment boundary every few KB, and taking the monitor twice per boundary
+  // shows up as contention when the reader runs on another thread.
+  nsresult AdvanceWriteCursorAndGetNextSegment(uint32_t aCount,
+                                               char*& aSegment,
+                                               uint32_t& aSegmentLen);
 
   void OnInputStreamException(nsPipeInputStream* aStream, nsresult aReason);
   void OnPipeException(nsresult aReason, bool aOutputOnly = false);
@@ -794,7 +805,12 @@ bool nsPipe::ReadSegmentBeingWritten(nsPipeReadState& aReadState) {
 
 nsresult nsPipe::GetWriteSegment(char*& aSegment, uint32_t& aSegmentLen) {
   ReentrantMonitorAutoEnter mon(mReentrantMonitor);
+  return GetWriteSegmentInternal(aSegment, aSegmentLen, mon);
+}
 
+nsresult nsPipe::GetWriteSegmentInternal(char*& aSegment,
+                                         uint32_t& aSegmentLen,
+                                         const ReentrantMonitorAutoEnter& mon) {
   if (NS_FAILED(mStatus)) {
     return mStatus;
   }
@@ -840,42 +856,60 @@ nsresult nsPipe::GetWriteSegment(char*& aSegment, uint32_t& aSegmentLen) {
 }
 
 void nsPipe::AdvanceWriteCursor(uint32_t aBytesWritten) {
-  MOZ_DIAGNOSTIC_ASSERT(aBytesWritten > 0);
+  nsPipeEvents events;
+  {
+    ReentrantMonitorAutoEnter mon(mReentrantMonitor);
+    AdvanceWriteCursorInternal(aBytesWritten, events, mon);
+  }
+}
 
+nsresult nsPipe::AdvanceWriteCursorAndGetNextSegment(uint32_t aBytesWritten,
+                                                     char*& aSegment,
+                                                     uint32_t& aSegmentLen) {
+  nsresult rv;
   nsPipeEvents events;
   {
     ReentrantMonitorAutoEnter mon(mReentrantMonitor);
+    AdvanceWriteCursorInternal(aBytesWritten, events, mon);
+    rv = GetWriteSegmentInternal(aSegment, aSegmentLen, mon);
+  }
+  return rv;
+}
 
-    LOG(("OOO advancing write cursor by %u\n", aBytesWritten));
+void nsPipe::AdvanceWriteCursorInternal(uint32_t aBytesWritten,
+                                        nsPipeEvents& aEvents,
+                                        const ReentrantMonitorAutoEnter& mon) {
+  MOZ_DIAGNOSTIC_ASSERT(aBytesWritten > 0);
 
-    char* newWriteCursor = mWriteCursor + aBytesWritten;
-    MOZ_DIAGNOSTIC_ASSERT(newWriteCursor <= mWriteLimit);
+  LOG(("OOO advancing write cursor by %u\n", aBytesWritten));
 
-    // update read limit if reading in the same segment
-    UpdateAllReadCursors(newWriteCursor);
+  char* newWriteCursor = mWriteCursor + aBytesWritten;
+  MOZ_DIAGNOSTIC_ASSERT(newWriteCursor <= mWriteLimit);
 
-    mWriteCursor = newWriteCursor;
+  // update read limit if reading in the same segment
+  UpdateAllReadCursors(newWriteCursor);
 
-    ValidateAllReadCursors();
+  mWriteCursor = newWriteCursor;
 
-    // update the writable flag on the output stream
-    if (mWriteCursor == mWriteLimit) {
-      mOutput.SetWritable(!IsAdvanceBufferFull(mon));
-    }
+  ValidateAllReadCursors();
 
-    // notify input stream that pipe now contains additional data
-    bool needNotify = false;
-    for (uint32_t i = 0; i < mInputList.Length(); ++i) {
-      if (mInputList[i]->OnInputReadable(aBytesWritten, events, mon) ==
-          NotifyMonitor) {
-        needNotify = true;
-      }
-    }
+  // update the writable flag on the output stream
+  if (mWriteCursor == mWriteLimit) {
+    mOutput.SetWritable(!IsAdvanceBufferFull(mon));
+  }
 
-    if (needNotify) {
-      mon.NotifyAll();
+  // notify input stream that pipe now contains additional data
+  bool needNotify = false;
+  for (uint32_t i = 0; i < mInputList.Length(); ++i) {
+    if (mInputList[i]->OnInputReadable(aBytesWritten, aEvents, mon) ==
+        NotifyMonitor) {
+      needNotify = true;
     }
   }
+
+  if (needNotify) {
+    mon.NotifyAll();
+  }
 }
 
 void nsPipe::OnInputStreamException(nsPipeInputStream* aStream,
@@ -1633,12 +1667,14 @@ nsPipeOutputStream::WriteSegments(nsReadSegmentFun aReader, void* aClosure,
 
   nsresult rv = NS_OK;
 
-  char* segment;
-  uint32_t segmentLen;
+  char* segment = nullptr;
+  uint32_t segmentLen = 0;
 
   *aWriteCount = 0;
-  while (aCount) {
+  if (aCount) {
     rv = mPipe->GetWriteSegment(segment, segmentLen);
+  }
+  while (aCount) {
     if (NS_FAILED(rv)) {
       if (rv == NS_BASE_STREAM_WOULD_BLOCK) {
         // pipe is full
@@ -1652,6 +1688,7 @@ nsPipeOutputStream::WriteSegments(nsReadSegmentFun aReader, void* aClosure,
         // wait for the pipe to have an empty segment.
         rv = Wait();
         if (NS_SUCCEEDED(rv)) {
+          rv = mPipe->GetWriteSegment(segment, segmentLen);
           continue;
         }
       }
@@ -1688,7 +1725,15 @@ nsPipeOutputStream::WriteSegments(nsReadSegmentFun aReader, void* aClosure,
     }
 
     if (segmentLen < originalLen) {
-      mPipe->AdvanceWriteCursor(originalLen - segmentLen);
+      uint32_t bytesWritten = originalLen - segmentLen;
+      if (aCount) {
+        // More to write, so retire this segment and pick up the next one
+        // under a single monitor acquisition.
+        rv = mPipe->AdvanceWriteCursorAndGetNextSegment(bytesWritten, segment,
+                                                        segmentLen);
+      } else {
+        mPipe->AdvanceWriteCursor(bytesWritten);
+      }
     }
   }
 
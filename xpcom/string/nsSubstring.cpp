@@ -86,6 +86,7 @@ class nsStringStats {
       printf("\n");
     }
     printf(" => mShareCount:     % 10d\n", int(mShareCount));
+    printf(" => mCopyAssignCount:% 10d\n", int(mCopyAssignCount));
     printf(" => mAdoptCount:     % 10d\n", int(mAdoptCount));
     printf(" => mAdoptFreeCount: % 10d", int(mAdoptFreeCount));
     if (mAdoptCount > mAdoptFreeCount) {
@@ -105,6 +106,11 @@ class nsStringStats {
   AtomicInt mReallocCount;
   AtomicInt mFreeCount;
   AtomicInt mShareCount;
+  // Assignments from another string object that had to copy the chars
+  // because the source buffer was not shareable (e.g. a dependent string).
+  // A high count relative to mShareCount suggests call sites that could
+  // use shared buffers or an arena instead.
+  AtomicInt mCopyAssignCount;
   AtomicInt mAdoptCount;
   AtomicInt mAdoptFreeCount;
 };
@@ -496,6 +496,7 @@ bool nsTSubstring<T>::Assign(const self_type& aStr,
   }
 
   // else, treat this like an ordinary assignment.
+  STRING_STAT_INCREMENT(CopyAssign);
   return Assign(aStr.Data(), aStr.Length(), aFallible);
 }
 
@@ -309,4 +309,13 @@ TEST(ArenaAllocator, Extensions)
   nsAutoCString y("testing c-string");
   nsAutoCString::char_type* y_copy = mozilla::ArenaStrdup(y, a);
   EXPECT_TRUE(y.Equals(y_copy));
+
+  // Make sure the dependent-string-returning variant views an arena copy.
+  nsDependentString wideDup = mozilla::ArenaStrdupString(x, a);
+  EXPECT_TRUE(x.Equals(wideDup));
+  EXPECT_NE(x.BeginReading(), wideDup.BeginReading());
+
+  nsDependentCString narrowDup = mozilla::ArenaStrdupString(y, a);
+  EXPECT_TRUE(y.Equals(narrowDup));
+  EXPECT_NE(y.BeginReading(), narrowDup.BeginReading());
 }
@@ -10,6 +10,7 @@
 #include "nsString.h"
 
 #include "gtest/gtest.h"
+#include "gtest/MozGTestBench.h"  // For MOZ_GTEST_BENCH
 
 struct Chunk {
   Chunk(uint32_t l, const char* c) : mLength(l), mData(c) {}
@@ -407,3 +408,21 @@ TEST(Base64, TruncateOnInvalidDecodeWideString)
 }
 
 // TODO: Add tests for OOM handling.
+
+// Roundtrip a ~1MB payload to keep an eye on bulk encode/decode throughput.
+MOZ_GTEST_BENCH(Base64, EncodeDecode1MB, [] {
+  nsAutoCString binary;
+  binary.SetLength(1024 * 1024);
+  char* buf = binary.BeginWriting();
+  for (uint32_t i = 0; i < binary.Length(); ++i) {
+    buf[i] = static_cast<char>(i * 31);
+  }
+
+  for (int rep = 0; rep < 10; ++rep) {
+    nsAutoCString encoded;
+    ASSERT_EQ(mozilla::Base64Encode(binary, encoded), NS_OK);
+    nsAutoCString decoded;
+    ASSERT_EQ(mozilla::Base64Decode(encoded, decoded), NS_OK);
+    ASSERT_TRUE(decoded.Equals(binary));
+  }
+});
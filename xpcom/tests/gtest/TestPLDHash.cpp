@@ -9,6 +9,7 @@
 #include "nsICrashReporter.h"
 #include "nsServiceManagerUtils.h"
 #include "gtest/gtest.h"
+#include "gtest/MozGTestBench.h"  // For MOZ_GTEST_BENCH
 
 // This test mostly focuses on edge cases. But more coverage of normal
 // operations wouldn't be a bad thing.
@@ -333,6 +334,31 @@ TEST(PLDHashTableTest, Iterator)
   ASSERT_EQ(t.Capacity(), unsigned(PLDHashTable::kMinCapacity));
 }
 
+// Keep an eye on the throughput of the basic operations on a table with a
+// plausible working-set size, using the same ops as typical void*-keyed
+// consumers.
+MOZ_GTEST_BENCH(PLDHashTableTest, AddSearchRemoveBench, [] {
+  static const size_t kNumEntries = 16384;
+  for (int rep = 0; rep < 20; ++rep) {
+    PLDHashTable t(PLDHashTable::StubOps(), sizeof(PLDHashEntryStub));
+    for (size_t i = 1; i <= kNumEntries; ++i) {
+      auto entry = static_cast<PLDHashEntryStub*>(t.Add((const void*)i));
+      entry->key = (const void*)i;
+    }
+    size_t found = 0;
+    for (size_t i = 1; i <= kNumEntries; ++i) {
+      if (t.Search((const void*)i)) {
+        found++;
+      }
+    }
+    ASSERT_EQ(found, kNumEntries);
+    for (size_t i = 1; i <= kNumEntries; ++i) {
+      t.Remove((const void*)i);
+    }
+    ASSERT_EQ(t.EntryCount(), 0u);
+  }
+});
+
 // This test involves resizing a table repeatedly up to 512 MiB in size. On
 // 32-bit platforms (Win32, Android) it sometimes OOMs, causing the test to
 // fail. (See bug 931062 and bug 1267227.) Therefore, we only run it on 64-bit
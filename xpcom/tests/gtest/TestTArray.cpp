@@ -97,6 +97,34 @@ TEST(TArray, AppendElementsRvalue)
   ASSERT_TRUE(temp.IsEmpty());
 }
 
+TEST(TArray, MoveAppendElementsRange)
+{
+  uint32_t destructionCounter = 0;
+
+  nsTArray<Movable> array;
+  {
+    Movable movable[2];
+    movable[0].mDestructionCounter = &destructionCounter;
+    movable[1].mDestructionCounter = &destructionCounter;
+    array.MoveAppendElements(movable, ArrayLength(movable));
+    ASSERT_EQ(2u, array.Length());
+    // The source elements were moved from, so destroying them must not
+    // affect the counter.
+  }
+  ASSERT_EQ(0u, destructionCounter);
+
+  {
+    Movable movable[1];
+    movable[0].mDestructionCounter = &destructionCounter;
+    array.MoveAppendElements(movable, ArrayLength(movable));
+    ASSERT_EQ(3u, array.Length());
+  }
+  ASSERT_EQ(0u, destructionCounter);
+
+  array.Clear();
+  ASSERT_EQ(3u, destructionCounter);
+}
+
 TEST(TArray, Assign)
 {
   nsTArray<int> array;
@@ -13,6 +13,7 @@
 #include "nsXPCOM.h"
 #include "mozilla/Monitor.h"
 #include "gtest/gtest.h"
+#include "gtest/MozGTestBench.h"  // For MOZ_GTEST_BENCH
 
 class nsRunner final : public nsIRunnable {
   ~nsRunner() {}
@@ -267,3 +268,23 @@ TEST(Threads, StressNSPR)
     delete[] array;
   }
 }
+
+// Keep an eye on the throughput of dispatching trivial runnables to another
+// thread and draining them; this covers the allocation, queueing and wake-up
+// costs of the event queue.
+MOZ_GTEST_BENCH(Threads, DispatchBench, [] {
+  nsCOMPtr<nsIThread> thread;
+  nsresult rv = NS_NewNamedThread("DispatchBench", getter_AddRefs(thread));
+  ASSERT_TRUE(NS_SUCCEEDED(rv));
+
+  for (int i = 0; i < 100000; i++) {
+    rv = thread->Dispatch(NS_NewRunnableFunction("DispatchBench", [] {}),
+                          NS_DISPATCH_NORMAL);
+    ASSERT_TRUE(NS_SUCCEEDED(rv));
+  }
+
+  // Shutdown() processes the remaining events first, so this also measures
+  // the cost of running the queue dry.
+  rv = thread->Shutdown();
+  ASSERT_TRUE(NS_SUCCEEDED(rv));
+});
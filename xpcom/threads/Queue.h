@@ -30,18 +30,21 @@ class Queue {
     if (mHead) {
       free(mHead);
     }
+    if (mFreePage) {
+      free(mFreePage);
+    }
   }
 
   T& Push(T&& aElement) {
     if (!mHead) {
-      mHead = NewPage();
+      mHead = TakePage();
       MOZ_ASSERT(mHead);
 
       mTail = mHead;
       mOffsetHead = 0;
       mOffsetTail = 0;
     } else if (mOffsetTail == ItemsPerPage) {
-      Page* page = NewPage();
+      Page* page = TakePage();
       MOZ_ASSERT(page);
 
       mTail->mNext = page;
@@ -73,7 +76,14 @@ class Queue {
     if (mOffsetHead == ItemsPerPage) {
       Page* dead = mHead;
       mHead = mHead->mNext;
-      free(dead);
+      // Keep one retired page around for reuse. In steady state a busy queue
+      // retires and allocates a page every ItemsPerPage events, so this
+      // single-entry cache removes that malloc/free churn entirely.
+      if (!mFreePage) {
+        mFreePage = dead;
+      } else {
+        free(dead);
+      }
       mOffsetHead = 0;
     }
 
@@ -153,6 +163,9 @@ class Queue {
         n += aMallocSizeOf(page);
       }
     }
+    if (mFreePage) {
+      n += aMallocSizeOf(mFreePage);
+    }
     return n;
   }
 
@@ -180,8 +193,22 @@ class Queue {
     return static_cast<Page*>(moz_xcalloc(1, sizeof(Page)));
   }
 
+  // Returns the cached retired page if we have one, otherwise a fresh
+  // allocation. The items of a recycled page have all been moved out of, so
+  // Push() can assign into them just like freshly zeroed ones.
+  Page* TakePage() {
+    if (mFreePage) {
+      Page* page = mFreePage;
+      mFreePage = nullptr;
+      page->mNext = nullptr;
+      return page;
+    }
+    return NewPage();
+  }
+
   Page* mHead = nullptr;
   Page* mTail = nullptr;
+  Page* mFreePage = nullptr;
 
   uint16_t mOffsetHead = 0;  // offset into mHead where next item is removed
   uint16_t mOffsetTail = 0;  // offset into mTail where next item is added
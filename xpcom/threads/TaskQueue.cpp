@@ -189,31 +189,44 @@ nsresult TaskQueue::Runner::Run() {
   }
   MOZ_ASSERT(event);
 
-  // Note that dropping the queue monitor before running the task, and
+  // Run a bounded batch of tasks before re-dispatching the Runner, so that
+  // trains of small tasks don't pay a round trip through the backing target
+  // for every single task. The batch is kept small so we still don't hog the
+  // target for long stretches.
+  //
+  // Note that dropping the queue monitor before running each task, and
   // taking the monitor again after the task has run ensures we have memory
   // fences enforced. This means that if the object we're calling wasn't
   // designed to be threadsafe, it will be, provided we're only calling it
   // in this task queue.
-  {
-    AutoTaskGuard g(mQueue);
-    event->Run();
-  }
-
-  // Drop the reference to event. The event will hold a reference to the
-  // object it's calling, and we don't want to keep it alive, it may be
-  // making assumptions what holds references to it. This is especially
-  // the case if the object is waiting for us to shutdown, so that it
-  // can shutdown (like in the MediaDecoderStateMachine's SHUTDOWN case).
-  event = nullptr;
+  static const uint32_t kMaxTasksPerRun = 4;
+  for (uint32_t tasksRun = 1;; ++tasksRun) {
+    {
+      AutoTaskGuard g(mQueue);
+      event->Run();
+    }
 
-  {
-    MonitorAutoLock mon(mQueue->mQueueMonitor);
-    if (mQueue->mTasks.empty()) {
-      // No more events to run. Exit the task runner.
-      mQueue->mIsRunning = false;
-      mQueue->MaybeResolveShutdown();
-      mon.NotifyAll();
-      return NS_OK;
+    // Drop the reference to event. The event will hold a reference to the
+    // object it's calling, and we don't want to keep it alive, it may be
+    // making assumptions what holds references to it. This is especially
+    // the case if the object is waiting for us to shutdown, so that it
+    // can shutdown (like in the MediaDecoderStateMachine's SHUTDOWN case).
+    event = nullptr;
+
+    {
+      MonitorAutoLock mon(mQueue->mQueueMonitor);
+      if (mQueue->mTasks.empty()) {
+        // No more events to run. Exit the task runner.
+        mQueue->mIsRunning = false;
+        mQueue->MaybeResolveShutdown();
+        mon.NotifyAll();
+        return NS_OK;
+      }
+      if (tasksRun == kMaxTasksPerRun) {
+        break;
+      }
+      event = mQueue->mTasks.front().forget();
+      mQueue->mTasks.pop();
     }
   }
 
@@ -121,12 +121,18 @@ class TimerEventAllocator {
 // This is a nsICancelableRunnable because we can dispatch it to Workers and
 // those can be shut down at any time, and in these cases, Cancel() is called
 // instead of Run().
+//
+// One event can fire several timers, as long as they all target the same
+// thread: when a burst of timers is due in the same tick, the timer thread
+// batches them into a single event so the target only pays for one dispatch.
 class nsTimerEvent final : public CancelableRunnable {
  public:
   NS_IMETHOD Run() override;
 
   nsresult Cancel() override {
-    mTimer->Cancel();
+    for (TimerAndGeneration& entry : mTimers) {
+      entry.mTimer->Cancel();
+    }
     return NS_OK;
   }
 
@@ -134,10 +140,7 @@ class nsTimerEvent final : public CancelableRunnable {
   NS_IMETHOD GetName(nsACString& aName) override;
 #endif
 
-  explicit nsTimerEvent(already_AddRefed<nsTimerImpl> aTimer)
-      : mozilla::CancelableRunnable("nsTimerEvent"),
-        mTimer(aTimer),
-        mGeneration(mTimer->GetGeneration()) {
+  nsTimerEvent() : mozilla::CancelableRunnable("nsTimerEvent") {
     // Note: We override operator new for this class, and the override is
     // fallible!
     sAllocatorUsers++;
@@ -147,6 +150,16 @@ class nsTimerEvent final : public CancelableRunnable {
     }
   }
 
+  // Adds a timer to be fired by this event. All timers added to one event
+  // must share the same event target. The generation is captured here, while
+  // the TimerThread's monitor is held, so that a timer re-initialized after
+  // this point is not fired from this event.
+  void AddTimer(already_AddRefed<nsTimerImpl> aTimer) {
+    RefPtr<nsTimerImpl> timer(aTimer);
+    int32_t generation = timer->GetGeneration();
+    mTimers.AppendElement(TimerAndGeneration{std::move(timer), generation});
+  }
+
   static void Init();
   static void Shutdown();
   static void DeleteAllocatorIfNeeded();
@@ -159,7 +172,12 @@ class nsTimerEvent final : public CancelableRunnable {
     DeleteAllocatorIfNeeded();
   }
 
-  already_AddRefed<nsTimerImpl> ForgetTimer() { return mTimer.forget(); }
+  void ForgetTimers(nsTArray<RefPtr<nsTimerImpl>>& aTimers) {
+    for (TimerAndGeneration& entry : mTimers) {
+      aTimers.AppendElement(entry.mTimer.forget());
+    }
+    mTimers.Clear();
+  }
 
  private:
   nsTimerEvent(const nsTimerEvent&) = delete;
@@ -173,9 +191,15 @@ class nsTimerEvent final : public CancelableRunnable {
     sAllocatorUsers--;
   }
 
+  struct TimerAndGeneration {
+    RefPtr<nsTimerImpl> mTimer;
+    int32_t mGeneration;
+  };
+
   TimeStamp mInitTime;
-  RefPtr<nsTimerImpl> mTimer;
-  const int32_t mGeneration;
+  // Inline space for the common case of one due timer per event; a larger
+  // burst spills to the heap but still costs only one dispatch.
+  AutoTArray<TimerAndGeneration, 2> mTimers;
 
   static TimerEventAllocator* sAllocator;
 
@@ -238,12 +262,15 @@ void nsTimerEvent::DeleteAllocatorIfNeeded() {
 #ifdef MOZ_COLLECTING_RUNNABLE_TELEMETRY
 NS_IMETHODIMP
 nsTimerEvent::GetName(nsACString& aName) {
+  MOZ_RELEASE_ASSERT(!mTimers.IsEmpty());
   bool current;
   MOZ_RELEASE_ASSERT(
-      NS_SUCCEEDED(mTimer->mEventTarget->IsOnCurrentThread(&current)) &&
+      NS_SUCCEEDED(
+          mTimers[0].mTimer->mEventTarget->IsOnCurrentThread(&current)) &&
       current);
 
-  mTimer->GetName(aName);
+  // All timers in this event share a target; name the event after the first.
+  mTimers[0].mTimer->GetName(aName);
   return NS_OK;
 }
 #endif
@@ -253,11 +280,14 @@ nsTimerEvent::Run() {
   if (MOZ_LOG_TEST(GetTimerLog(), LogLevel::Debug)) {
     TimeStamp now = TimeStamp::Now();
     MOZ_LOG(GetTimerLog(), LogLevel::Debug,
-            ("[this=%p] time between PostTimerEvent() and Fire(): %fms\n", this,
-             (now - mInitTime).ToMilliseconds()));
+            ("[this=%p] time between PostTimerEvents() and Fire(): %fms, "
+             "firing %zu timer(s)\n",
+             this, (now - mInitTime).ToMilliseconds(), mTimers.Length()));
   }
 
-  mTimer->Fire(mGeneration);
+  for (TimerAndGeneration& entry : mTimers) {
+    entry.mTimer->Fire(entry.mGeneration);
+  }
 
   return NS_OK;
 }
@@ -418,37 +448,34 @@ TimerThread::Run() {
                   ("Timer thread woke up %fms from when it was supposed to\n",
                    fabs((now - timerRef->mTimeout).ToMilliseconds())));
 
-          // We are going to let the call to PostTimerEvent here handle the
-          // release of the timer so that we don't end up releasing the timer
-          // on the TimerThread instead of on the thread it targets.
-          timerRef = PostTimerEvent(timerRef.forget());
-
-          if (timerRef) {
-            // We got our reference back due to an error.
-            // Unhook the nsRefPtr, and release manually so we can get the
-            // refcount.
-            nsrefcnt rc = timerRef.forget().take()->Release();
-            (void)rc;
-
-            // The nsITimer interface requires that its users keep a reference
-            // to the timers they use while those timers are initialized but
-            // have not yet fired.  If this ever happens, it is a bug in the
-            // code that created and used the timer.
-            //
-            // Further, note that this should never happen even with a
-            // misbehaving user, because nsTimerImpl::Release checks for a
-            // refcount of 1 with an armed timer (a timer whose only reference
-            // is from the timer thread) and when it hits this will remove the
-            // timer from the timer thread and thus destroy the last reference,
-            // preventing this situation from occurring.
-            MOZ_ASSERT(rc != 0, "destroyed timer off its target thread!");
+          // Gather any other timers that are also due now (within the
+          // early-firing window) and share this timer's event target, so the
+          // whole batch costs the target a single dispatch. Timer-heavy
+          // content often queues many short timeouts against one thread, and
+          // dispatching them individually is pure overhead.
+          AutoTArray<RefPtr<nsTimerImpl>, 4> dueTimers;
+          dueTimers.AppendElement(timerRef.forget());
+          while (!mTimers.IsEmpty()) {
+            nsTimerImpl* next = mTimers[0]->Value();
+            if (!next || next->mEventTarget != dueTimers[0]->mEventTarget ||
+                (next->mTimeout - now).ToMicroseconds() >=
+                    double(mAllowedEarlyFiringMicroseconds)) {
+              break;
+            }
+            dueTimers.AppendElement(mTimers[0]->Take());
+            RemoveFirstTimerInternal();
           }
 
+          // We are going to let the call to PostTimerEvents here handle the
+          // release of the timers so that we don't end up releasing them on
+          // the TimerThread instead of on the thread they target.
+          PostTimerEvents(dueTimers);
+
           if (mShutdown) {
             break;
           }
 
-          // Update now, as PostTimerEvent plus the locking may have taken a
+          // Update now, as PostTimerEvents plus the locking may have taken a
           // tick or two, and we may goto next below.
           now = TimeStamp::Now();
         }
@@ -697,56 +724,85 @@ void TimerThread::RemoveFirstTimerInternal() {
   mTimers.RemoveLastElement();
 }
 
-already_AddRefed<nsTimerImpl> TimerThread::PostTimerEvent(
-    already_AddRefed<nsTimerImpl> aTimerRef) {
+void TimerThread::PostTimerEvents(nsTArray<RefPtr<nsTimerImpl>>& aTimers) {
   mMonitor.AssertCurrentThreadOwns();
+  MOZ_ASSERT(!aTimers.IsEmpty());
 
-  RefPtr<nsTimerImpl> timer(aTimerRef);
-  if (!timer->mEventTarget) {
+  if (!aTimers[0]->mEventTarget) {
     NS_ERROR("Attempt to post timer event to NULL event target");
-    return timer.forget();
+    ReleaseUndispatchedTimers(aTimers);
+    return;
   }
 
   // XXX we may want to reuse this nsTimerEvent in the case of repeating timers.
 
-  // Since we already addref'd 'timer', we don't need to addref here.
-  // We will release either in ~nsTimerEvent(), or pass the reference back to
-  // the caller. We need to copy the generation number from this timer into the
-  // event, so we can avoid firing a timer that was re-initialized after being
-  // canceled.
+  // Since we already addref'd the timers, we don't need to addref here. We
+  // will release either in ~nsTimerEvent(), or in
+  // ReleaseUndispatchedTimers() on failure. We need to copy the generation
+  // number from each timer into the event, so we can avoid firing a timer
+  // that was re-initialized after being canceled.
 
 #ifdef MOZ_TASK_TRACER
   // During the dispatch of TimerEvent, we overwrite the current TraceInfo
   // partially with the info saved in timer earlier, and restore it back by
   // AutoSaveCurTraceInfo.
   AutoSaveCurTraceInfo saveCurTraceInfo;
-  (timer->GetTracedTask()).SetTLSTraceInfo();
+  (aTimers[0]->GetTracedTask()).SetTLSTraceInfo();
 #endif
 
-  nsCOMPtr<nsIEventTarget> target = timer->mEventTarget;
+  nsCOMPtr<nsIEventTarget> target = aTimers[0]->mEventTarget;
 
   void* p = nsTimerEvent::operator new(sizeof(nsTimerEvent));
   if (!p) {
-    return timer.forget();
+    ReleaseUndispatchedTimers(aTimers);
+    return;
+  }
+  RefPtr<nsTimerEvent> event = ::new (KnownNotNull, p) nsTimerEvent();
+  for (RefPtr<nsTimerImpl>& timer : aTimers) {
+    MOZ_ASSERT(timer->mEventTarget == target);
+    event->AddTimer(timer.forget());
   }
-  RefPtr<nsTimerEvent> event =
-      ::new (KnownNotNull, p) nsTimerEvent(timer.forget());
+  aTimers.Clear();
 
   nsresult rv;
   {
-    // We release mMonitor around the Dispatch because if this timer is targeted
-    // at the TimerThread we'll deadlock.
+    // We release mMonitor around the Dispatch because if these timers are
+    // targeted at the TimerThread we'll deadlock.
     MonitorAutoUnlock unlock(mMonitor);
     rv = target->Dispatch(event, NS_DISPATCH_NORMAL);
   }
 
   if (NS_FAILED(rv)) {
-    timer = event->ForgetTimer();
-    RemoveTimerInternal(timer);
-    return timer.forget();
+    event->ForgetTimers(aTimers);
+    for (RefPtr<nsTimerImpl>& timer : aTimers) {
+      RemoveTimerInternal(timer);
+    }
+    ReleaseUndispatchedTimers(aTimers);
   }
+}
+
+void TimerThread::ReleaseUndispatchedTimers(
+    nsTArray<RefPtr<nsTimerImpl>>& aTimers) {
+  mMonitor.AssertCurrentThreadOwns();
 
-  return nullptr;
+  for (RefPtr<nsTimerImpl>& timer : aTimers) {
+    // Unhook the nsRefPtr, and release manually so we can get the refcount.
+    nsrefcnt rc = timer.forget().take()->Release();
+    (void)rc;
+
+    // The nsITimer interface requires that its users keep a reference to the
+    // timers they use while those timers are initialized but have not yet
+    // fired.  If this ever happens, it is a bug in the code that created and
+    // used the timer.
+    //
+    // Further, note that this should never happen even with a misbehaving
+    // user, because nsTimerImpl::Release checks for a refcount of 1 with an
+    // armed timer (a timer whose only reference is from the timer thread) and
+    // when it hits this will remove the timer from the timer thread and thus
+    // destroy the last reference, preventing this situation from occurring.
+    MOZ_ASSERT(rc != 0, "destroyed timer off its target thread!");
+  }
+  aTimers.Clear();
 }
 
 void TimerThread::DoBeforeSleep() {
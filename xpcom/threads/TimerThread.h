@@ -69,8 +69,11 @@ class TimerThread final : public nsIRunnable, public nsIObserver {
   void RemoveFirstTimerInternal();
   nsresult Init();
 
-  already_AddRefed<nsTimerImpl> PostTimerEvent(
-      already_AddRefed<nsTimerImpl> aTimerRef);
+  // Dispatches a single event firing all of aTimers, which must share one
+  // event target, to that target. On failure the timers are removed from the
+  // thread and released. Consumes the array either way.
+  void PostTimerEvents(nsTArray<RefPtr<nsTimerImpl>>& aTimers);
+  void ReleaseUndispatchedTimers(nsTArray<RefPtr<nsTimerImpl>>& aTimers);
 
   nsCOMPtr<nsIThread> mThread;
   Monitor mMonitor;
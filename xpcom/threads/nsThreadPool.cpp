@@ -35,6 +35,10 @@ static LazyLogModule sThreadPoolLog("nsThreadPool");
 #define DEFAULT_IDLE_THREAD_LIMIT 1
 #define DEFAULT_IDLE_THREAD_TIMEOUT PR_SecondsToInterval(60)
 
+// The maximum number of events a thread may claim from the queue in one lock
+// hold. See the comment in nsThreadPool::Run.
+#define MAX_EVENT_BATCH_SIZE 4
+
 NS_IMPL_ADDREF(nsThreadPool)
 NS_IMPL_RELEASE(nsThreadPool)
 NS_IMPL_CLASSINFO(nsThreadPool, nullptr, nsIClassInfo::THREADSAFE,
@@ -93,7 +97,13 @@ nsresult nsThreadPool::PutEvent(already_AddRefed<nsIRunnable> aEvent,
     }
 
     mEvents.PutEvent(std::move(aEvent), EventQueuePriority::Normal, lock);
-    mEventsAvailable.Notify();
+    // Only bother signalling if a thread is actually waiting. A thread only
+    // ever waits after incrementing mIdleCount under this lock, so if we see
+    // no idle threads here then every thread is busy and will re-check the
+    // queue before sleeping.
+    if (mIdleCount > 0) {
+      mEventsAvailable.Notify();
+    }
     stackSize = mStackSize;
   }
 
@@ -177,6 +187,7 @@ nsThreadPool::Run() {
 
   do {
     nsCOMPtr<nsIRunnable> event;
+    AutoTArray<nsCOMPtr<nsIRunnable>, MAX_EVENT_BATCH_SIZE - 1> batchedEvents;
     {
       MutexAutoLock lock(mMutex);
 
@@ -228,9 +239,22 @@ nsThreadPool::Run() {
           }
           LOG(("THRD-P(%p) done waiting\n", this));
         }
-      } else if (wasIdle) {
-        wasIdle = false;
-        --mIdleCount;
+      } else {
+        if (wasIdle) {
+          wasIdle = false;
+          --mIdleCount;
+        }
+
+        // When the queue is full of small events, taking the lock once per
+        // event makes the lock itself the bottleneck. Since we hold it
+        // anyway, claim a few more events, but only ones in excess of what
+        // the currently waiting threads have been notified for, so that no
+        // idle thread wakes up to find an empty queue.
+        while (batchedEvents.Length() + 1 < MAX_EVENT_BATCH_SIZE &&
+               mEvents.Count(lock) > mIdleCount) {
+          nsCOMPtr<nsIRunnable> batched = mEvents.GetEvent(nullptr, lock);
+          batchedEvents.AppendElement(std::move(batched));
+        }
       }
     }
     if (event) {
@@ -242,6 +266,13 @@ nsThreadPool::Run() {
       DelayForChaosMode(ChaosFeature::TaskRunning, 1000);
 
       event->Run();
+
+      for (nsCOMPtr<nsIRunnable>& batched : batchedEvents) {
+        LOG(("THRD-P(%p) %s running batched [%p]\n", this,
+             mName.BeginReading(), batched.get()));
+        nsCOMPtr<nsIRunnable> run = batched.forget();
+        run->Run();
+      }
     }
   } while (!exitThread);
 
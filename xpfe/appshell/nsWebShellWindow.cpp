@@ -52,6 +52,7 @@
 
 // For calculating size
 #include "nsPresContext.h"
+#include "nsRefreshDriver.h"
 
 #include "nsIBaseWindow.h"
 #include "nsIDocShellTreeItem.h"
@@ -414,6 +415,16 @@ void nsWebShellWindow::OcclusionStateChanged(bool aIsFullyOccluded) {
     // And always fire a user-defined occlusionstatechange event on the window
     ourWindow->DispatchCustomEvent(NS_LITERAL_STRING("occlusionstatechange"));
   }
+
+  // Nothing a fully occluded window paints can be seen, so tick its refresh
+  // driver at the throttled rate until it becomes visible again.
+  if (PresShell* presShell = GetPresShell()) {
+    nsPresContext* presContext = presShell->GetPresContext();
+    if (presContext &&
+        presContext->RefreshDriver()->GetPresContext() == presContext) {
+      presContext->RefreshDriver()->SetWidgetFullyOccluded(aIsFullyOccluded);
+    }
+  }
 }
 
 void nsWebShellWindow::OSToolbarButtonPressed() {